@@ -0,0 +1,16 @@
+#include "u_guiquads.glsl"
+
+uniform sampler2D sMainTex;
+
+in vec2 fragUV1;
+flat in int fragInstanceID;
+
+out vec4 fragColor;
+
+void main() {
+    vec3 uvw = vec3(fragUV1, 1.0);
+    vec2 uv = vec2(dot(uGUIQuads[fragInstanceID].uvX.xyz, uvw), dot(uGUIQuads[fragInstanceID].uvY.xyz, uvw));
+    vec4 mainTexSample = texture(sMainTex, uv);
+    vec4 color = uGUIQuads[fragInstanceID].color;
+    fragColor = vec4(color.rgb * mainTexSample.rgb, color.a * mainTexSample.a);
+}
@@ -0,0 +1,12 @@
+const int MAX_GUI_QUADS = 128;
+
+struct GUIQuad {
+    vec4 posScale;
+    vec4 color;
+    vec4 uvX;
+    vec4 uvY;
+};
+
+layout(std140) uniform GUIQuads {
+    GUIQuad uGUIQuads[MAX_GUI_QUADS];
+};
@@ -0,0 +1,17 @@
+#include "u_globals.glsl"
+#include "u_guiquads.glsl"
+
+layout(location = 0) in vec3 aPosition;
+layout(location = 2) in vec2 aUV1;
+
+out vec2 fragUV1;
+flat out int fragInstanceID;
+
+void main() {
+    vec4 posScale = uGUIQuads[gl_InstanceID].posScale;
+    vec4 P = vec4(posScale.xy + aPosition.xy * posScale.zw, aPosition.z, 1.0);
+    gl_Position = uProjection * uView * P;
+
+    fragUV1 = aUV1;
+    fragInstanceID = gl_InstanceID;
+}
@@ -26,6 +26,7 @@ struct AudioOptions {
     int voiceVolume {85};
     int soundVolume {85};
     int movieVolume {85};
+    bool headless {false};
 };
 
 } // namespace audio
@@ -110,6 +110,7 @@ public:
     void render();
 
     void playVideo(const std::string &name);
+    void stopVideo();
 
     bool isPaused() const { return _paused; }
     bool isTSL() const { return _gameId == resource::GameID::TSL; }
@@ -331,7 +332,7 @@ private:
     bool _relativeMouseMode {false};
 
     uint32_t _nextObjectId {2}; // ids 0 and 1 are reserved
-    std::map<uint32_t, std::shared_ptr<Object>> _objectById;
+    std::unordered_map<uint32_t, std::shared_ptr<Object>> _objectById;
 
     // Services
 
@@ -21,9 +21,11 @@
 #include "reone/gui/control/label.h"
 #include "reone/gui/control/listbox.h"
 #include "reone/gui/control/togglebutton.h"
+#include "reone/system/threadpool.h"
 
 #include "../gui.h"
 #include "../savedgame.h"
+#include "../savedgamecache.h"
 
 namespace reone {
 
@@ -36,8 +38,14 @@ public:
         _resRef = guiResRef("saveload");
     }
 
+    ~SaveLoad() {
+        cancelIndexing();
+    }
+
     void refresh();
 
+    void update(float dt) override;
+
     void setMode(SaveLoadMode mode);
 
 private:
@@ -47,6 +55,21 @@ private:
         std::filesystem::path path;
     };
 
+    struct IndexedSavedGame {
+        int number {0};
+        std::filesystem::path path;
+        SavedGameInfo info;
+    };
+
+    /**
+     * Results of saved game indexing tasks, shared with the thread pool.
+     */
+    struct IndexingQueue {
+        std::mutex mutex;
+        std::vector<IndexedSavedGame> indexed;
+        int numPending {0};
+    };
+
     struct Controls {
         std::shared_ptr<gui::Button> BTN_BACK;
         std::shared_ptr<gui::Button> BTN_DELETE;
@@ -73,6 +96,10 @@ private:
     SaveLoadMode _mode {SaveLoadMode::Save};
     std::vector<SavedGameDescriptor> _saves;
 
+    std::shared_ptr<SavedGameCache> _cache;
+    std::shared_ptr<IndexingQueue> _indexingQueue;
+    std::vector<std::shared_ptr<Task>> _indexingTasks;
+
     void onGUILoaded() override;
 
     void bindControls() {
@@ -97,7 +124,10 @@ private:
     }
 
     void refreshSavedGames();
-    void indexSavedGame(std::filesystem::path path);
+    void cancelIndexing();
+    void mergeIndexedSavedGames();
+    void addSavedGame(IndexedSavedGame indexed);
+    void refreshSavedGameItems();
 
     void saveGame(int number) {}
     void loadGame(int number) {}
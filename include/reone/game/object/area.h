@@ -21,6 +21,7 @@
 #include "reone/graphics/types.h"
 #include "reone/input/event.h"
 #include "reone/resource/format/gffreader.h"
+#include "reone/resource/format/gffview.h"
 #include "reone/resource/parser/gff/are.h"
 #include "reone/resource/parser/gff/git.h"
 #include "reone/resource/types.h"
@@ -33,6 +34,9 @@
 #include "../object/camera/static.h"
 #include "../object/camera/thirdperson.h"
 #include "../pathfinder.h"
+#include "../pathservice.h"
+#include "../script/scheduler.h"
+#include "../spatialgrid.h"
 #include "../types.h"
 
 namespace reone {
@@ -40,6 +44,11 @@ namespace reone {
 namespace game {
 
 const float kHeartbeatInterval = 6.0f;
+const int kNumHeartbeatPhases = 12;
+const int kMaxHeartbeatsPerFrame = 16;
+const float kMaxHeartbeatTimePerFrame = 0.002f;
+const float kObjectGridCellSize = 8.0f;
+const float kObjectGridMargin = 1.0f;
 
 class Creature;
 class Location;
@@ -49,6 +58,23 @@ class Room;
 using RoomMap = std::unordered_map<std::string, std::shared_ptr<Room>>;
 using ObjectList = std::vector<std::shared_ptr<Object>>;
 
+/**
+ * List of objects with constant time removal. Removing an object moves the
+ * last object into its slot, so insertion order is not preserved.
+ */
+class IndexedObjectList {
+public:
+    void add(std::shared_ptr<Object> object);
+    bool remove(const Object &object);
+
+    ObjectList &objects() { return _objects; }
+    const ObjectList &objects() const { return _objects; }
+
+private:
+    ObjectList _objects;
+    std::unordered_map<uint32_t, size_t> _indexById;
+};
+
 class Area : public Object {
 public:
     struct Grass {
@@ -68,7 +94,7 @@ public:
         Game &game,
         ServicesView &services);
 
-    void load(std::string name, const resource::Gff &are, const resource::Gff &git, bool fromSave = false);
+    void load(std::string name, const resource::GffView &are, const resource::GffView &git, bool fromSave = false);
 
     bool handle(const input::Event &event);
     void update(float dt);
@@ -94,8 +120,9 @@ public:
 
     const CameraStyle &camStyleDefault() const { return _camStyleDefault; }
     const std::string &music() const { return _music; }
-    const ObjectList &objects() const { return _objects; }
+    const ObjectList &objects() const { return _objects.objects(); }
     const Pathfinder &pathfinder() const { return _pathfinder; }
+    PathService &pathService() { return _pathService; }
     const std::string &localizedName() const { return _localizedName; }
     const RoomMap &rooms() const { return _rooms; }
     const Grass &grass() const { return _grass; }
@@ -205,19 +232,22 @@ public:
     void runOnEnterScript();
     void runOnExitScript();
 
+    const ScriptEventScheduler::Metrics &heartbeatMetrics() const { return _heartbeatScheduler.metrics(); }
+
     // END Scripts
 
 private:
     std::string _sceneName;
 
     Pathfinder _pathfinder;
+    PathService _pathService;
     std::string _localizedName;
     RoomMap _rooms;
     resource::Visibility _visibility;
     CameraStyle _camStyleDefault;
     CameraStyle _camStyleCombat;
     std::string _music;
-    Timer _heartbeatTimer;
+    ScriptEventScheduler _heartbeatScheduler {kHeartbeatInterval, kNumHeartbeatPhases, kMaxHeartbeatsPerFrame, kMaxHeartbeatTimePerFrame};
     bool _unescapable {false};
     Grass _grass;
     glm::vec3 _ambientColor {0.0f};
@@ -246,11 +276,15 @@ private:
 
     // Objects
 
-    ObjectList _objects;
-    std::unordered_map<ObjectType, ObjectList> _objectsByType;
+    IndexedObjectList _objects;
+    std::unordered_map<ObjectType, IndexedObjectList> _objectsByType;
     std::unordered_map<std::string, ObjectList> _objectsByTag;
     std::set<uint32_t> _objectsToDestroy;
 
+    SpatialGrid<std::shared_ptr<Object>> _objectGrid {kObjectGridCellSize, [](const std::shared_ptr<Object> &object) { return object->position(); }};
+    bool _objectGridDirty {true};
+    std::vector<std::pair<std::shared_ptr<Object>, float>> _nearestObjects;
+
     // END Objects
 
     // Stealth
@@ -280,6 +314,7 @@ private:
     void add(const std::shared_ptr<Object> &object);
     void doDestroyObject(uint32_t objectId);
     void doDestroyObjects();
+    void refreshObjectGrid();
     void updateVisibility();
     void updateHeartbeat(float dt);
 
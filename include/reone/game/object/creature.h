@@ -32,6 +32,7 @@
 
 #include "../d20/attributes.h"
 #include "../object.h"
+#include "../pathservice.h"
 
 #include "item.h"
 
@@ -57,6 +58,7 @@ public:
 
     struct Path {
         glm::vec3 destination {0.0f};
+        glm::vec3 plannedDestination {0.0f}; /**< destination the path was found for */
         std::vector<glm::vec3> points;
         uint32_t timeFound {0};
         int pointIdx {0};
@@ -179,6 +181,7 @@ public:
     bool navigateTo(const glm::vec3 &dest, bool run, float distance, float dt);
     void advanceOnPath(bool run, float dt);
     void updatePath(const glm::vec3 &dest);
+    void applyPathRequest(std::vector<glm::vec3> points);
 
     void clearPath();
     void setPath(const glm::vec3 &dest, std::vector<glm::vec3> &&points, uint32_t timeFound);
@@ -249,6 +252,9 @@ private:
     std::shared_ptr<graphics::Texture> _portrait;
     std::map<int, std::shared_ptr<Item>> _equipment;
     std::shared_ptr<Path> _path;
+    std::shared_ptr<PathService::Request> _pathRequest;
+    glm::vec3 _pathRequestDest {0.0f}; /**< destination that _pathRequest was made for */
+    uint32_t _pathRequestTime {0};
     float _walkSpeed {0.0f};
     float _runSpeed {0.0f};
     MovementType _movementType {MovementType::None};
@@ -293,9 +299,43 @@ private:
 
     // Animation
 
+    enum class RunAnimation {
+        Default,
+        SingleSword,
+        DualSwords,
+        DoubleBladedSword,
+        Rifle,
+
+        Count
+    };
+
+    static constexpr int kNumPauseAnimations = 10;   /**< out of combat, and by weapon wield number */
+    static constexpr int kNumCombatAnimations = 13;  /**< number of CombatAnimation values */
+    static constexpr int kNumWieldTypes = 10;        /**< number of CreatureWieldType values */
+    static constexpr int kNumAnimationVariants = 6;  /**< variants are 1-based */
+
+    /**
+     * Animations of the body model, resolved once per model and indexed by
+     * creature state.
+     */
+    struct AnimationTable {
+        const graphics::Model *model {nullptr};
+        std::array<std::shared_ptr<graphics::Animation>, kNumPauseAnimations> pause;
+        std::array<std::shared_ptr<graphics::Animation>, static_cast<int>(RunAnimation::Count)> run;
+        std::shared_ptr<graphics::Animation> walk;
+        std::shared_ptr<graphics::Animation> dead;
+        std::shared_ptr<graphics::Animation> talkNormal;
+        std::shared_ptr<graphics::Animation> headTalk;
+
+        // Combat animations are resolved on first use
+        std::vector<std::shared_ptr<graphics::Animation>> combat;
+        std::vector<bool> combatResolved;
+    };
+
     bool _animDirty {true};
     bool _animFireForget {false};
     std::shared_ptr<graphics::LipAnimation> _lipAnimation;
+    AnimationTable _animations;
 
     // END Animation
 
@@ -351,10 +391,22 @@ private:
     std::string getDieAnimation() const;
     std::string getHeadTalkAnimation() const;
     std::string getPauseAnimation() const;
+    std::string getPauseAnimation(int pauseIdx) const;
     std::string getRunAnimation() const;
+    std::string getRunAnimation(RunAnimation run) const;
     std::string getTalkNormalAnimation() const;
     std::string getWalkAnimation() const;
 
+    /**
+     * @return 0 when out of combat, weapon wield number otherwise
+     */
+    int getPauseAnimationIndex() const;
+
+    RunAnimation getRunAnimationType() const;
+
+    AnimationTable &getAnimationTable(const graphics::Model &model);
+    std::shared_ptr<graphics::Animation> getCombatAnimation(const graphics::Model &model, CombatAnimation anim, CreatureWieldType wield, int variant);
+
     /**
      * @return creatureAnim if model type is creature, elseAnim otherwise
      */
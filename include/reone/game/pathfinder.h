@@ -32,6 +32,16 @@ public:
 
     const std::vector<glm::vec3> findPath(const glm::vec3 &from, const glm::vec3 &to) const;
 
+    /**
+     * @return path vertices, or empty vector if there is no path between vertices
+     */
+    std::vector<glm::vec3> findPath(int fromVertex, int toVertex) const;
+
+    /**
+     * @return index of vertex nearest to point, or -1 if there are no vertices
+     */
+    int getNearestVertex(const glm::vec3 &point) const;
+
 private:
     struct ContextVertex {
         uint16_t index {0};
@@ -51,8 +61,6 @@ private:
 
     std::vector<glm::vec3> _vertices;
     std::unordered_map<uint16_t, std::vector<uint16_t>> _adjacentVertices;
-
-    uint16_t getNearestVertex(const glm::vec3 &point) const;
 };
 
 } // namespace game
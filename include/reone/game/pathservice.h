@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/system/threadpool.h"
+
+#include "pathfinder.h"
+
+namespace reone {
+
+namespace game {
+
+/**
+ * Finds paths on worker threads. Paths are found between pathfinder
+ * vertices nearest to start and goal, so creatures heading to the same
+ * target share both in-flight requests and cached results.
+ */
+class PathService : boost::noncopyable {
+public:
+    class Request : boost::noncopyable {
+    public:
+        bool isDone() const { return _done.load(std::memory_order_acquire); }
+
+        /**
+         * @return path vertices, empty if there is no path between vertices. Must only be called when done.
+         */
+        const std::vector<glm::vec3> &points() const { return _points; }
+
+    private:
+        std::atomic_bool _done {false};
+        std::vector<glm::vec3> _points;
+
+        friend class PathService;
+    };
+
+    PathService(const Pathfinder &pathfinder, IThreadPool &threadPool) :
+        _pathfinder(pathfinder),
+        _threadPool(threadPool) {
+    }
+
+    ~PathService();
+
+    /**
+     * Requests a path from start to goal. Result is already available when
+     * path is cached, or when pathfinder has no vertices.
+     */
+    std::shared_ptr<Request> requestPath(const glm::vec3 &from, const glm::vec3 &to);
+
+    /**
+     * Discards cached and in-flight paths, e.g. after pathfinder is
+     * reloaded. Paths that are being found when the cache is cleared are
+     * not cached.
+     */
+    void clearCache();
+
+    int numCachedPaths() const;
+
+private:
+    static constexpr int kMaxCachedPaths = 256;
+
+    const Pathfinder &_pathfinder;
+    IThreadPool &_threadPool;
+
+    /**
+     * Outlives the service in tasks that are still queued in the thread pool
+     * when the service is destroyed.
+     */
+    struct TaskState {
+        std::mutex mutex;
+        std::condition_variable condVar;
+        bool quit {false};
+        int numRunning {0};
+    };
+
+    std::shared_ptr<TaskState> _taskState {std::make_shared<TaskState>()};
+
+    mutable std::mutex _mutex;
+    std::unordered_map<uint32_t, std::shared_ptr<Request>> _cache;
+    std::deque<uint32_t> _cacheOrder; /**< cache keys in order of insertion, oldest first */
+    std::unordered_map<uint32_t, std::shared_ptr<Request>> _inFlight;
+    uint32_t _generation {0}; /**< incremented whenever cache is cleared */
+
+    void solve(uint32_t key, uint32_t generation, int fromVertex, int toVertex, std::shared_ptr<Request> request);
+};
+
+} // namespace game
+
+} // namespace reone
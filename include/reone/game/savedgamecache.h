@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/graphics/types.h"
+#include "reone/system/types.h"
+
+namespace reone {
+
+namespace game {
+
+/**
+ * Metadata and downscaled screenshot of a saved game, as persisted by SavedGameCache.
+ */
+struct SavedGameInfo {
+    std::string lastModule;
+
+    int screenWidth {0};
+    int screenHeight {0};
+    graphics::PixelFormat screenFormat {graphics::PixelFormat::BGR8}; /**< one of R8, BGR8 or BGRA8 */
+    ByteBuffer screenPixels;                                          /**< empty if saved game has no screenshot */
+};
+
+/**
+ * Persistent cache of saved game metadata, keyed by saved game path. Entries
+ * are invalidated when size or modification time of a saved game changes.
+ *
+ * Safe to query and populate from multiple threads.
+ */
+class SavedGameCache : boost::noncopyable {
+public:
+    SavedGameCache(std::filesystem::path path) :
+        _path(std::move(path)) {
+    }
+
+    /**
+     * Loads the cache from disk. Missing, outdated or malformed cache files are ignored.
+     */
+    void load();
+
+    /**
+     * Writes the cache to disk, if it was modified since last load or save.
+     * Entries that were neither found nor put since last load or save are
+     * dropped.
+     */
+    void save();
+
+    std::optional<SavedGameInfo> find(const std::filesystem::path &savePath);
+
+    void put(const std::filesystem::path &savePath, SavedGameInfo info);
+
+private:
+    struct FileStamp {
+        uint64_t size {0};
+        int64_t modifiedAt {0};
+
+        bool operator==(const FileStamp &rhs) const {
+            return size == rhs.size && modifiedAt == rhs.modifiedAt;
+        }
+    };
+
+    struct CachedInfo {
+        SavedGameInfo info;
+        FileStamp stamp;
+        bool used {false};
+    };
+
+    std::filesystem::path _path;
+
+    std::unordered_map<std::string, CachedInfo> _pathToInfo;
+    bool _dirty {false};
+    std::mutex _mutex;
+
+    std::optional<FileStamp> stampFile(const std::filesystem::path &path) const;
+};
+
+/**
+ * Reduces screenshot of a saved game, using a box filter, so that neither of
+ * its dimensions exceeds maxSize. Screenshots that are small enough are left
+ * intact.
+ */
+void downscaleScreenshot(SavedGameInfo &info, int maxSize);
+
+} // namespace game
+
+} // namespace reone
@@ -18,12 +18,16 @@
 #pragma once
 
 #include "reone/script/types.h"
+#include "reone/script/virtualmachinepool.h"
 
 namespace reone {
 
 namespace script {
 
+struct ExecutionContext;
+
 class IRoutines;
+class ScriptProgram;
 
 }
 
@@ -49,9 +53,13 @@ public:
         int userDefinedEventNumber = -1,
         int scriptVar = -1);
 
+    int run(std::shared_ptr<script::ScriptProgram> program, std::unique_ptr<script::ExecutionContext> context);
+
 private:
     script::IRoutines &_routines;
     resource::IScripts &_scripts;
+
+    script::VirtualMachinePool _machines;
 };
 
 } // namespace game
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace game {
+
+/**
+ * Spreads periodic script events, e.g. heartbeats, across their interval by
+ * splitting it into phases, and limits the number of events and time spent
+ * dispatching them per frame. Events exceeding the budget are carried over
+ * to subsequent frames.
+ */
+class ScriptEventScheduler : boost::noncopyable {
+public:
+    struct Event {
+        uint32_t callerId {0};
+        std::string resRef;
+    };
+
+    /**
+     * Counts other than queue depths refer to the frame ended by the last
+     * call to dispatch.
+     */
+    struct Metrics {
+        int queueDepth {0};
+        int maxQueueDepth {0};
+        int numDispatched {0};
+        int numCarriedOver {0};
+        int numSkipped {0};
+    };
+
+    ScriptEventScheduler(float interval,
+                         int numPhases,
+                         int maxEventsPerFrame,
+                         float maxTimePerFrame) :
+        _interval(interval),
+        _numPhases(std::max(1, numPhases)),
+        _maxEventsPerFrame(std::max(1, maxEventsPerFrame)),
+        _maxTimePerFrame(maxTimePerFrame) {
+    }
+
+    /**
+     * Advances the schedule by dt and invokes onPhaseDue for every phase
+     * that became due.
+     */
+    void update(float dt, const std::function<void(int)> &onPhaseDue);
+
+    /**
+     * Queues an event, unless an event for the same caller is already queued.
+     *
+     * @return true if event was queued, false otherwise
+     */
+    bool enqueue(uint32_t callerId, std::string resRef);
+
+    /**
+     * Dispatches queued events in FIFO order until per-frame budget is
+     * exhausted. At least one event is dispatched per call.
+     */
+    void dispatch(const std::function<void(const Event &)> &run);
+
+    void clear();
+
+    int phaseOf(uint32_t callerId) const {
+        return static_cast<int>(callerId % _numPhases);
+    }
+
+    const Metrics &metrics() const {
+        return _metrics;
+    }
+
+private:
+    float _interval;
+    int _numPhases;
+    int _maxEventsPerFrame;
+    float _maxTimePerFrame;
+
+    float _phaseTime {0.0f};
+    int _nextPhase {0};
+
+    std::deque<Event> _queue;
+    std::unordered_set<uint32_t> _queuedCallers;
+    int _numSkipped {0}; /**< events skipped since last dispatch */
+
+    Metrics _metrics;
+};
+
+} // namespace game
+
+} // namespace reone
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace game {
+
+/**
+ * Uniform grid over the XY plane, used to answer k-nearest queries without
+ * visiting every item. Items are stored by value, e.g. as shared pointers,
+ * and bucketed by position at insertion time. Distances are always computed
+ * from current item positions, so items may move by a small margin without
+ * the grid having to be rebuilt.
+ */
+template <class T>
+class SpatialGrid : boost::noncopyable {
+public:
+    typedef std::function<glm::vec3(const T &)> PositionFunc;
+
+    SpatialGrid(float cellSize, PositionFunc getPosition) :
+        _cellSize(cellSize),
+        _getPosition(std::move(getPosition)) {
+    }
+
+    void clear() {
+        _cells.clear();
+        _numItems = 0;
+    }
+
+    void add(T item) {
+        glm::vec3 position(_getPosition(item));
+        glm::ivec2 cell(getCell(position));
+        if (_numItems == 0) {
+            _minCell = cell;
+            _maxCell = cell;
+        } else {
+            _minCell = glm::min(_minCell, cell);
+            _maxCell = glm::max(_maxCell, cell);
+        }
+        _cells[getCellKey(cell)].push_back(Entry {std::move(item), position});
+        ++_numItems;
+    }
+
+    /**
+     * Finds up to count items nearest to origin that satisfy predicate.
+     *
+     * Cells are visited in rings of increasing distance from origin, stopping
+     * once no unvisited cell can contain a closer item. Result is sorted by
+     * square distance.
+     *
+     * @param margin distance by which items may have moved since insertion, see isStale
+     */
+    void findNearest(
+        const glm::vec3 &origin,
+        int count,
+        const std::function<bool(const T &)> &predicate,
+        std::vector<std::pair<T, float>> &result,
+        float margin = 0.0f) const {
+
+        result.clear();
+        if (count <= 0 || _numItems == 0) {
+            return;
+        }
+        glm::ivec2 center(getCell(origin));
+        int maxRing = std::max(
+            std::max(center.x - _minCell.x, _maxCell.x - center.x),
+            std::max(center.y - _minCell.y, _maxCell.y - center.y));
+
+        for (int ring = 0; ring <= maxRing; ++ring) {
+            for (int y = center.y - ring; y <= center.y + ring; ++y) {
+                bool edgeRow = y == center.y - ring || y == center.y + ring;
+                int step = edgeRow ? 1 : std::max(1, 2 * ring);
+                for (int x = center.x - ring; x <= center.x + ring; x += step) {
+                    auto cell = _cells.find(getCellKey(glm::ivec2(x, y)));
+                    if (cell == _cells.end()) {
+                        continue;
+                    }
+                    for (auto &entry : cell->second) {
+                        if (predicate(entry.item)) {
+                            glm::vec3 delta(_getPosition(entry.item) - origin);
+                            result.push_back(std::make_pair(entry.item, glm::dot(delta, delta)));
+                        }
+                    }
+                }
+            }
+            if (result.size() >= static_cast<size_t>(count)) {
+                std::nth_element(result.begin(), result.begin() + count - 1, result.end(), compareDistance);
+                float bound = ring * _cellSize - margin;
+                if (bound > 0.0f && result[count - 1].second <= bound * bound) {
+                    break;
+                }
+            }
+        }
+
+        if (result.size() > static_cast<size_t>(count)) {
+            std::nth_element(result.begin(), result.begin() + count - 1, result.end(), compareDistance);
+            result.resize(count);
+        }
+        std::sort(result.begin(), result.end(), compareDistance);
+    }
+
+    /**
+     * @return true if any item has moved farther than margin from the position it was inserted at
+     */
+    bool isStale(float margin) const {
+        float margin2 = margin * margin;
+        for (auto &cell : _cells) {
+            for (auto &entry : cell.second) {
+                glm::vec3 delta(_getPosition(entry.item) - entry.position);
+                if (glm::dot(delta, delta) > margin2) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    int numItems() const { return _numItems; }
+
+private:
+    struct Entry {
+        T item;
+        glm::vec3 position {0.0f};
+    };
+
+    float _cellSize;
+    PositionFunc _getPosition;
+
+    std::unordered_map<int64_t, std::vector<Entry>> _cells;
+    glm::ivec2 _minCell {0};
+    glm::ivec2 _maxCell {0};
+    int _numItems {0};
+
+    glm::ivec2 getCell(const glm::vec3 &position) const {
+        return glm::ivec2(
+            static_cast<int>(glm::floor(position.x / _cellSize)),
+            static_cast<int>(glm::floor(position.y / _cellSize)));
+    }
+
+    static int64_t getCellKey(const glm::ivec2 &cell) {
+        return (static_cast<int64_t>(cell.x) << 32) | static_cast<uint32_t>(cell.y);
+    }
+
+    static bool compareDistance(const std::pair<T, float> &left, const std::pair<T, float> &right) {
+        return left.second < right.second;
+    }
+};
+
+} // namespace game
+
+} // namespace reone
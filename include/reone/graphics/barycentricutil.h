@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "reone/system/random.h"
 #include "reone/system/randomutil.h"
 
 namespace reone {
@@ -56,6 +57,12 @@ inline glm::vec3 getRandomBarycentric() {
     return glm::vec3(1.0f - r1sqrt, r1sqrt * (1.0f - r2), r2 * r1sqrt);
 }
 
+inline glm::vec3 getRandomBarycentric(RandomGenerator &rng) {
+    float r1sqrt = glm::sqrt(rng.nextFloat(0.0f, 1.0f));
+    float r2 = rng.nextFloat(0.0f, 1.0f);
+    return glm::vec3(1.0f - r1sqrt, r1sqrt * (1.0f - r2), r2 * r1sqrt);
+}
+
 } // namespace graphics
 
 } // namespace reone
@@ -19,6 +19,8 @@
 
 #include "../context.h"
 #include "../meshregistry.h"
+#include "../pbrcache.h"
+#include "../programbinarycache.h"
 #include "../pbrtextures.h"
 #include "../shaderregistry.h"
 #include "../statistic.h"
@@ -45,6 +47,7 @@ public:
     Context &context() { return *_context; }
     MeshRegistry &meshRegistry() { return *_meshRegistry; }
     PBRTextures &pbrTextures() { return *_pbrTextures; }
+    ProgramBinaryCache &programBinaryCache() { return *_programBinaryCache; }
     ShaderRegistry &shaderRegistry() { return *_shaderRegistry; }
     Statistic &statistic() { return *_statistic; }
     TextureRegistry &textureRegistry() { return *_textureRegistry; }
@@ -57,7 +60,9 @@ private:
 
     std::unique_ptr<Context> _context;
     std::unique_ptr<MeshRegistry> _meshRegistry;
+    std::unique_ptr<PBRCache> _pbrCache;
     std::unique_ptr<PBRTextures> _pbrTextures;
+    std::unique_ptr<ProgramBinaryCache> _programBinaryCache;
     std::unique_ptr<ShaderRegistry> _shaderRegistry;
     std::unique_ptr<Statistic> _statistic;
     std::unique_ptr<TextureRegistry> _textureRegistry;
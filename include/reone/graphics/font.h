@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "reone/system/cache.h"
+
 #include "types.h"
 
 namespace reone {
@@ -43,7 +45,9 @@ public:
         _meshRegistry(meshRegistry),
         _shaderRegistry(shaderRegistry),
         _statistic(statistic),
-        _uniforms(uniforms) {
+        _uniforms(uniforms),
+        _glyphRuns(kMaxGlyphRuns),
+        _lineBreaks(kMaxLineBreaks) {
     }
 
     void load(std::shared_ptr<Texture> texture);
@@ -58,13 +62,32 @@ public:
 
     float height() const { return _height; }
 
+    /**
+     * Line breaks of previously wrapped strings, keyed by text and maximum
+     * width. Used by breakText.
+     */
+    LRUCache<std::pair<std::string, int>, std::vector<std::string>> &lineBreaks() { return _lineBreaks; }
+
 private:
+    static constexpr int kMaxGlyphRuns = 512;
+    static constexpr int kMaxLineBreaks = 256;
+
     struct Glyph {
         glm::vec2 ul {0.0f};
         glm::vec2 lr {0.0f};
         glm::vec2 size {0.0f};
     };
 
+    /**
+     * Glyph quads of a string laid out from the origin, ready to be offset
+     * by position and gravity.
+     */
+    struct GlyphRun {
+        std::vector<glm::vec4> posScale;
+        std::vector<glm::vec4> uv;
+        float width {0.0f};
+    };
+
     std::shared_ptr<Texture> _texture;
     float _height {0.0f};
     std::vector<Glyph> _glyphs;
@@ -79,7 +102,12 @@ private:
 
     // END Services
 
-    glm::vec2 getTextOffset(const std::string &text, TextGravity gravity) const;
+    LRUCache<std::string, GlyphRun> _glyphRuns;
+    LRUCache<std::pair<std::string, int>, std::vector<std::string>> _lineBreaks;
+
+    std::shared_ptr<GlyphRun> getGlyphRun(const std::string &text);
+
+    glm::vec2 getTextOffset(float width, TextGravity gravity) const;
 };
 
 } // namespace graphics
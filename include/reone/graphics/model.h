@@ -52,6 +52,7 @@ public:
 
     void setSuperModel(std::shared_ptr<Model> superModel) {
         _superModel = std::move(superModel);
+        _animationsResolved = false;
     }
 
     // Nodes
@@ -66,6 +67,10 @@ public:
     // Animations
 
     std::vector<std::string> getAnimationNames() const;
+
+    /**
+     * @return animation of this model or, failing that, of the nearest supermodel
+     */
     std::shared_ptr<Animation> getAnimation(const std::string &name) const;
 
     const std::unordered_map<std::string, std::shared_ptr<Animation>> &animations() const {
@@ -89,8 +94,12 @@ private:
     std::unordered_map<uint16_t, std::shared_ptr<ModelNode>> _nodeByNumber;
     std::unordered_map<std::string, std::shared_ptr<ModelNode>> _nodeByName;
 
+    std::unordered_map<std::string, std::shared_ptr<Animation>> _resolvedAnimations; /**< animations of this model and all supermodels */
+    bool _animationsResolved {false};
+
     void fillLookups(const std::shared_ptr<ModelNode> &node);
     void computeAABB();
+    void resolveAnimations();
 };
 
 } // namespace graphics
@@ -39,6 +39,7 @@ struct GraphicsOptions {
     int shadowResolution {2048};
     int anisotropicFiltering {2};
     float drawDistance {kDefaultObjectDrawDistance};
+    bool headless {false};
 };
 
 } // namespace graphics
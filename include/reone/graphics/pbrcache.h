@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/system/types.h"
+
+namespace reone {
+
+namespace graphics {
+
+class Texture;
+
+/**
+ * Persistent cache of textures derived by PBRTextures: the BRDF lookup table
+ * and per-environment map irradiance and prefiltered cube maps. Derived
+ * textures are rendered once and then loaded from disk in later sessions.
+ *
+ * Files are read and written on a background thread.
+ */
+class PBRCache : boost::noncopyable {
+public:
+    PBRCache(std::filesystem::path dir) :
+        _dir(std::move(dir)) {
+    }
+
+    ~PBRCache() { deinit(); }
+
+    void init();
+    void deinit();
+
+    struct Entry {
+        std::string key;
+        std::shared_ptr<ByteBuffer> data; /**< null if key is not cached */
+    };
+
+    /**
+     * Reads cached data asynchronously.
+     */
+    std::future<Entry> load(std::string key);
+
+    /**
+     * Reads data derived from the environment map asynchronously. Cache key
+     * is based on name and contents of the environment map and is computed
+     * on the background thread.
+     */
+    std::future<Entry> loadEnvMapDerived(const Texture &envMap);
+
+    /**
+     * Writes data to the cache asynchronously.
+     */
+    void save(std::string key, std::shared_ptr<ByteBuffer> data);
+
+private:
+    struct Job {
+        std::string key;
+        std::shared_ptr<ByteBuffer> data;
+        std::promise<Entry> result;
+        bool write {false};
+
+        // Key hashing
+
+        bool hashKey {false};
+        uint64_t keyHash {0};
+        std::vector<std::shared_ptr<ByteBuffer>> keyData;
+
+        // END Key hashing
+    };
+
+    std::filesystem::path _dir;
+
+    bool _inited {false};
+    std::thread _worker;
+    std::mutex _mutex;
+    std::condition_variable _condVar;
+    std::deque<Job> _jobs;
+    bool _quit {false};
+
+    void work();
+
+    void enqueue(Job job);
+
+    std::shared_ptr<ByteBuffer> read(const std::string &key) const;
+    void write(const std::string &key, const ByteBuffer &data) const;
+
+    std::filesystem::path getPath(const std::string &key) const;
+};
+
+} // namespace graphics
+
+} // namespace reone
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "framebuffer.h"
+#include "pbrcache.h"
 #include "renderbuffer.h"
 #include "texture.h"
 
@@ -26,10 +27,10 @@ namespace reone {
 namespace graphics {
 
 struct EnvMapDerivedRequest {
-    Texture &texture;
+    std::shared_ptr<Texture> texture;
 
     EnvMapDerivedRequest(Texture &texture) :
-        texture(texture) {
+        texture(texture.shared_from_this()) {
     }
 };
 
@@ -41,7 +42,7 @@ template <>
 struct std::less<reone::graphics::EnvMapDerivedRequest> {
     bool operator()(const reone::graphics::EnvMapDerivedRequest &lhs,
                     const reone::graphics::EnvMapDerivedRequest &rhs) const {
-        return lhs.texture.name() < rhs.texture.name();
+        return lhs.texture->name() < rhs.texture->name();
     }
 };
 
@@ -82,6 +83,10 @@ public:
 
     void refresh();
 
+    void setCache(PBRCache *cache) {
+        _cache = cache;
+    }
+
     void requestEnvMapDerived(EnvMapDerivedRequest request) {
         _envMapDerivedRequests.insert(std::move(request));
     }
@@ -107,12 +112,19 @@ public:
     }
 
 private:
+    struct PendingEnvMapDerived {
+        std::shared_ptr<Texture> envMap;
+        std::future<PBRCache::Entry> cached;
+    };
+
     IContext &_context;
     IMeshRegistry &_meshRegistry;
     IShaderRegistry &_shaderRegistry;
     IStatistic &_statistic;
     IUniforms &_uniforms;
 
+    PBRCache *_cache {nullptr};
+
     std::shared_ptr<Texture> _brdfLUT;
     std::shared_ptr<Renderbuffer> _brdfDepthBuffer;
     std::shared_ptr<Framebuffer> _brdfFramebuffer;
@@ -125,6 +137,7 @@ private:
     std::vector<std::shared_ptr<Renderbuffer>> _prefilterDepthBuffers;
     std::shared_ptr<Framebuffer> _prefilterFramebuffer;
     std::map<std::string, int> _envMapToDerivedLayer;
+    std::optional<PendingEnvMapDerived> _pendingEnvMapDerived;
 
     int _envMapDerivedLayer {0};
 
@@ -132,9 +145,14 @@ private:
     void initIrradianceMapArray();
     void initPrefilteredEnvMapArray();
 
-    void refreshEnvMapDerived(const EnvMapDerivedRequest &request);
-    void refreshIrradianceMap(const EnvMapDerivedRequest &request, int layer);
-    void refreshPrefilteredEnvMap(const EnvMapDerivedRequest &request, int layer);
+    void renderBRDFLUT();
+
+    void requestCachedEnvMapDerived(std::shared_ptr<Texture> envMap);
+    void refreshEnvMapDerived(Texture &envMap, const std::string &cacheKey, const std::shared_ptr<ByteBuffer> &cached);
+    void refreshIrradianceMap(Texture &envMap, int layer, ByteBuffer *readback);
+    void refreshPrefilteredEnvMap(Texture &envMap, int layer, ByteBuffer *readback);
+
+    bool loadEnvMapDerived(const ByteBuffer &cached, int layer);
 };
 
 } // namespace graphics
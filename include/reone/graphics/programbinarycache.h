@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/system/types.h"
+
+namespace reone {
+
+namespace graphics {
+
+/**
+ * Persistent cache of linked shader program binaries. Binaries are keyed by
+ * a hash of shader sources and the OpenGL driver, so that programs are only
+ * compiled from source when either changes.
+ */
+class ProgramBinaryCache : boost::noncopyable {
+public:
+    struct Binary {
+        uint32_t format {0};
+        ByteBuffer data;
+    };
+
+    ProgramBinaryCache(std::filesystem::path dir) :
+        _dir(std::move(dir)) {
+    }
+
+    /**
+     * Queries driver support for program binaries. Requires a current OpenGL
+     * context.
+     */
+    void init();
+
+    std::optional<Binary> load(const std::string &key) const;
+    void save(const std::string &key, const Binary &binary) const;
+
+    bool isSupported() const { return _supported; }
+    const std::string &driver() const { return _driver; }
+
+    /**
+     * @param sources sources of all shaders of a program, including preprocessor directives
+     * @param driver identifies OpenGL vendor, renderer and version
+     */
+    static std::string getKey(const std::vector<std::string> &sources, const std::string &driver);
+
+private:
+    std::filesystem::path _dir;
+
+    bool _supported {false};
+    std::string _driver;
+
+    std::filesystem::path getPath(const std::string &key) const;
+};
+
+} // namespace graphics
+
+} // namespace reone
@@ -35,6 +35,9 @@ public:
     void init();
     void deinit();
 
+    ShaderType type() const { return _type; }
+    const std::list<std::string> &sources() const { return _sources; }
+
     uint32_t nameGL() const { return _nameGL; }
 
 private:
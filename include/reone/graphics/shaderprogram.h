@@ -17,16 +17,73 @@
 
 #pragma once
 
+#include "reone/system/tracer.h"
+
 #include "shader.h"
 
 namespace reone {
 
 namespace graphics {
 
+class ProgramBinaryCache;
+
+/**
+ * Identifies a uniform by name across all shader programs. Names are
+ * interned on construction, so handles should be created once, e.g. as
+ * static constants, and reused when setting uniforms.
+ */
+class UniformHandle {
+public:
+    explicit UniformHandle(const std::string &name);
+
+    int id() const { return _id; }
+    const std::string &name() const;
+
+private:
+    int _id;
+};
+
+/**
+ * Last value written to a non-array uniform. Used to skip writes that would
+ * not change the uniform.
+ */
+class UniformValue {
+public:
+    /**
+     * Stores the value if it differs from the last stored one.
+     *
+     * @return true if value was stored, false if it is equal to the last one
+     */
+    template <class T>
+    bool update(const T &value) {
+        static_assert(sizeof(T) <= sizeof(_value), "Uniform value too large");
+        static_assert(std::is_trivially_copyable<T>::value, "Uniform value not trivially copyable");
+        auto bytes = static_cast<const void *>(&value);
+        if (_hasValue && std::memcmp(_value.data(), bytes, sizeof(T)) == 0) {
+            return false;
+        }
+        std::memcpy(_value.data(), bytes, sizeof(T));
+        _hasValue = true;
+        return true;
+    }
+
+    /**
+     * Forgets the last stored value, so that the next update is not skipped.
+     */
+    void invalidate() {
+        _hasValue = false;
+    }
+
+private:
+    bool _hasValue {false};
+    std::array<float, 16> _value {}; // large enough for any non-array uniform
+};
+
 class ShaderProgram : boost::noncopyable {
 public:
-    ShaderProgram(std::vector<std::shared_ptr<Shader>> shaders) :
-        _shaders(std::move(shaders)) {
+    ShaderProgram(std::vector<std::shared_ptr<Shader>> shaders, ProgramBinaryCache *binaryCache = nullptr) :
+        _shaders(std::move(shaders)),
+        _binaryCache(binaryCache) {
     }
 
     ~ShaderProgram() { deinit(); }
@@ -38,6 +95,17 @@ public:
 
     void bindUniformBlock(const std::string &name, int bindingPoint);
 
+    // Writes of a value equal to the last written one are skipped
+
+    void setUniform(const UniformHandle &handle, int value);
+    void setUniform(const UniformHandle &handle, float value);
+    void setUniform(const UniformHandle &handle, const glm::vec2 &v);
+    void setUniform(const UniformHandle &handle, const glm::vec3 &v);
+    void setUniform(const UniformHandle &handle, const glm::vec4 &v);
+    void setUniform(const UniformHandle &handle, const glm::mat4 &m);
+    void setUniform(const UniformHandle &handle, const std::vector<glm::vec4> &arr);
+    void setUniform(const UniformHandle &handle, const std::vector<glm::mat4> &arr);
+
     void setUniform(const std::string &name, int value);
     void setUniform(const std::string &name, float value);
     void setUniform(const std::string &name, const glm::vec2 &v);
@@ -49,16 +117,51 @@ public:
     void setUniform(const std::string &name, const std::function<void(int)> &setter);
 
 private:
+    static constexpr int kUnresolvedUniform = -2;
+    static constexpr int kMissingUniform = -1;
+
+    struct Uniform {
+        int location {-1};
+        UniformValue value;
+    };
+
     std::vector<std::shared_ptr<Shader>> _shaders;
+    ProgramBinaryCache *_binaryCache;
 
     bool _inited {false};
 
+    std::vector<Uniform> _uniforms;
+    std::unordered_map<std::string, int> _uniformIdxByName;
+    std::vector<int> _uniformIdxByHandle;
+
     // OpenGL
 
     uint32_t _nameGL {0};
-    std::map<std::string, int> _uniformLocations;
 
     // END OpenGL
+
+    bool initFromBinaryCache(const std::string &key);
+    void saveToBinaryCache(const std::string &key);
+
+    void reflectUniforms();
+
+    int getUniformIndex(const UniformHandle &handle);
+    int getUniformIndex(const std::string &name) const;
+
+    template <class T, class Setter>
+    void setUniformValue(int index, const T &value, Setter setter) {
+        if (index < 0) {
+            return;
+        }
+        auto &uniform = _uniforms[index];
+        if (!uniform.value.update(value)) {
+            return;
+        }
+        setter(uniform.location);
+        R_TRACE_COUNT(UniformUpdates, 1);
+    }
+
+    void setUniformArray(int index, const std::function<void(int)> &setter);
 };
 
 } // namespace graphics
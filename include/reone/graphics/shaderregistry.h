@@ -38,6 +38,7 @@ struct ShaderProgramId {
     static constexpr char pbrSSR[] = "pbr_ssr";
     static constexpr char pbrWalkmesh[] = "pbr_walkmesh";
     static constexpr char dirLightShadows[] = "dir_light_shadows";
+    static constexpr char guiQuads[] = "gui_quads";
     static constexpr char mvpColor[] = "mvp_color";
     static constexpr char mvpTexture[] = "mvp_texture";
     static constexpr char ndcTexture[] = "ndc_texture";
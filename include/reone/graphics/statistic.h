@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "reone/system/tracer.h"
+
 namespace reone {
 
 namespace graphics {
@@ -38,6 +40,7 @@ public:
 
     void incrementDrawCalls() override {
         ++_numDrawCalls;
+        R_TRACE_COUNT(DrawCalls, 1);
     }
 
     int numDrawCalls() const override {
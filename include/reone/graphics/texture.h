@@ -33,7 +33,7 @@ enum class TextureType {
     CubeMapArray
 };
 
-class Texture : public IAttachment, boost::noncopyable {
+class Texture : public IAttachment, public std::enable_shared_from_this<Texture>, boost::noncopyable {
 public:
     enum class Filtering {
         Nearest,
@@ -38,6 +38,7 @@ constexpr int kMaxDanglyVertices = 768;
 constexpr int kMaxLights = 32;
 constexpr int kMaxParticles = 64;
 constexpr int kMaxTextChars = 128;
+constexpr int kMaxGUIQuads = 128;
 constexpr int kMaxGrassClusters = 256;
 constexpr int kMaxWalkmeshMaterials = 32;
 
@@ -35,6 +35,7 @@ struct UniformBlockBindingPoints {
     static constexpr int walkmesh = 7;
     static constexpr int text = 8;
     static constexpr int screenEffect = 9;
+    static constexpr int guiQuads = 10;
 };
 
 struct UniformsFeatureFlags {
@@ -179,6 +180,17 @@ struct TextUniforms {
     TextUniformsCharacter chars[kMaxTextChars];
 };
 
+struct alignas(16) GUIQuadUniformsQuad {
+    glm::vec4 posScale {0.0f};
+    glm::vec4 color {1.0f};
+    glm::vec4 uvX {1.0f, 0.0f, 0.0f, 0.0f}; /**< first row of UV transform */
+    glm::vec4 uvY {0.0f, 1.0f, 0.0f, 0.0f}; /**< second row of UV transform */
+};
+
+struct GUIQuadUniforms {
+    GUIQuadUniformsQuad quads[kMaxGUIQuads];
+};
+
 struct WalkmeshUniforms {
     glm::vec4 materials[kMaxWalkmeshMaterials] {glm::vec4(1.0f)};
 };
@@ -216,6 +228,7 @@ public:
     virtual void setWalkmesh(const std::function<void(WalkmeshUniforms &)> &block) = 0;
     virtual void setText(const std::function<void(TextUniforms &)> &block) = 0;
     virtual void setScreenEffect(const std::function<void(ScreenEffectUniforms &)> &block) = 0;
+    virtual void setGUIQuads(const std::function<void(GUIQuadUniforms &)> &block) = 0;
 };
 
 class Uniforms : public IUniforms, boost::noncopyable {
@@ -238,6 +251,7 @@ public:
     void setWalkmesh(const std::function<void(WalkmeshUniforms &)> &block) override;
     void setText(const std::function<void(TextUniforms &)> &block) override;
     void setScreenEffect(const std::function<void(ScreenEffectUniforms &)> &block) override;
+    void setGUIQuads(const std::function<void(GUIQuadUniforms &)> &block) override;
 
 private:
     bool _inited {false};
@@ -255,6 +269,7 @@ private:
     WalkmeshUniforms _walkmesh;
     TextUniforms _text;
     ScreenEffectUniforms _screenEffect;
+    GUIQuadUniforms _guiQuads;
 
     // END Uniforms
 
@@ -269,6 +284,7 @@ private:
     std::shared_ptr<UniformBuffer> _ubWalkmesh;
     std::shared_ptr<UniformBuffer> _ubText;
     std::shared_ptr<UniformBuffer> _ubScreenEffect;
+    std::shared_ptr<UniformBuffer> _ubGUIQuads;
 
     // END Uniform Buffers
 
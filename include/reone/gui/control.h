@@ -44,13 +44,13 @@ class Texture;
 
 namespace scene {
 
-class IRenderPass;
 class ISceneGraphs;
 
 } // namespace scene
 
 namespace gui {
 
+class DrawList;
 class IGUI;
 
 class Control : boost::noncopyable {
@@ -108,7 +108,7 @@ public:
 
     virtual void load(const resource::generated::GUI_BASECONTROL &gui, bool protoItem = false);
     virtual void update(float dt);
-    virtual void render(const glm::ivec2 &screenSize, const glm::ivec2 &offset, scene::IRenderPass &pass);
+    virtual void render(const glm::ivec2 &screenSize, const glm::ivec2 &offset, DrawList &drawList);
 
     void updateTransform();
     void updateTextLines();
@@ -163,16 +163,19 @@ public:
 
     void setTextLines(std::vector<std::string> lines) {
         _textLines = std::move(lines);
+        invalidate();
     }
 
     // Childen
 
     void addChildToFront(Control &child) {
         _children.insert(_children.begin(), child);
+        invalidate();
     }
 
     void addChildToBack(Control &child) {
         _children.push_back(child);
+        invalidate();
     }
 
     std::vector<std::reference_wrapper<Control>> &children() {
@@ -250,12 +253,20 @@ protected:
     void renderBorder(const Border &border,
                       const glm::ivec2 &offset,
                       const glm::ivec2 &size,
-                      scene::IRenderPass &pass);
+                      DrawList &drawList);
 
     void renderText(const std::vector<std::string> &lines,
                     const glm::ivec2 &offset,
                     const glm::ivec2 &size,
-                    scene::IRenderPass &pass);
+                    DrawList &drawList);
+
+    static glm::ivec4 getTextBounds(graphics::Font &font, const std::vector<std::string> &lines, const glm::ivec2 &position);
+
+    /**
+     * Requests that draw list of the owning GUI be rebuilt. Must be called
+     * whenever state affecting how this control is rendered changes.
+     */
+    void invalidate();
 
     virtual const glm::vec3 &getBorderColor() const;
 
@@ -265,6 +276,8 @@ private:
     void loadText(const resource::generated::GUI_TEXT &gui);
     void loadHilight(const resource::generated::GUI_BORDER &gui);
 
+    void renderScene(const glm::ivec2 &screenSize, const glm::ivec2 &position);
+
     void getTextPosition(glm::ivec2 &position, int lineCount, const glm::ivec2 &size, graphics::TextGravity &gravity) const;
 };
 
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/graphics/types.h"
+
+namespace reone {
+
+namespace graphics {
+
+class Texture;
+
+}
+
+namespace gui {
+
+/**
+ * Retained list of GUI draw commands.
+ *
+ * Textured quads are merged into batches by texture and blend mode. A quad
+ * may join a batch that was started earlier only if none of the commands
+ * recorded since then intersect it, so that replaying the list produces the
+ * same image as drawing everything in submission order.
+ */
+class DrawList : boost::noncopyable {
+public:
+    struct Quad {
+        glm::ivec2 position {0};
+        glm::ivec2 size {0};
+        glm::vec4 color {1.0f};
+        glm::mat3x4 uv {1.0f};
+    };
+
+    struct Command {
+        std::shared_ptr<graphics::Texture> texture; /**< null for custom commands */
+        graphics::BlendMode blendMode {graphics::BlendMode::Normal};
+        std::vector<Quad> quads;
+        std::function<void()> custom;
+        glm::ivec4 bounds {0}; /**< left, top, right, bottom */
+    };
+
+    void clear();
+
+    void addQuad(std::shared_ptr<graphics::Texture> texture,
+                 const glm::ivec2 &position,
+                 const glm::ivec2 &size,
+                 glm::vec4 color = glm::vec4(1.0f),
+                 glm::mat3x4 uv = glm::mat3x4(1.0f),
+                 graphics::BlendMode blendMode = graphics::BlendMode::Normal);
+
+    /**
+     * Adds a command that is executed as is when the list is replayed, e.g.
+     * text or an embedded 3D scene. Quads are never reordered across custom
+     * commands whose bounds they intersect.
+     */
+    void addCustom(const glm::ivec4 &bounds, std::function<void()> func);
+
+    const std::vector<Command> &commands() const { return _commands; }
+
+    int numQuads() const { return _numQuads; }
+
+private:
+    std::vector<Command> _commands;
+    int _numQuads {0};
+};
+
+} // namespace gui
+
+} // namespace reone
@@ -24,6 +24,7 @@
 #include "reone/resource/parser/gff/gui.h"
 
 #include "control.h"
+#include "drawlist.h"
 
 namespace reone {
 
@@ -64,6 +65,12 @@ public:
 
     virtual void clearSelection() = 0;
 
+    /**
+     * Marks draw list of this GUI as outdated. Called by controls whenever
+     * their visual state changes.
+     */
+    virtual void invalidateDrawList() = 0;
+
     virtual Control &rootControl() = 0;
 
     virtual const glm::ivec2 &rootOffset() const = 0;
@@ -108,6 +115,10 @@ public:
 
     void clearSelection() override;
 
+    void invalidateDrawList() override {
+        _drawListDirty = true;
+    }
+
     Control &rootControl() override {
         return *_rootControl;
     }
@@ -144,6 +155,7 @@ public:
 
     void setBackground(std::shared_ptr<graphics::Texture> texture) override {
         _background = texture;
+        _drawListDirty = true;
     }
 
     std::unique_ptr<Control> newControl(ControlType type, std::string tag) override;
@@ -169,6 +181,9 @@ private:
     std::unordered_map<std::string, ScalingMode> _scalingByControlTag;
     bool _leftMouseDown {false};
 
+    DrawList _drawList;
+    bool _drawListDirty {true};
+
     // Controls
 
     std::vector<std::shared_ptr<Control>> _controls;
@@ -213,7 +228,8 @@ private:
     void stretchControl(Control &control);
     void updateSelection(int x, int y);
 
-    void renderBackground(scene::IRenderPass &pass);
+    void rebuildDrawList();
+    void renderDrawList();
 
     std::optional<std::reference_wrapper<Control>> findControlAt(int x, int y,
                                                                  const std::function<bool(const Control &)> &test) const;
@@ -31,6 +31,27 @@ public:
         std::vector<std::string> values;
     };
 
+    /**
+     * Handle to a resolved column. Obtain once via TwoDA::column and reuse
+     * to skip lookup of columns by name on hot paths.
+     */
+    class ColumnRef {
+    public:
+        ColumnRef() = default;
+
+        bool isValid() const { return _index != -1; }
+        int index() const { return _index; }
+
+    private:
+        int _index {-1};
+
+        explicit ColumnRef(int index) :
+            _index(index) {
+        }
+
+        friend class TwoDA;
+    };
+
     class Builder {
     public:
         Builder &columns(std::vector<std::string> columns) {
@@ -62,6 +83,17 @@ public:
                 throw ValidationException(str(boost::format("Expected %d columns in 2DA row %d, was %d") % numColumns % row % numValues));
             }
         }
+        for (size_t i = 0; i < numColumns; ++i) {
+            _columnIndices.insert(std::make_pair(_columns[i], static_cast<int>(i)));
+        }
+        _columnCaches = std::make_unique<ColumnCache[]>(numColumns);
+    }
+
+    /**
+     * @return handle to the column, invalid when not found
+     */
+    ColumnRef column(const std::string &name) const {
+        return ColumnRef(getColumnIndex(name));
     }
 
     /**
@@ -69,6 +101,11 @@ public:
      */
     int indexByCellValue(const std::string &column, const std::string &value) const;
 
+    /**
+     * @return row index or -1 when not found
+     */
+    int indexByCellValue(ColumnRef column, const std::string &value) const;
+
     /**
      * @return row index or -1 when not found
      */
@@ -89,6 +126,18 @@ public:
     std::optional<float> getFloatOpt(int row, const std::string &column) const;
     std::optional<bool> getBoolOpt(int row, const std::string &column) const;
 
+    std::string getString(int row, ColumnRef column, std::string defValue = "") const;
+    int getInt(int row, ColumnRef column, int defValue = 0) const;
+    uint32_t getHexInt(int row, ColumnRef column, uint32_t defValue = 0) const;
+    float getFloat(int row, ColumnRef column, float defValue = 0.0f) const;
+    bool getBool(int row, ColumnRef column, bool defValue = false) const;
+
+    std::optional<std::string> getStringOpt(int row, ColumnRef column) const;
+    std::optional<int> getIntOpt(int row, ColumnRef column) const;
+    std::optional<uint32_t> getHexIntOpt(int row, ColumnRef column) const;
+    std::optional<float> getFloatOpt(int row, ColumnRef column) const;
+    std::optional<bool> getBoolOpt(int row, ColumnRef column) const;
+
     const std::vector<std::string> &columns() const { return _columns; }
     const std::vector<Row> &rows() const { return _rows; }
 
@@ -99,11 +148,44 @@ public:
     }
 
 private:
+    enum CellFlags {
+        kCellDeleted = 1,
+        kCellEmpty = 2,
+        kCellInt = 4,
+        kCellHexInt = 8,
+        kCellFloat = 16
+    };
+
+    /**
+     * Typed values of a single column, parsed on first typed access.
+     */
+    struct ColumnCache {
+        std::once_flag valuesParsed;
+        std::vector<uint8_t> flags;
+        std::vector<int> ints;
+        std::vector<uint32_t> hexInts;
+        std::vector<float> floats;
+
+        std::once_flag rowsIndexed;
+        std::unordered_map<std::string, std::vector<int>> valueToRows;
+    };
+
     std::vector<std::string> _columns;
     std::vector<Row> _rows;
 
+    std::unordered_map<std::string, int> _columnIndices;
+    std::unique_ptr<ColumnCache[]> _columnCaches;
+
     int getColumnIndex(const std::string &column) const;
     std::vector<int> getColumnIndices(const std::vector<std::string> &columns) const;
+
+    const ColumnCache &parsedColumn(int columnIdx) const;
+    const ColumnCache &indexedColumn(int columnIdx) const;
+
+    /**
+     * @return cell flags, or std::nullopt when row or column is out of range
+     */
+    std::optional<uint8_t> getCellFlags(int row, ColumnRef column) const;
 };
 
 } // namespace resource
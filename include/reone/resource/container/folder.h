@@ -20,6 +20,7 @@
 #include "reone/system/types.h"
 
 #include "../container.h"
+#include "../indexcache.h"
 #include "../types.h"
 
 namespace reone {
@@ -33,6 +34,9 @@ public:
     }
 
     void init();
+    void init(const ResourceIndex &index);
+
+    ResourceIndex index() const;
 
     // IResourceContainer
 
@@ -46,9 +50,11 @@ private:
     struct Resource {
         std::filesystem::path path;
         ResType type;
+        int directoryIdx {0};
     };
 
     std::filesystem::path _path;
+    std::vector<std::filesystem::path> _directories;
 
     std::unordered_set<ResourceId> _resourceIds;
     std::unordered_map<ResourceId, Resource> _idToResource;
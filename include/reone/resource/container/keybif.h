@@ -20,6 +20,7 @@
 #include "reone/system/stream/fileinput.h"
 
 #include "../container.h"
+#include "../indexcache.h"
 
 namespace reone {
 
@@ -34,6 +35,9 @@ public:
     }
 
     void init();
+    void init(const ResourceIndex &index);
+
+    ResourceIndex index() const;
 
     // IResourceContainer
 
@@ -52,7 +56,8 @@ private:
 
     std::filesystem::path _keyPath;
 
-    std::vector<std::unique_ptr<FileInputStream>> _bifs;
+    std::vector<std::filesystem::path> _bifPaths;
+    std::vector<std::unique_ptr<FileInputStream>> _bifs; // opened on demand when initialized from index
 
     std::unordered_set<ResourceId> _resourceIds;
     std::unordered_map<ResourceId, Resource> _idToResource;
@@ -20,6 +20,7 @@
 #include "reone/system/stream/fileinput.h"
 
 #include "../container.h"
+#include "../indexcache.h"
 
 namespace reone {
 
@@ -32,6 +33,9 @@ public:
     }
 
     void init();
+    void init(const ResourceIndex &index);
+
+    ResourceIndex index() const;
 
     // IResourceContainer
 
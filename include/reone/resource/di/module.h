@@ -18,6 +18,7 @@
 #pragma once
 
 #include "../director.h"
+#include "../indexcache.h"
 #include "../provider/2das.h"
 #include "../provider/audioclips.h"
 #include "../provider/cursors.h"
@@ -115,6 +116,10 @@ public:
         _gamePath = std::move(path);
     }
 
+    void setFixture(bool fixture) {
+        _fixture = fixture;
+    }
+
 private:
     GameID _gameId;
     std::filesystem::path _gamePath;
@@ -124,6 +129,9 @@ private:
     audio::AudioModule &_audio;
     script::ScriptModule &_script;
 
+    bool _fixture {false};
+
+    std::unique_ptr<ResourceIndexCache> _indexCache;
     std::unique_ptr<Gffs> _gffs;
     std::unique_ptr<Resources> _resources;
     std::unique_ptr<Strings> _strings;
@@ -84,6 +84,16 @@ public:
 
     std::set<std::string> moduleNames() override;
 
+    /**
+     * Restricts loaded resources to the fixture set: base game archives and
+     * module archives at fixed texture quality, without streamed audio, lip
+     * sync and the override folder. Makes benchmark input independent of
+     * user configuration and mods.
+     */
+    void setFixture(bool fixture) {
+        _fixture = fixture;
+    }
+
 private:
     GameID _gameId;
     const std::filesystem::path &_gamePath;
@@ -97,7 +107,10 @@ private:
     IResources &_resources;
     IScripts &_scripts;
 
+    bool _fixture {false};
+
     void loadGlobalResources();
+    void loadStreamedResources();
     void loadModuleResources(const std::string &name);
 };
 
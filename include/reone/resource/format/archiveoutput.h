@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/system/stream/output.h"
+#include "reone/system/types.h"
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * File output for archive writers. Buffers small writes, and copies file
+ * contents using copy_file_range or sendfile where available, so that
+ * resource data does not pass through user space.
+ */
+class ArchiveFileOutput : public IOutputStream {
+public:
+    ArchiveFileOutput(const std::filesystem::path &path, size_t bufferSize = 64 * 1024);
+    ~ArchiveFileOutput();
+
+    void writeByte(uint8_t val) override;
+    void write(const char *buf, int len) override;
+
+    /**
+     * Appends size bytes from the beginning of the file at path.
+     */
+    void copyFrom(const std::filesystem::path &path, uint64_t size);
+
+    void close();
+
+    size_t position() override {
+        return _position;
+    }
+
+private:
+#ifdef __linux__
+    int _fd {-1};
+#else
+    std::ofstream _stream;
+#endif
+    ByteBuffer _buffer;
+    size_t _bufferSize;
+    size_t _position {0};
+
+    void flush();
+    void writeDirect(const char *buf, size_t len);
+};
+
+} // namespace resource
+
+} // namespace reone
@@ -22,14 +22,25 @@
 
 #include "../gff.h"
 
+#include "gffview.h"
+
 namespace reone {
 
 namespace resource {
 
+/**
+ * Reads a GFF file into a Gff tree. The file is loaded in a single read, and
+ * labels are decoded once per file. Alternatively, the tree can be built
+ * from an initialized GffView, without copying the file.
+ */
 class GffReader : boost::noncopyable {
 public:
     GffReader(IInputStream &gff) :
-        _gff(gff) {
+        _gff(&gff) {
+    }
+
+    GffReader(std::shared_ptr<GffView> view) :
+        _view(std::move(view)) {
     }
 
     void load();
@@ -39,39 +50,14 @@ public:
     }
 
 private:
-    struct LocString {
-        int32_t strRef {-1};
-        std::string subString;
-    };
-
-    BinaryReader _gff;
+    IInputStream *_gff {nullptr};
 
-    uint32_t _structOffset {0};
-    int _structCount {0};
-    uint32_t _fieldOffset {0};
-    int _fieldCount {0};
-    uint32_t _labelOffset {0};
-    int _labelCount {0};
-    uint32_t _fieldDataOffset {0};
-    int _fieldDataCount {0};
-    uint32_t _fieldIndicesOffset {0};
-    int _fieldIncidesCount {0};
-    uint32_t _listIndicesOffset {0};
-    int _listIndicesCount {0};
+    std::shared_ptr<GffView> _view;
+    std::vector<std::string> _labels;
     std::shared_ptr<Gff> _root;
 
-    std::unique_ptr<Gff> readStruct(int idx);
-    Gff::Field readField(int idx);
-    std::string readLabel(int idx);
-    std::vector<uint32_t> readFieldIndices(uint32_t off, int count);
-    uint64_t readQWordFieldData(uint32_t off);
-    std::string readStringFieldData(uint32_t off);
-    std::string readResRefFieldData(uint32_t off);
-    LocString readCExoLocStringFieldData(uint32_t off);
-    int32_t readStrRefFieldData(uint32_t off);
-    ByteBuffer readByteBufferFieldData(uint32_t off);
-    ByteBuffer readByteBufferFieldData(uint32_t off, int size);
-    std::vector<uint32_t> readList(uint32_t off);
+    std::unique_ptr<Gff> readStruct(const GffView::Struct &strct);
+    Gff::Field readField(const GffView::Field &viewField);
 };
 
 } // namespace resource
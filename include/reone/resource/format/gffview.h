@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/system/types.h"
+
+#include "../gff.h"
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Read-only view over a binary GFF file. Exposes struct and field tables
+ * directly, without building a Gff tree, for decoders generated from
+ * schemas.
+ */
+class GffView : boost::noncopyable {
+public:
+    struct Struct {
+        uint32_t type {0};
+        uint32_t dataOrDataOffset {0};
+        uint32_t fieldCount {0};
+    };
+
+    struct Field {
+        Gff::FieldType type {Gff::FieldType::Int};
+        uint32_t labelIndex {0};
+        uint32_t dataOrDataOffset {0};
+    };
+
+    GffView(ByteBuffer bytes) :
+        _bytes(std::move(bytes)) {
+    }
+
+    void init();
+
+    /**
+     * Maps every label of this file to an index into sortedNames, or -1 if
+     * the label is not in the list.
+     *
+     * @param sortedNames names sorted in ascending order
+     */
+    std::vector<int> mapLabels(const std::vector<std::string_view> &sortedNames) const;
+
+    template <class F>
+    void forEachField(const Struct &strct, F fn) const {
+        if (strct.fieldCount == 1) {
+            fn(field(strct.dataOrDataOffset));
+            return;
+        }
+        for (uint32_t i = 0; i < strct.fieldCount; ++i) {
+            auto fieldIdx = readAt<uint32_t>(_fieldIndicesOffset + strct.dataOrDataOffset + 4ll * i);
+            fn(field(fieldIdx));
+        }
+    }
+
+    template <class F>
+    void forEachListItem(const Field &field, F fn) const {
+        if (field.type != Gff::FieldType::List) {
+            return;
+        }
+        auto count = readAt<uint32_t>(_listIndicesOffset + field.dataOrDataOffset);
+        for (uint32_t i = 0; i < count; ++i) {
+            auto structIdx = readAt<uint32_t>(_listIndicesOffset + field.dataOrDataOffset + 4ll * (i + 1));
+            fn(structAt(structIdx));
+        }
+    }
+
+    Struct root() const {
+        return structAt(0);
+    }
+
+    Struct structAt(uint32_t idx) const;
+    Field field(uint32_t idx) const;
+    std::string_view label(uint32_t idx) const;
+
+    int getInt(const Field &field) const;
+    int64_t readInt64(const Field &field) const;
+    uint32_t getUint(const Field &field) const;
+    uint64_t readUint64(const Field &field) const;
+    float getFloat(const Field &field) const;
+    double getDouble(const Field &field) const;
+    std::string getString(const Field &field) const;
+    glm::vec3 getVector(const Field &field) const;
+    glm::quat getOrientation(const Field &field) const;
+    Struct getStruct(const Field &field) const;
+    ByteBuffer getData(const Field &field) const;
+
+    int numStructs() const { return _structCount; }
+    int numFields() const { return _fieldCount; }
+    int numLabels() const { return _labelCount; }
+
+private:
+    ByteBuffer _bytes;
+
+    uint32_t _structOffset {0};
+    uint32_t _structCount {0};
+    uint32_t _fieldOffset {0};
+    uint32_t _fieldCount {0};
+    uint32_t _labelOffset {0};
+    uint32_t _labelCount {0};
+    uint32_t _fieldDataOffset {0};
+    uint32_t _fieldIndicesOffset {0};
+    uint32_t _listIndicesOffset {0};
+
+    void checkRange(int64_t offset, int64_t size) const;
+
+    template <class T>
+    T readAt(int64_t offset) const {
+        checkRange(offset, sizeof(T));
+        T value;
+        std::memcpy(&value, &_bytes[offset], sizeof(T));
+        return value;
+    }
+};
+
+} // namespace resource
+
+} // namespace reone
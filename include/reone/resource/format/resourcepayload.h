@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "reone/system/types.h"
+
+namespace reone {
+
+class IOutputStream;
+
+namespace resource {
+
+/**
+ * Source of resource data for archive writers. Data is either held in
+ * memory, read from a file, or produced by a callback, and its size is known
+ * up front so that archive tables can be computed before any data is written.
+ */
+struct ResourcePayload {
+    using WriteFunc = std::function<void(IOutputStream &)>;
+
+    uint32_t size {0};
+    ByteBuffer bytes;
+    std::filesystem::path path;
+    WriteFunc writeFunc;
+
+    /**
+     * Streams data to the output, reading files in bounded chunks.
+     *
+     * @throws std::runtime_error if fewer or more than size bytes were written
+     */
+    void writeTo(IOutputStream &out) const;
+
+    /**
+     * @throws ValidationException if data does not fit in 32-bit archive fields
+     */
+    static ResourcePayload fromBytes(ByteBuffer bytes);
+
+    /**
+     * @throws ValidationException if file does not fit in 32-bit archive fields
+     */
+    static ResourcePayload fromFile(std::filesystem::path path);
+
+    static ResourcePayload fromCallback(uint32_t size, WriteFunc func);
+};
+
+} // namespace resource
+
+} // namespace reone
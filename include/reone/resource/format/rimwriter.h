@@ -21,6 +21,8 @@
 
 #include "../types.h"
 
+#include "resourcepayload.h"
+
 namespace reone {
 
 class IOutputStream;
@@ -36,12 +38,23 @@ public:
     };
 
     void add(Resource &&res);
+    void add(std::string resRef, ResType resType, ResourcePayload payload);
 
+    /**
+     * Writes archive to a file, copying file payloads without staging them in
+     * memory.
+     */
     void save(const std::filesystem::path &path);
     void save(IOutputStream &out);
 
 private:
-    std::vector<Resource> _resources;
+    struct Entry {
+        std::string resRef;
+        ResType resType {ResType::Invalid};
+        ResourcePayload payload;
+    };
+
+    std::vector<Entry> _entries;
 };
 
 } // namespace resource
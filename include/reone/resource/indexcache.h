@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "id.h"
+
+namespace reone {
+
+namespace resource {
+
+/**
+ * Resource table of a single container, as persisted by ResourceIndexCache.
+ */
+struct ResourceIndex {
+    struct Entry {
+        ResourceId id;
+        uint32_t fileIdx {0};
+        uint32_t offset {0};
+        uint32_t size {0};
+        std::string name;
+    };
+
+    /**
+     * Files that the container was built from. Sizes and modification times
+     * of these files determine whether the index is still valid.
+     */
+    std::vector<std::filesystem::path> files;
+
+    std::vector<Entry> entries;
+};
+
+/**
+ * Persistent cache of container resource tables, keyed by container path.
+ *
+ * On disk, the cache is a flat little-endian file of fixed-size records
+ * (header, containers, files, entries) followed by a string table, so that
+ * it can be read in one go without per-container parsing.
+ */
+class ResourceIndexCache : boost::noncopyable {
+public:
+    ResourceIndexCache(std::filesystem::path path) :
+        _path(std::move(path)) {
+    }
+
+    /**
+     * Loads the cache from disk. Missing, outdated or malformed cache files are ignored.
+     */
+    void load();
+
+    /**
+     * Writes the cache to disk, if it was modified since last load or save.
+     */
+    void save();
+
+    /**
+     * @return index of a container at the specified path, if it is cached and all its files are unchanged
+     */
+    const ResourceIndex *find(const std::filesystem::path &containerPath) const;
+
+    void put(const std::filesystem::path &containerPath, ResourceIndex index);
+
+private:
+    struct FileStamp {
+        uint64_t size {0};
+        int64_t modifiedAt {0};
+
+        bool operator==(const FileStamp &rhs) const {
+            return size == rhs.size && modifiedAt == rhs.modifiedAt;
+        }
+    };
+
+    struct CachedIndex {
+        ResourceIndex index;
+        std::vector<FileStamp> stamps;
+    };
+
+    std::filesystem::path _path;
+
+    std::unordered_map<std::string, CachedIndex> _pathToIndex;
+    bool _dirty {false};
+
+    std::optional<FileStamp> stampFile(const std::filesystem::path &path) const;
+};
+
+} // namespace resource
+
+} // namespace reone
@@ -22,6 +22,7 @@ namespace reone {
 namespace resource {
 
 class Gff;
+class GffView;
 
 namespace generated {
 
@@ -301,6 +302,7 @@ struct ARE {
 };
 
 ARE parseARE(const Gff &gff);
+ARE decodeARE(const GffView &gff);
 
 } // namespace generated
 
@@ -22,6 +22,7 @@ namespace reone {
 namespace resource {
 
 class Gff;
+class GffView;
 
 namespace generated {
 
@@ -76,6 +77,7 @@ struct IFO {
 };
 
 IFO parseIFO(const Gff &gff);
+IFO decodeIFO(const GffView &gff);
 
 } // namespace generated
 
@@ -22,6 +22,7 @@ namespace reone {
 namespace resource {
 
 class Gff;
+class GffView;
 
 namespace generated {
 
@@ -42,6 +43,7 @@ struct PTH {
 };
 
 PTH parsePTH(const Gff &gff);
+PTH decodePTH(const GffView &gff);
 
 } // namespace generated
 
@@ -22,6 +22,7 @@ namespace reone {
 namespace resource {
 
 class Gff;
+class GffView;
 
 namespace generated {
 
@@ -87,6 +88,7 @@ struct UTD {
 };
 
 UTD parseUTD(const Gff &gff);
+UTD decodeUTD(const GffView &gff);
 
 } // namespace generated
 
@@ -22,6 +22,7 @@ namespace reone {
 namespace resource {
 
 class Gff;
+class GffView;
 
 namespace generated {
 
@@ -59,6 +60,7 @@ struct UTE {
 };
 
 UTE parseUTE(const Gff &gff);
+UTE decodeUTE(const GffView &gff);
 
 } // namespace generated
 
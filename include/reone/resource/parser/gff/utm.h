@@ -22,6 +22,7 @@ namespace reone {
 namespace resource {
 
 class Gff;
+class GffView;
 
 namespace generated {
 
@@ -46,6 +47,7 @@ struct UTM {
 };
 
 UTM parseUTM(const Gff &gff);
+UTM decodeUTM(const GffView &gff);
 
 } // namespace generated
 
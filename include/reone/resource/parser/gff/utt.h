@@ -22,6 +22,7 @@ namespace reone {
 namespace resource {
 
 class Gff;
+class GffView;
 
 namespace generated {
 
@@ -60,6 +61,7 @@ struct UTT {
 };
 
 UTT parseUTT(const Gff &gff);
+UTT decodeUTT(const GffView &gff);
 
 } // namespace generated
 
@@ -19,6 +19,7 @@
 
 #include "reone/system/cache.h"
 
+#include "../format/gffview.h"
 #include "../gff.h"
 #include "../id.h"
 #include "../types.h"
@@ -36,6 +37,12 @@ public:
     virtual void clear() = 0;
 
     virtual std::shared_ptr<Gff> get(const std::string &resRef, ResType type) = 0;
+
+    /**
+     * Returns a binary view over the GFF resource, for decoding straight into
+     * generated structs without building a Gff tree.
+     */
+    virtual std::shared_ptr<GffView> getView(const std::string &resRef, ResType type) = 0;
 };
 
 class Gffs : public IGffs, boost::noncopyable {
@@ -46,14 +53,17 @@ public:
 
     void clear() override {
         _cache.clear();
+        _viewCache.clear();
     }
 
     std::shared_ptr<Gff> get(const std::string &resRef, ResType type) override;
+    std::shared_ptr<GffView> getView(const std::string &resRef, ResType type) override;
 
 private:
     Resources &_resources;
 
     Cache<ResourceId, Gff> _cache;
+    Cache<ResourceId, GffView> _viewCache;
 };
 
 } // namespace resource
@@ -28,6 +28,7 @@ namespace graphics {
 
 struct GraphicsOptions;
 
+class ProgramBinaryCache;
 class ShaderRegistry;
 
 } // namespace graphics
@@ -58,11 +59,21 @@ public:
     void init();
     void deinit();
 
+    /**
+     * Sets a cache to load linked shader programs from, and to store them in.
+     * Pass nullptr to always compile shaders from source.
+     */
+    void setProgramBinaryCache(graphics::ProgramBinaryCache *cache) {
+        _programBinaryCache = cache;
+    }
+
 private:
     graphics::GraphicsOptions &_graphicsOpt;
     graphics::ShaderRegistry &_shaderRegistry;
     Resources &_resources;
 
+    graphics::ProgramBinaryCache *_programBinaryCache {nullptr};
+
     bool _inited {false};
 
     std::map<std::string, ByteBuffer> _sourceResRefToData;
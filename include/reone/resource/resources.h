@@ -21,6 +21,7 @@
 
 #include "container.h"
 #include "id.h"
+#include "indexcache.h"
 #include "resource.h"
 
 namespace reone {
@@ -79,8 +80,32 @@ public:
 
     const ResourceContainerList &containers() const { return _containers; }
 
+    /**
+     * Sets a cache to initialize KEY/BIF, ERF, RIM and folder containers from,
+     * and to store their resource tables in. Pass nullptr to disable caching.
+     */
+    void setIndexCache(ResourceIndexCache *cache) {
+        _indexCache = cache;
+    }
+
 private:
     ResourceContainerList _containers;
+    ResourceIndexCache *_indexCache {nullptr};
+
+    template <class T>
+    void initContainer(T &container, const std::filesystem::path &path) {
+        if (_indexCache) {
+            auto index = _indexCache->find(path);
+            if (index) {
+                container.init(*index);
+                return;
+            }
+        }
+        container.init();
+        if (_indexCache) {
+            _indexCache->put(path, container.index());
+        }
+    }
 };
 
 } // namespace resource
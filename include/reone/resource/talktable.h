@@ -17,10 +17,17 @@
 
 #pragma once
 
+#include "reone/system/types.h"
+
 namespace reone {
 
 namespace resource {
 
+/**
+ * Compact talk table. Text and sound ResRefs of all strings are kept in a
+ * single buffer, addressed by a table of fixed-size entries, and are only
+ * decoded into views on access.
+ */
 class TalkTable : boost::noncopyable {
 public:
     struct String {
@@ -28,6 +35,13 @@ public:
         std::string soundResRef;
     };
 
+    struct Entry {
+        uint32_t textOffset {0};
+        uint32_t textSize {0};
+        uint32_t soundResRefOffset {0};
+        uint32_t soundResRefSize {0};
+    };
+
     class Builder {
     public:
         Builder &string(std::string text, std::string soundResRef = "") {
@@ -43,15 +57,31 @@ public:
         std::vector<String> _strings;
     };
 
-    TalkTable(std::vector<String> strings) :
-        _strings(std::move(strings)) {
+    TalkTable(const std::vector<String> &strings);
+
+    TalkTable(ByteBuffer data, std::vector<Entry> entries) :
+        _data(std::move(data)),
+        _entries(std::move(entries)) {
     }
 
     int getStringCount() const;
-    const String &getString(int index) const;
+
+    /**
+     * @return text of the string at index, truncated at the first NUL character
+     * @throws std::out_of_range if index is out of range
+     */
+    std::string_view getText(int index) const;
+
+    /**
+     * @throws std::out_of_range if index is out of range
+     */
+    std::string_view getSoundResRef(int index) const;
 
 private:
-    std::vector<String> _strings;
+    ByteBuffer _data;
+    std::vector<Entry> _entries;
+
+    const Entry &getEntry(int index) const;
 };
 
 } // namespace resource
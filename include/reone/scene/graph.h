@@ -198,6 +198,8 @@ public:
     // Lighting
 
     const glm::vec3 &ambientLightColor() const { return _ambientLightColor; }
+    const std::vector<LightSceneNode *> &activeLights() const { return _activeLights; }
+    const std::vector<LightSceneNode *> &flareLights() const { return _flareLights; }
 
     void setAmbientLightColor(glm::vec3 color) override { _ambientLightColor = std::move(color); }
 
@@ -323,6 +325,11 @@ private:
 
     std::vector<LightSceneNode *> _activeLights;
 
+    // Closest lights paired with square distance to camera, reused between frames
+    std::vector<std::pair<LightSceneNode *, float>> _closestLights;
+    std::vector<std::pair<LightSceneNode *, float>> _closestShadowLights;
+    std::vector<std::pair<LightSceneNode *, float>> _closestFlareLights;
+
     // END Lighting
 
     // Shadows
@@ -356,6 +363,7 @@ private:
     void refresh();
     void refreshFromNode(SceneNode &node);
 
+    void computeClosestLights();
     void updateLighting();
     void updateShadowLight(float dt);
     void updateFlareLights();
@@ -366,8 +374,6 @@ private:
 
     void computeLightSpaceMatrices();
 
-    std::vector<LightSceneNode *> computeClosestLights(int count, const std::function<bool(const LightSceneNode &, float)> &pred) const;
-
     template <class T, class... Params>
     std::shared_ptr<T> newSceneNode(Params... params) {
         auto node = std::make_shared<T>(params..., *this, _graphicsSvc, _audioSvc, _resourceSvc);
@@ -103,6 +103,8 @@ public:
     // END Transformations
 
 protected:
+    friend class ModelSceneNode;
+
     SceneNodeType _type;
     ISceneGraph &_sceneGraph;
     graphics::GraphicsServices &_graphicsSvc;
@@ -121,6 +123,7 @@ protected:
     bool _enabled {true};
     bool _culled {false}; /**< has this node been frustum- or distance-culled? */
     bool _point {true};   /**< is this node represented by a single point?  */
+    bool _flat {false};   /**< is this node transformed by a flattened model hierarchy? */
 
     // END Flags
 
@@ -145,8 +148,9 @@ protected:
         _resourceSvc(resourceSvc) {
     }
 
-    void computeAbsoluteTransforms();
+    void computeAbsoluteTransform();
 
+    virtual void computeAbsoluteTransforms();
     virtual void onAbsoluteTransformChanged() {}
 };
 
@@ -19,6 +19,7 @@
 
 #include "reone/graphics/modelnode.h"
 #include "reone/graphics/types.h"
+#include "reone/system/random.h"
 
 #include "../grassproperties.h"
 #include "../node.h"
@@ -37,6 +38,12 @@ namespace scene {
 
 class GrassSceneNode : public SceneNode {
 public:
+    struct ClusterPlacement {
+        glm::vec3 position {0.0f};
+        glm::vec2 lightmapUV {0.0f};
+        int variant {0};
+    };
+
     GrassSceneNode(
         GrassProperties properties,
         graphics::ModelNode &aabbNode,
@@ -54,22 +61,54 @@ public:
         _aabbNode(aabbNode) {
     }
 
+    /**
+     * Computes placement of grass clusters in all grass faces of the AABB
+     * mesh. Placement depends only on the mesh, so that grass does not change
+     * as the camera moves.
+     */
     void init();
 
     void update(float dt) override;
 
     void renderLeafs(IRenderPass &pass, const std::vector<SceneNode *> &leafs) override;
 
+    /**
+     * Appends placement of grass clusters in a face of the mesh. Placement is
+     * seeded by face index only, so it does not depend on order in which
+     * faces are visited.
+     */
+    void placeClustersInFace(const graphics::Mesh &mesh, int faceIdx, std::vector<ClusterPlacement> &placements) const;
+
     int getNumClustersInFace(float area) const;
-    int getRandomGrassVariant() const;
+    int getGrassVariant(RandomGenerator &rng) const;
 
 private:
+    /**
+     * Cell of a uniform grid over the AABB mesh, in mesh space. References a
+     * range of cluster placements.
+     */
+    struct GridCell {
+        int placementsStart {0};
+        int numPlacements {0};
+    };
+
     GrassProperties _properties;
     graphics::ModelNode &_aabbNode;
 
-    std::vector<int> _grassFaces;
-    std::stack<GrassClusterSceneNode *> _clusterPool;                          /**< pre-allocated pool of clusters */
-    std::map<int, std::vector<GrassClusterSceneNode *>> _materializedClusters; /**< materialized clusters grouped by face */
+    std::vector<ClusterPlacement> _placements; /**< cluster placements grouped by grid cell */
+    std::vector<GridCell> _cells;
+    glm::vec2 _gridOrigin {0.0f};
+    glm::ivec2 _gridSize {0};
+
+    std::stack<GrassClusterSceneNode *> _clusterPool;                                    /**< pre-allocated pool of clusters */
+    std::unordered_map<int, std::vector<GrassClusterSceneNode *>> _materializedClusters; /**< materialized clusters grouped by grid cell */
+    std::optional<glm::ivec2> _cameraCell;
+    bool _hasPendingCells {false}; /**< some cells in view radius could not be materialized due to pool exhaustion */
+
+    glm::ivec2 getCellCoords(const glm::vec3 &meshSpacePos) const;
+    bool isCellInRange(const glm::ivec2 &cell, const glm::ivec2 &cameraCell) const;
+
+    void returnCellToPool(std::vector<GrassClusterSceneNode *> &clusters);
 };
 
 } // namespace scene
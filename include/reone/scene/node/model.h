@@ -166,10 +166,20 @@ private:
 
     // END Lookups
 
+    // Flattened hierarchy
+
+    std::vector<ModelNodeSceneNode *> _flatNodes; /**< model nodes in depth-first order, parents before children */
+    std::vector<int> _flatParents;                /**< index of parent in _flatNodes, -1 for this node */
+    std::vector<uint8_t> _flatDirty;
+    bool _flatTransformsDirty {false};
+
+    // END Flattened hierarchy
+
     // Animation
 
     std::deque<AnimationChannel> _animChannels;
     AnimationBlendMode _animBlendMode {AnimationBlendMode::Single};
+    bool _animated {false}; /**< does the model have any animations? */
 
     // END Animation
 
@@ -179,14 +189,23 @@ private:
 
     // END Flags
 
-    void buildNodeTree(graphics::ModelNode &node, SceneNode &parent);
+    void buildNodeTree(graphics::ModelNode &node, int parentIdx);
+
+    void computeAbsoluteTransforms() override;
+
+    // Flattened hierarchy
+
+    void setFlatLocalTransform(int idx, const glm::mat4 &transform);
+    void computeFlatTransforms();
+
+    // END Flattened hierarchy
 
     // Animation
 
     void updateAnimations(float dt);
     void updateAnimationChannel(AnimationChannel &channel, float dt);
     void computeAnimationStates(AnimationChannel &channel, float time, const graphics::ModelNode &modelNode);
-    void applyAnimationStates(const graphics::ModelNode &modelNode);
+    void applyAnimationStates();
 
     static AnimationBlendMode getAnimationBlendMode(int flags);
 
@@ -88,7 +88,7 @@ public:
 
     const std::string &name() const { return _name; }
     uint32_t length() const { return _length; }
-    const std::vector<Instruction> instructions() const { return _instructions; }
+    const std::vector<Instruction> &instructions() const { return _instructions; }
 
     const Instruction &getInstruction(uint32_t offset) const;
 
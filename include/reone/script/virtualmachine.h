@@ -34,7 +34,15 @@ class ScriptProgram;
 
 class VirtualMachine : boost::noncopyable {
 public:
+    VirtualMachine();
     VirtualMachine(std::shared_ptr<ScriptProgram> program, std::unique_ptr<ExecutionContext> context);
+    ~VirtualMachine();
+
+    /**
+     * Prepares this machine to run another program, keeping previously
+     * allocated stack capacity.
+     */
+    void reset(std::shared_ptr<ScriptProgram> program, std::unique_ptr<ExecutionContext> context);
 
     int run();
 
@@ -46,18 +54,26 @@ public:
     const Variable &getStackVariable(int index) const;
 
 private:
+    typedef void (VirtualMachine::*Handler)(const Instruction &);
+
+    /**
+     * Handler table is indexed by byte code in low 6 bits and qualifier in
+     * high 6 bits. Both fit in 6 bits for all known instruction types.
+     */
+    static constexpr int kNumHandlerSlots = 1 << 12;
+
+    typedef std::array<Handler, kNumHandlerSlots> HandlerTable;
+
     std::shared_ptr<ScriptProgram> _program;
     std::unique_ptr<ExecutionContext> _context;
-    std::unordered_map<InstructionType, std::function<void(const Instruction &)>> _handlers;
     std::vector<Variable> _stack;
     std::vector<uint32_t> _returnOffsets;
     uint32_t _nextInstruction {0};
     int _globalCount {0};
     ExecutionState _savedState;
 
-    void registerHandler(InstructionType type, std::function<void(VirtualMachine *, const Instruction &)> handler) {
-        _handlers.insert(std::make_pair(type, std::bind(handler, this, std::placeholders::_1)));
-    }
+    static const HandlerTable &handlers();
+    static int getHandlerSlot(InstructionType type);
 
     int getIntFromStack();
     float getFloatFromStack();
@@ -83,6 +99,7 @@ private:
 
     // Handlers
 
+    R_INSTR_HANDLER(NOP)
     R_INSTR_HANDLER(CPDOWNSP)
     R_INSTR_HANDLER(RSADDI)
     R_INSTR_HANDLER(RSADDF)
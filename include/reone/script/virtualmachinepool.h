@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+namespace script {
+
+struct ExecutionContext;
+
+class ScriptProgram;
+class VirtualMachine;
+
+/**
+ * Keeps idle virtual machines around, so that running a script reuses
+ * previously allocated stacks instead of allocating new ones. Nested
+ * script invocations simply take another machine from the pool.
+ */
+class VirtualMachinePool : boost::noncopyable {
+public:
+    VirtualMachinePool();
+    ~VirtualMachinePool();
+
+    int run(std::shared_ptr<ScriptProgram> program, std::unique_ptr<ExecutionContext> context);
+
+private:
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<VirtualMachine>> _idle;
+
+    std::unique_ptr<VirtualMachine> acquire();
+    void release(std::unique_ptr<VirtualMachine> machine);
+};
+
+} // namespace script
+
+} // namespace reone
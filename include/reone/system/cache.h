@@ -39,4 +39,50 @@ private:
     std::map<Key, std::shared_ptr<Value>, Comparer> _items;
 };
 
+/**
+ * Cache that holds at most a fixed number of values, evicting the least
+ * recently used one when full.
+ */
+template <class Key, class Value, class Comparer = std::less<Key>>
+class LRUCache : boost::noncopyable {
+public:
+    LRUCache(size_t capacity) :
+        _capacity(capacity) {
+    }
+
+    void clear() {
+        _items.clear();
+        _order.clear();
+    }
+
+    std::shared_ptr<Value> getOrAdd(Key key, std::function<std::shared_ptr<Value>()> valueFactory) {
+        auto it = _items.find(key);
+        if (it != _items.end()) {
+            _order.splice(_order.begin(), _order, it->second.second);
+            return it->second.first;
+        }
+        if (_capacity == 0) {
+            return valueFactory();
+        }
+        if (_items.size() >= _capacity) {
+            _items.erase(_order.back());
+            _order.pop_back();
+        }
+        auto value = valueFactory();
+        _order.push_front(key);
+        _items.insert(std::make_pair(std::move(key), std::make_pair(value, _order.begin())));
+        return value;
+    }
+
+    size_t size() const {
+        return _items.size();
+    }
+
+private:
+    size_t _capacity;
+
+    std::list<Key> _order;
+    std::map<Key, std::pair<std::shared_ptr<Value>, typename std::list<Key>::iterator>, Comparer> _items;
+};
+
 } // namespace reone
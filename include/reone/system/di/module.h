@@ -18,6 +18,7 @@
 #pragma once
 
 #include "../clock.h"
+#include "../random.h"
 #include "../threadpool.h"
 
 #include "services.h"
@@ -45,6 +46,7 @@ private:
     IClock &_clock;
 
     std::unique_ptr<ThreadPool> _threadPool;
+    std::unique_ptr<Random> _random;
 
     std::unique_ptr<SystemServices> _services;
 };
@@ -20,15 +20,18 @@
 namespace reone {
 
 class IClock;
+class IRandom;
 class IThreadPool;
 
 struct SystemServices {
     IClock &clock;
     IThreadPool &threadPool;
+    IRandom &random;
 
-    SystemServices(IClock &clock, IThreadPool &threadPool) :
+    SystemServices(IClock &clock, IThreadPool &threadPool, IRandom &random) :
         clock(clock),
-        threadPool(threadPool) {
+        threadPool(threadPool),
+        random(random) {
     }
 };
 
@@ -30,26 +30,35 @@ public:
               std::set<LogChannel> enabledChannels,
               std::optional<std::string> filename);
 
-    void append(std::string message,
+    void append(const std::string &message,
                 LogChannel channel,
                 LogSeverity severity);
 
+    bool isEnabled(LogSeverity severity, LogChannel channel) const {
+        return static_cast<int>(severity) >= _minSeverity.load(std::memory_order_relaxed) &&
+               isChannelEnabled(channel);
+    }
+
     bool isChannelEnabled(LogChannel channel) const {
-        return _enabledChannels.count(channel) > 0;
+        return (_channelMask.load(std::memory_order_relaxed) & static_cast<int>(channel)) != 0;
     }
 
 private:
-    static thread_local std::optional<std::reference_wrapper<std::ostringstream>> buffer;
+    static thread_local std::string *buffer;
 
-    LogSeverity _minSeverity {LogSeverity::Warn};
-    std::set<LogChannel> _enabledChannels;
+    std::atomic<int> _minSeverity {std::numeric_limits<int>::max()};
+    std::atomic<int> _channelMask {0};
     std::unique_ptr<std::ostream> _stream;
     bool _inited {false};
 
-    std::list<std::ostringstream> _buffers;
-
+    std::list<std::string> _buffers;
     std::mutex _buffersMutex;
-    std::mutex _streamMutex;
+
+    std::thread _writer;
+    std::queue<std::string> _writeQueue;
+    std::mutex _writeQueueMutex;
+    std::condition_variable _writeQueueCondVar;
+    bool _writerStopped {false};
 
     Logger() = default;
 
@@ -58,7 +67,8 @@ private:
     }
 
     void deinit();
-    void flush(std::ostringstream &buffer);
+    void flush(std::string &buffer);
+    void write();
 };
 
 } // namespace reone
@@ -20,6 +20,31 @@
 #include "logger.h"
 #include "types.h"
 
+/**
+ * Minimum severity of messages compiled in by logging macros. Defaults to
+ * LogSeverity::Debug.
+ */
+#ifndef R_LOG_MIN_SEVERITY
+#define R_LOG_MIN_SEVERITY 0
+#endif
+
+/**
+ * Appends a message to the log. Unlike logging functions, message expression
+ * is only evaluated when both severity and channel are enabled.
+ */
+#define R_LOG(severity, channel, message)                                 \
+    do {                                                                  \
+        if (static_cast<int>(severity) >= R_LOG_MIN_SEVERITY &&           \
+            ::reone::Logger::instance.isEnabled(severity, channel)) {     \
+            ::reone::Logger::instance.append(message, channel, severity); \
+        }                                                                 \
+    } while (false)
+
+#define R_LOG_ERROR(channel, message) R_LOG(::reone::LogSeverity::Error, channel, message)
+#define R_LOG_WARN(channel, message) R_LOG(::reone::LogSeverity::Warn, channel, message)
+#define R_LOG_INFO(channel, message) R_LOG(::reone::LogSeverity::Info, channel, message)
+#define R_LOG_DEBUG(channel, message) R_LOG(::reone::LogSeverity::Debug, channel, message)
+
 namespace reone {
 
 inline void error(const char *message, LogChannel channel = LogChannel::Global) {
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace reone {
+
+/**
+ * Independent random number streams. Each gameplay subsystem draws from its
+ * own stream, so that e.g. script dice rolls do not perturb combat rolls.
+ * Cosmetic randomness, such as particles, uses the thread-local generators
+ * from randomutil.h instead.
+ */
+enum class RandomStream {
+    Default,
+    Combat,
+    Scripts,
+
+    Count
+};
+
+/**
+ * Fast, seedable pseudorandom number generator (xoshiro128**).
+ *
+ * Not thread-safe: each thread or subsystem must use its own instance.
+ */
+class RandomGenerator {
+public:
+    RandomGenerator(uint64_t seed = 0) {
+        this->seed(seed);
+    }
+
+    void seed(uint64_t seed);
+
+    uint32_t next();
+
+    /**
+     * @param min lower bound (inclusive)
+     * @param max upper bound (inclusive)
+     */
+    int nextInt(int min, int max);
+
+    /**
+     * @param min lower bound (inclusive)
+     * @param max upper bound (exclusive)
+     */
+    float nextFloat(float min, float max);
+
+    /**
+     * Fills values with count floats uniformly distributed in [min, max).
+     */
+    void nextFloats(float *values, int count, float min, float max);
+
+private:
+    uint32_t _state[4] {0};
+};
+
+class IRandom {
+public:
+    virtual ~IRandom() = default;
+
+    virtual void seed(uint32_t seed) = 0;
+
+    virtual RandomGenerator &stream(RandomStream stream) = 0;
+};
+
+class Random : public IRandom, boost::noncopyable {
+public:
+    Random(uint32_t seed) {
+        this->seed(seed);
+    }
+
+    void seed(uint32_t seed) override;
+
+    RandomGenerator &stream(RandomStream stream) override {
+        return _streams[static_cast<int>(stream)];
+    }
+
+private:
+    std::array<RandomGenerator, static_cast<int>(RandomStream::Count)> _streams;
+};
+
+} // namespace reone
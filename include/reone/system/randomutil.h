@@ -19,6 +19,20 @@
 
 namespace reone {
 
+/**
+ * Reseeds the random number generators of all threads, making subsequent
+ * sequences reproducible. Each thread draws from its own stream, selected
+ * by thread name, so only named threads are reproducible across runs.
+ */
+void setRandomSeed(uint32_t seed);
+
+/**
+ * Selects the stream that the calling thread draws from, until the next
+ * call. Thread pool workers select a stream per task, so that values drawn
+ * by a task do not depend on which worker runs it.
+ */
+void setThreadRandomStream(uint32_t index);
+
 /**
  * @param min lower bound (inclusive)
  * @param max upper bound (inclusive)
@@ -27,8 +41,13 @@ int randomInt(int min, int max);
 
 /**
  * @param min lower bound (inclusive)
- * @param max upper bound (inclusive)
+ * @param max upper bound (exclusive)
  */
 float randomFloat(float min, float max);
 
+/**
+ * Fills values with count floats uniformly distributed in [min, max).
+ */
+void randomFloats(float *values, int count, float min, float max);
+
 } // namespace reone
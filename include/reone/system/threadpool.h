@@ -17,14 +17,17 @@
 
 #pragma once
 
+#include "randomutil.h"
+
 namespace reone {
 
 using TaskFunc = std::function<void(const std::atomic_bool &canceled)>;
 
 class Task : boost::noncopyable {
 public:
-    Task(TaskFunc func) :
-        _func(std::move(func)) {
+    Task(TaskFunc func, uint32_t index = 0) :
+        _func(std::move(func)),
+        _index(index) {
     }
 
     inline void cancel() {
@@ -33,6 +36,7 @@ public:
 
 private:
     TaskFunc _func;
+    uint32_t _index;
     std::atomic_bool _canceled {false};
 
     inline void operator()() {
@@ -69,7 +73,7 @@ public:
 
     std::shared_ptr<Task> enqueue(TaskFunc func) override {
         std::lock_guard<std::mutex> lock(_mutex);
-        auto task = std::make_shared<Task>(std::move(func));
+        auto task = std::make_shared<Task>(std::move(func), _numEnqueued++);
         _tasks.push(task);
         _condVar.notify_one();
         return task;
@@ -82,6 +86,7 @@ private:
     std::atomic_bool _running {false};
 
     std::queue<std::shared_ptr<Task>> _tasks;
+    uint32_t _numEnqueued {0};
     std::mutex _mutex;
     std::condition_variable _condVar;
 
@@ -98,6 +103,7 @@ private:
                 _tasks.pop();
             }
             if (task) {
+                setThreadRandomStream(task->_index);
                 (*task)();
             }
         }
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#define R_TRACE_CONCAT_INNER(a, b) a##b
+#define R_TRACE_CONCAT(a, b) R_TRACE_CONCAT_INNER(a, b)
+
+#define R_TRACE_ZONE(name) ::reone::TraceZone R_TRACE_CONCAT(traceZone, __LINE__) {name}
+#define R_TRACE_COUNT(counter, delta) ::reone::Tracer::instance.increment(::reone::TraceCounter::counter, delta)
+
+namespace reone {
+
+enum class TraceCounter {
+    DrawCalls,
+    TextureUploads,
+    ScriptInstructions,
+    Raycasts,
+    UniformUpdates,
+
+    kCount
+};
+
+/**
+ * Low-overhead hierarchical profiler. Records nested zones into per-thread
+ * buffers, and per-frame counters, while a capture is in progress. Captured
+ * data can be exported in Chrome trace event format.
+ */
+class Tracer : boost::noncopyable {
+public:
+    static constexpr int kMaxZonesPerThread = 1 << 16;
+
+    struct Zone {
+        const char *name {nullptr};
+        uint64_t start {0};
+        uint64_t end {0};
+        uint32_t depth {0};
+    };
+
+    struct ZoneStats {
+        std::string name;
+        int count {0};
+        uint64_t totalTime {0};
+        uint64_t maxTime {0};
+    };
+
+    static Tracer instance;
+
+    /**
+     * Starts a new capture, discarding previously captured data.
+     */
+    void start();
+
+    void stop();
+
+    /**
+     * Ends current frame: samples and resets frame counters. Must be called
+     * from a single thread.
+     */
+    void markFrame();
+
+    /**
+     * Exports captured zones and counters as Chrome trace JSON. Must not be
+     * called concurrently with start.
+     */
+    void exportChromeTrace(std::ostream &out);
+
+    /**
+     * Aggregates captured zones by name, across all threads. Must not be
+     * called concurrently with start.
+     *
+     * @return zone statistics, sorted by total time in descending order
+     */
+    std::vector<ZoneStats> zoneStats();
+
+    /**
+     * @return number of zones discarded in the current capture, because
+     *         per-thread buffers were full
+     */
+    uint32_t numDroppedZones();
+
+    bool isEnabled() const {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    uint64_t beginZone();
+    void endZone(const char *name, uint64_t start);
+
+    void increment(TraceCounter counter, int64_t delta = 1) {
+        if (!isEnabled()) {
+            return;
+        }
+        _counters[static_cast<int>(counter)].fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    /**
+     * @return value of the counter in the last completed frame
+     */
+    int64_t lastFrameValue(TraceCounter counter) const {
+        return _lastFrameCounters[static_cast<int>(counter)].load(std::memory_order_relaxed);
+    }
+
+private:
+    struct ThreadBuffer {
+        std::string name;
+        uint32_t id {0};
+        std::atomic<uint32_t> epoch {0};
+        uint32_t depth {0};
+        std::unique_ptr<Zone[]> zones;
+        std::atomic<uint32_t> numZones {0};
+        std::atomic<uint32_t> numDropped {0};
+    };
+
+    struct CounterSample {
+        uint64_t time {0};
+        std::array<int64_t, static_cast<int>(TraceCounter::kCount)> values;
+    };
+
+    static thread_local ThreadBuffer *threadBuffer;
+
+    std::atomic_bool _enabled {false};
+    std::atomic<uint32_t> _epoch {0};
+    std::atomic<int64_t> _origin {0};
+
+    std::list<ThreadBuffer> _buffers;
+    std::mutex _buffersMutex;
+
+    std::array<std::atomic<int64_t>, static_cast<int>(TraceCounter::kCount)> _counters {};
+    std::array<std::atomic<int64_t>, static_cast<int>(TraceCounter::kCount)> _lastFrameCounters {};
+    std::vector<CounterSample> _counterSamples;
+    std::mutex _counterSamplesMutex;
+
+    Tracer() = default;
+
+    uint64_t now() const;
+    ThreadBuffer &getThreadBuffer();
+};
+
+class TraceZone : boost::noncopyable {
+public:
+    TraceZone(const char *name) :
+        _name(name) {
+        if (Tracer::instance.isEnabled()) {
+            _active = true;
+            _start = Tracer::instance.beginZone();
+        }
+    }
+
+    ~TraceZone() {
+        if (_active) {
+            Tracer::instance.endZone(_name, _start);
+        }
+    }
+
+private:
+    const char *_name;
+    bool _active {false};
+    uint64_t _start {0};
+};
+
+} // namespace reone
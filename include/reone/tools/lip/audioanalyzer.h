@@ -22,17 +22,46 @@
 
 namespace reone {
 
+/**
+ * Per-window amplitude envelope of the first channel of an audio clip.
+ */
+struct AudioEnvelope {
+    float windowDuration {0.0f};
+    float duration {0.0f};
+    std::vector<float> peak;
+    std::vector<float> rms;
+
+    int windowCount() const {
+        return static_cast<int>(peak.size());
+    }
+};
+
 class AudioAnalyzer : boost::noncopyable {
 public:
+    static constexpr float kDefaultWindowDuration = 0.001f;
+
+    /**
+     * Computes peak and RMS envelopes of the clip in a single pass over its frames.
+     *
+     * Windows that contain no sample start, which happens when the sample rate
+     * is below the window rate, hold the amplitude of the preceding sample.
+     */
+    AudioEnvelope envelope(const audio::AudioClip &clip, float windowDuration = kDefaultWindowDuration);
+
     std::vector<TimeSpan> silentSpans(const audio::AudioClip &clip,
                                       float minSilenceDuration = 0.05f,
                                       float maxSilenceAmplitude = 0.01f);
 
+    std::vector<TimeSpan> silentSpans(const AudioEnvelope &envelope,
+                                      float minSilenceDuration = 0.05f,
+                                      float maxSilenceAmplitude = 0.01f);
+
     std::vector<float> waveform(const audio::AudioClip &clip, int resolution);
 
 private:
-    std::vector<TimeSpan> computeFrameSpans(const audio::AudioClip &clip);
-    float sampleNormalized(const audio::AudioClip::Frame &frame, float time);
+    std::vector<float> _samples;
+
+    void decodeFirstChannel(const audio::AudioClip::Frame &frame);
 };
 
 } // namespace reone
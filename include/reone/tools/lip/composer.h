@@ -133,6 +133,20 @@ public:
                                                     float duration,
                                                     std::vector<TimeSpan> silentSpans = std::vector<TimeSpan>());
 
+    /**
+     * Composes an animation with word groups aligned to the sounding spans of an audio envelope.
+     *
+     * @throws TextSyntaxException
+     * @throws WordGroupsSoundSpansMismatchedException
+     * @throws WordPhonemesNotFoundException
+     * @throws IllegalPhonemeException
+     */
+    std::unique_ptr<graphics::LipAnimation> compose(const std::string &name,
+                                                    const std::string &u8Text,
+                                                    const AudioEnvelope &envelope,
+                                                    float minSilenceDuration = 0.05f,
+                                                    float maxSilenceAmplitude = 0.01f);
+
 private:
     PronouncingDictionary _dict;
 
@@ -184,7 +184,8 @@ static void writeSchemaHeaderFile(const std::string &topStructName,
     writer.write("#pragma once\n\n");
     writer.write("namespace reone {\n\n");
     writer.write("namespace resource {\n\n");
-    writer.write("class Gff;\n\n");
+    writer.write("class Gff;\n");
+    writer.write("class GffView;\n\n");
     writer.write("namespace generated {\n\n");
     for (auto &[_, schemaStruct] : structs) {
         writeStruct(*schemaStruct, writer);
@@ -192,6 +193,7 @@ static void writeSchemaHeaderFile(const std::string &topStructName,
     for (auto &[_, schemaStruct] : structs) {
         if (schemaStruct->top) {
             writer.write(str(boost::format("%1% parse%1%(const Gff &gff);\n") % topStructName));
+            writer.write(str(boost::format("%1% decode%1%(const GffView &gff);\n") % topStructName));
         }
     }
     writer.write("\n");
@@ -270,6 +272,116 @@ static void writeParseFunction(const SchemaStruct &schemaStruct, TextWriter &wri
     writer.write("}\n\n");
 }
 
+static std::string describeDecodeExpr(const SchemaField &field) {
+    switch (field.type) {
+    case Gff::FieldType::Byte:
+    case Gff::FieldType::Word:
+    case Gff::FieldType::Dword:
+        return "gff.getUint(field)";
+    case Gff::FieldType::Char:
+    case Gff::FieldType::Short:
+    case Gff::FieldType::Int:
+    case Gff::FieldType::StrRef:
+        return "gff.getInt(field)";
+    case Gff::FieldType::Dword64:
+        return "gff.readUint64(field)";
+    case Gff::FieldType::Int64:
+        return "gff.readInt64(field)";
+    case Gff::FieldType::Float:
+        return "gff.getFloat(field)";
+    case Gff::FieldType::Double:
+        return "gff.getDouble(field)";
+    case Gff::FieldType::CExoString:
+    case Gff::FieldType::ResRef:
+        return "gff.getString(field)";
+    case Gff::FieldType::CExoLocString:
+        return "std::make_pair(gff.getInt(field), gff.getString(field))";
+    case Gff::FieldType::Void:
+        return "gff.getData(field)";
+    case Gff::FieldType::Orientation:
+        return "gff.getOrientation(field)";
+    case Gff::FieldType::Vector:
+        return "gff.getVector(field)";
+    default:
+        throw std::logic_error("Invalid field type: " + std::to_string(static_cast<int>(field.type)));
+    }
+}
+
+static void writeDecodeFunction(const SchemaStruct &schemaStruct,
+                                const std::string &slotsName,
+                                TextWriter &writer) {
+    writer.write(str(boost::format("static %1% decode%1%(const GffView &gff, const GffView::Struct &gffStruct, const %2% &slots) {\n") % schemaStruct.name % slotsName));
+    writer.write(str(boost::format("%s%s strct;\n") % kIndent % schemaStruct.name));
+    writer.write(str(boost::format("%sgff.forEachField(gffStruct, [&](const GffView::Field &field) {\n") % kIndent));
+    writer.write(str(boost::format("%1%%1%switch (slots.%2%[field.labelIndex]) {\n") % kIndent % schemaStruct.name));
+    int slot = 0;
+    for (auto &[_, field] : schemaStruct.fields) {
+        int fieldSlot = slot++;
+        if (field.type == Gff::FieldType::List && !field.subStruct) {
+            continue;
+        }
+        writer.write(str(boost::format("%1%%1%case %2%:\n") % kIndent % fieldSlot));
+        switch (field.type) {
+        case Gff::FieldType::Struct:
+            writer.write(str(boost::format("%1%%1%%1%if (field.type == Gff::FieldType::Struct) {\n") % kIndent));
+            writer.write(str(boost::format("%1%%1%%1%%1%strct.%2% = decode%3%(gff, gff.getStruct(field), slots);\n") % kIndent % field.cppName % field.subStruct->name));
+            writer.write(str(boost::format("%1%%1%%1%}\n") % kIndent));
+            break;
+        case Gff::FieldType::List:
+            writer.write(str(boost::format("%1%%1%%1%gff.forEachListItem(field, [&](const GffView::Struct &item) {\n") % kIndent));
+            writer.write(str(boost::format("%1%%1%%1%%1%strct.%2%.push_back(decode%3%(gff, item, slots));\n") % kIndent % field.cppName % field.subStruct->name));
+            writer.write(str(boost::format("%1%%1%%1%});\n") % kIndent));
+            break;
+        default:
+            writer.write(str(boost::format("%1%%1%%1%strct.%2% = %3%;\n") % kIndent % field.cppName % describeDecodeExpr(field)));
+            break;
+        }
+        writer.write(str(boost::format("%1%%1%%1%break;\n") % kIndent));
+    }
+    writer.write(str(boost::format("%1%%1%default:\n") % kIndent));
+    writer.write(str(boost::format("%1%%1%%1%break;\n") % kIndent));
+    writer.write(str(boost::format("%1%%1%}\n") % kIndent));
+    writer.write(str(boost::format("%s});\n") % kIndent));
+    writer.write(str(boost::format("%sreturn strct;\n") % kIndent));
+    writer.write("}\n\n");
+}
+
+static void writeDecoders(const std::vector<std::pair<int, SchemaStruct *>> &structs, TextWriter &writer) {
+    const SchemaStruct *topStruct = nullptr;
+    for (auto &[_, schemaStruct] : structs) {
+        if (schemaStruct->top) {
+            topStruct = schemaStruct;
+        }
+    }
+    if (!topStruct) {
+        return;
+    }
+    auto slotsName = topStruct->name + "LabelSlots";
+
+    // Label index to field slot, one table per struct, built once per file
+    writer.write(str(boost::format("struct %s {\n") % slotsName));
+    for (auto &[_, schemaStruct] : structs) {
+        writer.write(str(boost::format("%sstd::vector<int> %s;\n") % kIndent % schemaStruct->name));
+    }
+    writer.write("};\n\n");
+
+    for (auto &[_, schemaStruct] : structs) {
+        writeDecodeFunction(*schemaStruct, slotsName, writer);
+    }
+
+    writer.write(str(boost::format("%1% decode%1%(const GffView &gff) {\n") % topStruct->name));
+    writer.write(str(boost::format("%s%s slots;\n") % kIndent % slotsName));
+    for (auto &[_, schemaStruct] : structs) {
+        std::vector<std::string> labels;
+        for (auto &[_, field] : schemaStruct->fields) {
+            labels.push_back("\"" + field.name + "\"");
+        }
+        writer.write(str(boost::format("%sslots.%s = gff.mapLabels({%s});\n") % kIndent % schemaStruct->name % boost::join(labels, ", ")));
+    }
+    writer.write(str(boost::format("%1%return decode%2%(gff, gff.root(), slots);\n") % kIndent % topStruct->name));
+    writer.write("}\n\n");
+}
+
 static void writeSchemaImplFile(const std::vector<std::pair<int, SchemaStruct *>> &structs,
                                 const std::string &schemaHeaderFilename,
                                 const std::filesystem::path &path) {
@@ -278,6 +390,7 @@ static void writeSchemaImplFile(const std::vector<std::pair<int, SchemaStruct *>
     writer.write(kCopyrightNotice);
     writer.write("\n\n");
     writer.write(str(boost::format(kIncludeFormat + "\n\n") % schemaHeaderFilename));
+    writer.write(str(boost::format(kIncludeFormat + "\n") % "reone/resource/format/gffview.h"));
     writer.write(str(boost::format(kIncludeFormat + "\n\n") % "reone/resource/gff.h"));
     writer.write("namespace reone {\n\n");
     writer.write("namespace resource {\n\n");
@@ -285,6 +398,7 @@ static void writeSchemaImplFile(const std::vector<std::pair<int, SchemaStruct *>
     for (auto &[_, schemaStruct] : structs) {
         writeParseFunction(*schemaStruct, writer);
     }
+    writeDecoders(structs, writer);
     writer.write("} // namespace generated\n\n");
     writer.write("} // namespace resource\n\n");
     writer.write("} // namespace reone\n");
@@ -22,6 +22,10 @@
 #include "reone/graphics/window.h"
 #include "reone/resource/exception/notfound.h"
 #include "reone/resource/gameprobe.h"
+#include "reone/system/logutil.h"
+#include "reone/system/random.h"
+#include "reone/system/randomutil.h"
+#include "reone/system/tracer.h"
 
 using namespace reone::audio;
 using namespace reone::game;
@@ -35,6 +39,7 @@ using namespace reone::script;
 namespace reone {
 
 static const std::string kMainThreadName {"main"};
+static constexpr char kBenchmarkTraceFilename[] = "benchmark.json";
 
 static constexpr int kProfilerInputTimeIndex = 0;
 static constexpr int kProfilerUpdateTimeIndex = 1;
@@ -42,11 +47,18 @@ static constexpr int kProfilerRenderGraphicsTimeIndex = 2;
 static constexpr int kProfilerRenderAudioTimeIndex = 3;
 
 void Engine::init() {
-    if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_TIMER) != 0) {
-        throw std::runtime_error("SDL_Init failed: " + std::string(SDL_GetError()));
+    // Benchmark mode runs without window, GL context and audio device
+    bool headless = _options.benchmark.enabled();
+    if (headless) {
+        _options.graphics.headless = true;
+        _options.audio.headless = true;
+    } else {
+        if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_TIMER) != 0) {
+            throw std::runtime_error("SDL_Init failed: " + std::string(SDL_GetError()));
+        }
+        _window = std::make_unique<Window>(_options.graphics);
+        _window->init();
     }
-    _window = std::make_unique<Window>(_options.graphics);
-    _window->init();
 
     _optionsView = _options.toView();
     GameProbe probe {_options.game.path};
@@ -68,6 +80,7 @@ void Engine::init() {
         *_graphicsModule,
         *_audioModule,
         *_scriptModule);
+    _resourceModule->setFixture(headless);
     _sceneModule = std::make_unique<SceneModule>(
         _options.graphics,
         *_resourceModule,
@@ -159,6 +172,10 @@ void Engine::deinit() {
 }
 
 int Engine::run() {
+    if (_options.benchmark.enabled()) {
+        return runBenchmark();
+    }
+
     auto &clock = _services->system.clock;
     _ticks = clock.millis();
 
@@ -220,7 +237,57 @@ int Engine::run() {
         _profiler->measure(kMainThreadName, kProfilerRenderAudioTimeIndex, [this]() {
             _services->audio.mixer.render();
         });
+        Tracer::instance.markFrame();
+    }
+
+    return 0;
+}
+
+int Engine::runBenchmark() {
+    auto &benchmark = _options.benchmark;
+    auto &clock = _services->system.clock;
+
+    setRandomSeed(benchmark.seed);
+    _services->system.random.seed(benchmark.seed);
+    _game->stopVideo();
+    _game->loadModule(benchmark.module);
+
+    Tracer::instance.start();
+    uint64_t startTicks = clock.micros();
+    for (int i = 0; i < benchmark.frames; ++i) {
+        {
+            R_TRACE_ZONE("Engine::simulateFrame");
+            _game->update(benchmark.frameTime);
+        }
+        Tracer::instance.markFrame();
     }
+    uint64_t totalTime = clock.micros() - startTicks;
+    Tracer::instance.stop();
+
+    auto report = std::ostringstream();
+    report << boost::format("Simulated %d frames of module '%s' in %.3f ms (seed %u)\n") %
+                  benchmark.frames %
+                  benchmark.module %
+                  (totalTime / 1000.0) %
+                  benchmark.seed;
+    report << boost::format("%-36s %8s %12s %10s %10s\n") % "zone" % "count" % "total ms" % "mean ms" % "max ms";
+    for (auto &stats : Tracer::instance.zoneStats()) {
+        report << boost::format("%-36s %8d %12.3f %10.4f %10.4f\n") %
+                      stats.name %
+                      stats.count %
+                      (stats.totalTime / 1000.0) %
+                      (stats.totalTime / 1000.0 / stats.count) %
+                      (stats.maxTime / 1000.0);
+    }
+    uint32_t numDroppedZones = Tracer::instance.numDroppedZones();
+    if (numDroppedZones > 0) {
+        report << boost::format("Zone statistics are incomplete: %d zones dropped, consider fewer frames\n") % numDroppedZones;
+    }
+    std::cout << report.str();
+    info(report.str());
+
+    auto trace = std::ofstream(kBenchmarkTraceFilename);
+    Tracer::instance.exportChromeTrace(trace);
 
     return 0;
 }
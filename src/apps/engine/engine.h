@@ -92,6 +92,8 @@ private:
 
     void processEvents(bool &quit);
 
+    int runBenchmark();
+
     void showCursor(bool show);
     void setRelativeMouseMode(bool relative);
 
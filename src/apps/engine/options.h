@@ -30,11 +30,23 @@ struct Options {
         std::set<LogChannel> channels {LogChannel::Global};
     };
 
+    struct Benchmark {
+        std::string module;
+        int frames {0};
+        float frameTime {1.0f / 60.0f};
+        uint32_t seed {0};
+
+        bool enabled() const {
+            return !module.empty() && frames > 0;
+        }
+    };
+
     game::GameOptions game;
     graphics::GraphicsOptions graphics;
     audio::AudioOptions audio;
 
     Logging logging;
+    Benchmark benchmark;
 
     std::unique_ptr<game::OptionsView> toView() {
         return std::make_unique<game::OptionsView>(game, graphics, audio);
@@ -62,7 +62,11 @@ std::unique_ptr<Options> OptionsParser::parse() {
         ("soundvol", value<int>()->default_value(options->audio.soundVolume), "sound volume in percents")                       //
         ("movievol", value<int>()->default_value(options->audio.movieVolume), "movie volume in percents")                       //
         ("logsev", value<int>()->default_value(static_cast<int>(options->logging.severity)), "minimum log severity")            //
-        ("logch", value<int>()->default_value(defaultLogChannels), "log channel mask");
+        ("logch", value<int>()->default_value(defaultLogChannels), "log channel mask")                                          //
+        ("benchmodule", value<std::string>(), "module to simulate in headless benchmark mode")                                  //
+        ("benchframes", value<int>()->default_value(options->benchmark.frames), "number of frames to simulate")                 //
+        ("benchdt", value<float>()->default_value(options->benchmark.frameTime), "simulated frame time in seconds")             //
+        ("seed", value<uint32_t>()->default_value(options->benchmark.seed), "random seed for benchmark mode");
 
     options_description descCmdLine {"Usage"};
     descCmdLine.add(descCommon);
@@ -100,6 +104,10 @@ std::unique_ptr<Options> OptionsParser::parse() {
     options->audio.soundVolume = vars["soundvol"].as<int>();
     options->audio.movieVolume = vars["movievol"].as<int>();
     options->logging.severity = static_cast<LogSeverity>(vars["logsev"].as<int>());
+    options->benchmark.module = vars.count("benchmodule") > 0 ? vars["benchmodule"].as<std::string>() : "";
+    options->benchmark.frames = vars["benchframes"].as<int>();
+    options->benchmark.frameTime = vars["benchdt"].as<float>();
+    options->benchmark.seed = vars["seed"].as<uint32_t>();
 
     std::set<LogChannel> logChannels;
     int logChannelsMask = vars["logch"].as<int>();
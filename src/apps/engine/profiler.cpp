@@ -30,7 +30,9 @@
 #include "reone/system/checkutil.h"
 #include "reone/system/clock.h"
 #include "reone/system/di/services.h"
+#include "reone/system/logutil.h"
 #include "reone/system/stringbuilder.h"
+#include "reone/system/tracer.h"
 
 using namespace reone::game;
 using namespace reone::graphics;
@@ -42,6 +44,14 @@ static constexpr float kTextOffset = 3.0f;
 static constexpr int kNumTimedFrames = 100;
 static constexpr float kFrameTimesScale = 2.0f;
 
+static const UniformHandle kSeriesColorsUniform("uSeriesColors");
+static const UniformHandle kSeriesValuesUniforms[] {
+    UniformHandle("uSeriesValues1"),
+    UniformHandle("uSeriesValues2"),
+    UniformHandle("uSeriesValues3"),
+    UniformHandle("uSeriesValues4")};
+static constexpr char kTraceFilename[] = "trace.json";
+
 void Profiler::init() {
     checkThat(!_inited, "Must not be initialized");
     _font = _resourceSvc.fonts.get(kFontResRef);
@@ -65,6 +75,10 @@ bool Profiler::handle(const input::Event &event) {
         _enabled.store(!enabled, std::memory_order::memory_order_release);
         return true;
     }
+    if (event.key.code == input::KeyCode::F6) {
+        toggleTraceCapture();
+        return true;
+    }
     if (!enabled) {
         return false;
     }
@@ -141,7 +155,7 @@ void Profiler::renderFrameTimes(const TimedThread &thread, int xOffset) {
         }
         seriesColors[i] = glm::vec4 {thread.colors[i], 1.0f};
     }
-    program.setUniform("uSeriesColors", seriesColors);
+    program.setUniform(kSeriesColorsUniform, seriesColors);
 
     std::vector<glm::vec4> vecTimes;
     vecTimes.resize(kNumTimedFrames / 4, glm::vec4 {0.0f});
@@ -159,7 +173,7 @@ void Profiler::renderFrameTimes(const TimedThread &thread, int xOffset) {
         } else {
             std::memset(&vecTimes[0], 0, vecTimes.size() * sizeof(glm::vec4));
         }
-        program.setUniform("uSeriesValues" + std::to_string(slot + 1), vecTimes);
+        program.setUniform(kSeriesValuesUniforms[slot], vecTimes);
     }
 
     float size = kNumTimedFrames * kFrameTimesScale;
@@ -189,6 +203,13 @@ void Profiler::renderFrameTimes(const TimedThread &thread, int xOffset) {
 
 void Profiler::renderStatistic(int xOffset) {
     auto text = str(boost::format("%d draw calls") % _graphicsSvc.statistic.numDrawCalls());
+    if (Tracer::instance.isEnabled()) {
+        text += str(boost::format(", %d texture uploads, %d uniform updates, %d script instructions, %d raycasts [capturing]") %
+                    Tracer::instance.lastFrameValue(TraceCounter::TextureUploads) %
+                    Tracer::instance.lastFrameValue(TraceCounter::UniformUpdates) %
+                    Tracer::instance.lastFrameValue(TraceCounter::ScriptInstructions) %
+                    Tracer::instance.lastFrameValue(TraceCounter::Raycasts));
+    }
     _font->render(
         text,
         glm::vec3 {kTextOffset + xOffset, kTextOffset, 0.0f},
@@ -196,6 +217,20 @@ void Profiler::renderStatistic(int xOffset) {
         TextGravity::RightBottom);
 }
 
+void Profiler::toggleTraceCapture() {
+    if (!Tracer::instance.isEnabled()) {
+        Tracer::instance.start();
+        info("Trace capture started");
+        return;
+    }
+    Tracer::instance.stop();
+    auto tracePath = std::filesystem::current_path();
+    tracePath.append(kTraceFilename);
+    auto trace = std::ofstream(tracePath);
+    Tracer::instance.exportChromeTrace(trace);
+    info("Trace capture saved to " + tracePath.string());
+}
+
 void Profiler::reserveThread(std::string name, std::vector<glm::vec3> colors) {
     if (_nameToTimedThread.count(name) > 0) {
         return;
@@ -98,6 +98,8 @@ private:
     void renderBackground();
     void renderFrameTimes(const TimedThread &thread, int xOffset);
     void renderStatistic(int xOffset);
+
+    void toggleTraceCapture();
 };
 
 } // namespace reone
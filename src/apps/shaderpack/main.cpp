@@ -16,12 +16,106 @@
  */
 
 #include "reone/resource/format/erfwriter.h"
-#include "reone/system/stream/fileinput.h"
-#include "reone/system/stream/fileoutput.h"
 
 using namespace reone;
 using namespace reone::resource;
 
+static const std::regex kIncludeRegex("^#include \"([\\d\\w_]+)\\.glsl\"$");
+static const std::regex kConditionalStartRegex("^\\s*#\\s*if(n?def)?\\b.*");
+static const std::regex kConditionalEndRegex("^\\s*#\\s*endif\\b.*");
+static const std::regex kMainRegex("\\bvoid\\s+main\\s*\\(");
+
+static std::string readFile(const std::filesystem::path &path) {
+    auto stream = std::ifstream(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+}
+
+static std::string stripComments(const std::string &source) {
+    static const std::regex commentRegex("//[^\\n]*|/\\*[\\s\\S]*?\\*/");
+    return std::regex_replace(source, commentRegex, " ");
+}
+
+static bool isEntryShader(const std::string &name) {
+    return boost::starts_with(name, "v_") || boost::starts_with(name, "g_") || boost::starts_with(name, "f_");
+}
+
+/**
+ * Checks shader sources for errors that would otherwise only surface when
+ * shaders are compiled at runtime: unresolved or circular includes,
+ * unbalanced preprocessor conditionals and braces, and missing entry points.
+ */
+static std::vector<std::string> validateShaders(const std::map<std::string, std::string> &sources) {
+    std::vector<std::string> errors;
+    std::map<std::string, std::vector<std::string>> includes;
+
+    for (auto &[name, source] : sources) {
+        auto stripped = stripComments(source);
+        auto stream = std::istringstream(stripped);
+        std::string line;
+        int lineNumber = 0;
+        int conditionalDepth = 0;
+        while (std::getline(stream, line)) {
+            ++lineNumber;
+            boost::trim_right(line);
+            std::smatch match;
+            if (std::regex_search(line, match, kIncludeRegex)) {
+                auto included = match[1].str();
+                if (sources.count(included) == 0) {
+                    errors.push_back(str(boost::format("%s.glsl:%d: included shader not found: %s.glsl") % name % lineNumber % included));
+                }
+                includes[name].push_back(included);
+            } else if (boost::starts_with(line, "#version")) {
+                errors.push_back(str(boost::format("%s.glsl:%d: #version is prepended at runtime and must not be declared") % name % lineNumber));
+            } else if (std::regex_match(line, kConditionalStartRegex)) {
+                ++conditionalDepth;
+            } else if (std::regex_match(line, kConditionalEndRegex)) {
+                if (--conditionalDepth < 0) {
+                    errors.push_back(str(boost::format("%s.glsl:%d: #endif without matching #if") % name % lineNumber));
+                    conditionalDepth = 0;
+                }
+            }
+        }
+        if (conditionalDepth > 0) {
+            errors.push_back(str(boost::format("%s.glsl: %d unterminated #if block(s)") % name % conditionalDepth));
+        }
+        auto numOpen = std::count(stripped.begin(), stripped.end(), '{');
+        auto numClose = std::count(stripped.begin(), stripped.end(), '}');
+        if (numOpen != numClose) {
+            errors.push_back(str(boost::format("%s.glsl: unbalanced braces: %d opening, %d closing") % name % numOpen % numClose));
+        }
+        if (isEntryShader(name) && !std::regex_search(stripped, kMainRegex)) {
+            errors.push_back(str(boost::format("%s.glsl: entry shader has no main function") % name));
+        }
+    }
+
+    // Detect circular includes
+    std::map<std::string, int> state; // 1 - visiting, 2 - visited
+    std::function<bool(const std::string &)> visit = [&](const std::string &name) {
+        auto &nameState = state[name];
+        if (nameState == 1) {
+            return false;
+        }
+        if (nameState == 2) {
+            return true;
+        }
+        nameState = 1;
+        for (auto &included : includes[name]) {
+            if (!visit(included)) {
+                errors.push_back(str(boost::format("%s.glsl: circular include of %s.glsl") % name % included));
+                state[name] = 2;
+                return true;
+            }
+        }
+        state[name] = 2;
+        return true;
+    };
+    for (auto &[name, _] : sources) {
+        visit(name);
+    }
+
+    return errors;
+}
+
 int main(int argc, char **argv) {
     try {
         boost::program_options::options_description description;
@@ -52,8 +146,8 @@ int main(int argc, char **argv) {
             throw std::runtime_error("Destination directory does not exist: " + destdir.string());
         }
 
-        auto writer = ErfWriter();
-
+        std::map<std::string, std::filesystem::path> paths;
+        std::map<std::string, std::string> sources;
         for (auto &entry : std::filesystem::directory_iterator(srcdir)) {
             if (!std::filesystem::is_regular_file(entry.status())) {
                 continue;
@@ -61,29 +155,28 @@ int main(int argc, char **argv) {
             if (entry.path().extension() != ".glsl") {
                 continue;
             }
-            auto glslStream = FileInputStream(entry.path());
-            glslStream.seek(0, SeekOrigin::End);
-            auto filesize = glslStream.position();
-            glslStream.seek(0, SeekOrigin::Begin);
-            auto glslBytes = ByteBuffer();
-            glslBytes.resize(filesize);
-            glslStream.read(&glslBytes[0], filesize);
-
             auto resRef = entry.path().filename();
             resRef.replace_extension();
+            paths[resRef.string()] = entry.path();
+            sources[resRef.string()] = readFile(entry.path());
+        }
+
+        auto errors = validateShaders(sources);
+        if (!errors.empty()) {
+            for (auto &error : errors) {
+                std::cerr << error << std::endl;
+            }
+            return -1;
+        }
 
-            ErfWriter::Resource resource;
-            resource.resRef = resRef.string();
-            resource.resType = ResType::Glsl;
-            resource.data = std::move(glslBytes);
-            writer.add(std::move(resource));
+        auto writer = ErfWriter();
+        for (auto &[resRef, path] : paths) {
+            writer.add(resRef, ResType::Glsl, ResourcePayload::fromFile(path));
         }
 
         auto erfPath = destdir;
         erfPath.append("shaderpack.erf");
-
-        auto erfStream = FileOutputStream(erfPath);
-        writer.save(ErfWriter::FileType::ERF, erfStream);
+        writer.save(ErfWriter::FileType::ERF, erfPath);
 
         return 0;
 
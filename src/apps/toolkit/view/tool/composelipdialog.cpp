@@ -171,7 +171,10 @@ void ComposeLipDialog::analyzeAudio() {
     float minSilenceDuration = m_minSilenceDurationSlider->GetValue() / 1000.0f;
     float maxSilenceAmplitude = m_maxSilenceAmplitudeSlider->GetValue() / 1000.0f;
     AudioAnalyzer audioAnalyzer;
-    m_silentSpans = audioAnalyzer.silentSpans(*m_sound, minSilenceDuration, maxSilenceAmplitude);
+    if (m_soundEnvelope.windowCount() == 0) {
+        m_soundEnvelope = audioAnalyzer.envelope(*m_sound);
+    }
+    m_silentSpans = audioAnalyzer.silentSpans(m_soundEnvelope, minSilenceDuration, maxSilenceAmplitude);
     int w, h;
     m_soundWaveformPanel->GetClientSize(&w, &h);
     m_soundWaveform = audioAnalyzer.waveform(*m_sound, w);
@@ -251,6 +254,7 @@ void ComposeLipDialog::OnSoundLoadCommand(wxCommandEvent &evt) {
         m_sound.reset();
         return;
     }
+    m_soundEnvelope = AudioEnvelope();
 
     analyzeAudio();
 
@@ -261,6 +265,7 @@ void ComposeLipDialog::OnSoundLoadCommand(wxCommandEvent &evt) {
 
 void ComposeLipDialog::OnSoundResetCommand(wxCommandEvent &evt) {
     m_sound.reset();
+    m_soundEnvelope = AudioEnvelope();
     m_silentSpans.clear();
     m_soundWaveform.clear();
     m_soundWaveformPanel->Refresh();
@@ -56,6 +56,7 @@ private:
     float m_soundDuration {1.0f};
 
     std::shared_ptr<audio::AudioClip> m_sound;
+    AudioEnvelope m_soundEnvelope;
     std::vector<TimeSpan> m_silentSpans;
     std::vector<float> m_soundWaveform;
 
@@ -207,11 +207,10 @@ void ResourceExplorerViewModel::openResource(const ResourceId &id, IInputStream
 
         auto rows = std::vector<std::vector<std::string>>();
         for (int i = 0; i < tlk->getStringCount(); ++i) {
-            auto &str = tlk->getString(i);
-            auto cleanedText = boost::replace_all_copy(str.text, "\n", "\\n");
+            auto cleanedText = boost::replace_all_copy(std::string(tlk->getText(i)), "\n", "\\n");
             auto values = std::vector<std::string>();
             values.push_back(cleanedText);
-            values.push_back(str.soundResRef);
+            values.push_back(std::string(tlk->getSoundResRef(i)));
             rows.push_back(std::move(values));
         }
 
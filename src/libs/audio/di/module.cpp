@@ -25,7 +25,9 @@ void AudioModule::init() {
     _context = std::make_unique<Context>();
     _mixer = std::make_unique<AudioMixer>(_options);
 
-    _context->init();
+    if (!_options.headless) {
+        _context->init();
+    }
 
     _services = std::make_unique<AudioServices>(*_context, *_mixer);
 }
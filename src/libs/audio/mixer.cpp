@@ -43,6 +43,9 @@ std::shared_ptr<AudioSource> AudioMixer::play(std::shared_ptr<AudioClip> clip,
         gainByType(type, gain),
         loop,
         std::move(position));
+    if (_options.headless) {
+        return source;
+    }
     source->init();
     source->play();
     _sources.push_back(source);
@@ -17,12 +17,12 @@
 
 #include "reone/game/action/docommand.h"
 
+#include "reone/game/game.h"
+#include "reone/game/object.h"
+#include "reone/game/script/runner.h"
 #include "reone/script/executioncontext.h"
+#include "reone/script/executionstate.h"
 #include "reone/script/program.h"
-#include "reone/script/virtualmachine.h"
-
-
-#include "reone/game/object.h"
 
 using namespace reone::script;
 
@@ -35,7 +35,7 @@ void DoCommandAction::execute(std::shared_ptr<Action> self, Object &actor, float
     executionCtx->callerId = actor.id();
 
     std::shared_ptr<ScriptProgram> program(_actionToDo->savedState->program);
-    VirtualMachine(program, std::move(executionCtx)).run();
+    _game.scriptRunner().run(program, std::move(executionCtx));
     complete();
 }
 
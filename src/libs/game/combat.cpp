@@ -23,7 +23,8 @@
 #include "reone/scene/di/services.h"
 #include "reone/scene/graphs.h"
 #include "reone/system/logutil.h"
-#include "reone/system/randomutil.h"
+#include "reone/system/di/services.h"
+#include "reone/system/random.h"
 
 using namespace reone::graphics;
 using namespace reone::scene;
@@ -77,7 +78,7 @@ void Combat::addAttack(std::shared_ptr<Creature> attacker,
             if (!round.attack2 && !isRoundPastFirstAttack(round.time)) {
                 round.attack2 = makeAttack(attacker, target, action, resultType, damage);
                 round.duel = true;
-                debug(str(boost::format("Append attack: %s -> %s") % attacker->tag() % target->tag()), LogChannel::Combat);
+                R_LOG_DEBUG(LogChannel::Combat, str(boost::format("Append attack: %s -> %s") % attacker->tag() % target->tag()));
             }
             return;
         }
@@ -87,7 +88,7 @@ void Combat::addAttack(std::shared_ptr<Creature> attacker,
     auto round = std::make_unique<Round>();
     round->attack1 = makeAttack(attacker, target, action, resultType, damage);
     _roundByAttacker.insert(std::make_pair(attacker->id(), std::move(round)));
-    debug(str(boost::format("Start round: %s -> %s") % attacker->tag() % target->tag()), LogChannel::Combat);
+    R_LOG_DEBUG(LogChannel::Combat, str(boost::format("Start round: %s -> %s") % attacker->tag() % target->tag()));
 }
 
 void Combat::update(float dt) {
@@ -210,7 +211,7 @@ void Combat::finishRound(Round &round) {
         finishAttack(*round.attack2);
     }
     round.state = RoundState::Finished;
-    debug(str(boost::format("Finish round: %s -> %s") % round.attack1->attacker->tag() % round.attack1->target->tag()), LogChannel::Combat);
+    R_LOG_DEBUG(LogChannel::Combat, str(boost::format("Finish round: %s -> %s") % round.attack1->attacker->tag() % round.attack1->target->tag()));
 }
 
 static bool isAttackSuccessful(AttackResultType result) {
@@ -236,7 +237,7 @@ AttackResultType Combat::determineAttackResult(const Attack &attack, bool offHan
     }
 
     // Attack roll
-    int roll = randomInt(1, 20);
+    int roll = _services.system.random.stream(RandomStream::Combat).nextInt(1, 20);
     if (roll == 20) {
         result = AttackResultType::AutomaticHit;
     } else if (roll > 1 && roll + attack.attacker->getAttackBonus(offHand) >= defense) { // 1 is automatic miss
@@ -254,7 +255,7 @@ AttackResultType Combat::determineAttackResult(const Attack &attack, bool offHan
         }
         if (roll > 20 - criticalThreat) {
             // Critical hit roll
-            int criticalRoll = randomInt(1, 20);
+            int criticalRoll = _services.system.random.stream(RandomStream::Combat).nextInt(1, 20);
             if (criticalRoll + attack.attacker->getAttackBonus() >= defense) {
                 result = AttackResultType::CriticalHit;
             }
@@ -305,18 +306,18 @@ Combat::AttackAnimation Combat::determineAttackAnimation(const Attack &attack, b
     if (duel) {
         if (isMeleeWieldType(result.attackerWieldType) && isMeleeWieldType(targetWield)) {
             result.attackerAnimation = CombatAnimation::CinematicMeleeAttack;
-            result.animationVariant = randomInt(1, 5);
+            result.animationVariant = _services.system.random.stream(RandomStream::Combat).nextInt(1, 5);
             result.targetAnimation = isAttackSuccessful(attack.resultType) ? CombatAnimation::CinematicMeleeDamage : CombatAnimation::CinematicMeleeParry;
         } else if (isMeleeWieldType(result.attackerWieldType)) {
             result.attackerAnimation = CombatAnimation::MeleeAttack;
-            result.animationVariant = randomInt(1, 2);
+            result.animationVariant = _services.system.random.stream(RandomStream::Combat).nextInt(1, 2);
             result.targetAnimation = isAttackSuccessful(attack.resultType) ? CombatAnimation::MeleeDamage : CombatAnimation::MeleeDodge;
         } else if (isRangedWieldType(result.attackerWieldType)) {
             result.attackerAnimation = CombatAnimation::BlasterAttack;
             result.targetAnimation = isAttackSuccessful(attack.resultType) ? CombatAnimation::Damage : CombatAnimation::Dodge;
         } else {
             result.attackerAnimation = CombatAnimation::Attack;
-            result.animationVariant = randomInt(1, 2);
+            result.animationVariant = _services.system.random.stream(RandomStream::Combat).nextInt(1, 2);
             result.targetAnimation = isAttackSuccessful(attack.resultType) ? CombatAnimation::Damage : CombatAnimation::Dodge;
         }
     } else {
@@ -324,7 +325,7 @@ Combat::AttackAnimation Combat::determineAttackAnimation(const Attack &attack, b
             result.attackerAnimation = CombatAnimation::BlasterAttack;
         } else {
             result.attackerAnimation = CombatAnimation::Attack;
-            result.animationVariant = randomInt(1, 2);
+            result.animationVariant = _services.system.random.stream(RandomStream::Combat).nextInt(1, 2);
         }
     }
 
@@ -345,11 +346,11 @@ void Combat::applyAttackResult(const Attack &attack, bool offHand) {
     case AttackResultType::AttackFailed:
     case AttackResultType::Parried:
     case AttackResultType::Deflected:
-        debug(str(boost::format("Attack missed: %s -> %s") % attack.attacker->tag() % attack.target->tag()), LogChannel::Combat);
+        R_LOG_DEBUG(LogChannel::Combat, str(boost::format("Attack missed: %s -> %s") % attack.attacker->tag() % attack.target->tag()));
         break;
     case AttackResultType::HitSuccessful:
     case AttackResultType::AutomaticHit: {
-        debug(str(boost::format("Attack hit: %s -> %s") % attack.attacker->tag() % attack.target->tag()), LogChannel::Combat);
+        R_LOG_DEBUG(LogChannel::Combat, str(boost::format("Attack hit: %s -> %s") % attack.attacker->tag() % attack.target->tag()));
         if (attack.damage == -1) {
             auto effects = getDamageEffects(attack.attacker, offHand);
             for (auto &effect : effects) {
@@ -366,7 +367,7 @@ void Combat::applyAttackResult(const Attack &attack, bool offHand) {
         break;
     }
     case AttackResultType::CriticalHit: {
-        debug(str(boost::format("Attack critical hit: %s -> %s") % attack.attacker->tag() % attack.target->tag()), LogChannel::Combat);
+        R_LOG_DEBUG(LogChannel::Combat, str(boost::format("Attack critical hit: %s -> %s") % attack.attacker->tag() % attack.target->tag()));
         if (attack.damage == -1) {
             auto effects = getDamageEffects(attack.attacker, offHand, criticalHitMultiplier);
             for (auto &effect : effects) {
@@ -390,7 +391,7 @@ std::vector<std::shared_ptr<DamageEffect>> Combat::getDamageEffects(std::shared_
 
     if (weapon) {
         for (int i = 0; i < weapon->numDice(); ++i) {
-            amount += randomInt(1, weapon->dieToRoll());
+            amount += _services.system.random.stream(RandomStream::Combat).nextInt(1, weapon->dieToRoll());
         }
         type = static_cast<DamageType>(weapon->damageFlags());
     }
@@ -35,15 +35,23 @@ void Feats::init() {
         return;
     }
 
+    auto nameColumn = feats->column("name");
+    auto descriptionColumn = feats->column("description");
+    auto iconColumn = feats->column("icon");
+    auto minCharLevelColumn = feats->column("mincharlevel");
+    auto preReqFeat1Column = feats->column("prereqfeat1");
+    auto preReqFeat2Column = feats->column("prereqfeat2");
+    auto successorColumn = feats->column("successor");
+    auto pipsColumn = feats->column("pips");
     for (int row = 0; row < feats->getRowCount(); ++row) {
-        std::string name(_strings.getText(feats->getInt(row, "name", -1)));
-        std::string description(_strings.getText(feats->getInt(row, "description", -1)));
-        std::shared_ptr<Texture> icon(_textures.get(feats->getString(row, "icon"), TextureUsage::GUI));
-        uint32_t minCharLevel = feats->getHexInt(row, "mincharlevel");
-        auto preReqFeat1 = static_cast<FeatType>(feats->getHexInt(row, "prereqfeat1"));
-        auto preReqFeat2 = static_cast<FeatType>(feats->getHexInt(row, "prereqfeat2"));
-        auto successor = static_cast<FeatType>(feats->getHexInt(row, "successor"));
-        uint32_t pips = feats->getHexInt(row, "pips");
+        std::string name(_strings.getText(feats->getInt(row, nameColumn, -1)));
+        std::string description(_strings.getText(feats->getInt(row, descriptionColumn, -1)));
+        std::shared_ptr<Texture> icon(_textures.get(feats->getString(row, iconColumn), TextureUsage::GUI));
+        uint32_t minCharLevel = feats->getHexInt(row, minCharLevelColumn);
+        auto preReqFeat1 = static_cast<FeatType>(feats->getHexInt(row, preReqFeat1Column));
+        auto preReqFeat2 = static_cast<FeatType>(feats->getHexInt(row, preReqFeat2Column));
+        auto successor = static_cast<FeatType>(feats->getHexInt(row, successorColumn));
+        uint32_t pips = feats->getHexInt(row, pipsColumn);
 
         auto feat = std::make_shared<Feat>();
         feat->name = std::move(name);
@@ -35,10 +35,13 @@ void Skills::init() {
         return;
     }
 
+    auto nameColumn = skills->column("name");
+    auto descriptionColumn = skills->column("description");
+    auto iconColumn = skills->column("icon");
     for (int row = 0; row < skills->getRowCount(); ++row) {
-        std::string name(_strings.getText(skills->getInt(row, "name", -1)));
-        std::string description(_strings.getText(skills->getInt(row, "description", -1)));
-        std::shared_ptr<Texture> icon(_textures.get(skills->getString(row, "icon"), TextureUsage::GUI));
+        std::string name(_strings.getText(skills->getInt(row, nameColumn, -1)));
+        std::string description(_strings.getText(skills->getInt(row, descriptionColumn, -1)));
+        std::shared_ptr<Texture> icon(_textures.get(skills->getString(row, iconColumn), TextureUsage::GUI));
 
         auto skill = std::make_shared<Skill>();
         skill->name = std::move(name);
@@ -34,11 +34,15 @@ void Spells::init() {
     if (!spells)
         return;
 
+    auto nameColumn = spells->column("name");
+    auto descriptionColumn = spells->column("spelldesc");
+    auto iconColumn = spells->column("iconresref");
+    auto pipsColumn = spells->column("pips");
     for (int row = 0; row < spells->getRowCount(); ++row) {
-        std::string name(_strings.getText(spells->getInt(row, "name", -1)));
-        std::string description(_strings.getText(spells->getInt(row, "spelldesc", -1)));
-        std::shared_ptr<Texture> icon(_textures.get(spells->getString(row, "iconresref"), TextureUsage::GUI));
-        uint32_t pips = spells->getHexInt(row, "pips");
+        std::string name(_strings.getText(spells->getInt(row, nameColumn, -1)));
+        std::string description(_strings.getText(spells->getInt(row, descriptionColumn, -1)));
+        std::shared_ptr<Texture> icon(_textures.get(spells->getString(row, iconColumn), TextureUsage::GUI));
+        uint32_t pips = spells->getHexInt(row, pipsColumn);
 
         auto spell = std::make_shared<Spell>();
         spell->name = std::move(name);
@@ -30,6 +30,7 @@
 #include "reone/graphics/context.h"
 #include "reone/graphics/di/services.h"
 #include "reone/graphics/format/tgawriter.h"
+#include "reone/graphics/glutil.h"
 #include "reone/graphics/meshregistry.h"
 #include "reone/graphics/renderbuffer.h"
 #include "reone/graphics/shaderregistry.h"
@@ -67,6 +68,7 @@
 #include "reone/system/fileutil.h"
 #include "reone/system/logutil.h"
 #include "reone/system/threadutil.h"
+#include "reone/system/tracer.h"
 
 using namespace reone::audio;
 using namespace reone::graphics;
@@ -184,6 +186,8 @@ bool Game::handle(const input::Event &event) {
 }
 
 void Game::update(float frameTime) {
+    R_TRACE_ZONE("Game::update");
+
     float dt = frameTime * _gameSpeed;
     if (_movie) {
         updateMovie(dt);
@@ -210,6 +214,10 @@ void Game::update(float frameTime) {
 }
 
 void Game::render() {
+    if (isHeadless()) {
+        // Nothing to render into without a GL context, e.g. in benchmark mode
+        return;
+    }
     if (_movie) {
         _movie->render();
     } else {
@@ -391,6 +399,14 @@ void Game::playVideo(const std::string &name) {
     }
 }
 
+void Game::stopVideo() {
+    if (!_movie) {
+        return;
+    }
+    _movie->finish();
+    _movie.reset();
+}
+
 void Game::playMusic(const std::string &resRef) {
     if (_musicResRef == resRef) {
         return;
@@ -19,6 +19,7 @@
 
 #include "reone/game/game.h"
 #include "reone/graphics/format/tgareader.h"
+#include "reone/graphics/textureutil.h"
 #include "reone/resource/container/erf.h"
 #include "reone/resource/format/erfreader.h"
 #include "reone/resource/format/gffreader.h"
@@ -38,6 +39,9 @@ namespace reone {
 namespace game {
 
 static const char kSavesDirectoryName[] = "saves";
+static const char kCacheFileName[] = "savecache.bin";
+
+static constexpr int kMaxScreenshotSize = 256;
 
 static constexpr int kStrRefLoadGame = 1585;
 static constexpr int kStrRefSave = 1587;
@@ -141,66 +145,160 @@ static std::filesystem::path getSavesPath() {
     return savesPath;
 }
 
+static SavedGameInfo peekSavedGame(const std::filesystem::path &path) {
+    auto erfResourceContainer = ErfResourceContainer(path);
+
+    auto nfoData = erfResourceContainer.findResourceData(ResourceId("savenfo", ResType::Res));
+    auto nfoStream = MemoryInputStream(*nfoData);
+    GffReader nfo(nfoStream);
+    nfo.load();
+
+    SavedGameInfo result;
+    result.lastModule = nfo.root()->getString("LastModule");
+
+    auto screenData = erfResourceContainer.findResourceData(ResourceId("screen", ResType::Tga));
+    if (screenData) {
+        auto tga = MemoryInputStream(*screenData);
+        TgaReader tgaReader(tga, "screen", TextureUsage::GUI);
+        tgaReader.load();
+        auto screen = tgaReader.texture();
+        if (screen && screen->type() == TextureType::TwoDim) {
+            result.screenWidth = screen->width();
+            result.screenHeight = screen->height();
+            result.screenFormat = screen->pixelFormat();
+            result.screenPixels = std::move(*screen->layers().front().pixels);
+            downscaleScreenshot(result, kMaxScreenshotSize);
+        }
+    }
+
+    return result;
+}
+
 void SaveLoad::refreshSavedGames() {
+    cancelIndexing();
     _saves.clear();
 
     std::filesystem::path savesPath(getSavesPath());
     if (!std::filesystem::exists(savesPath)) {
         std::filesystem::create_directory(savesPath);
     }
+    if (!_cache) {
+        _cache = std::make_shared<SavedGameCache>(savesPath / kCacheFileName);
+        _cache->load();
+    }
+
+    // Saved games with up-to-date cache entries are added immediately, the
+    // rest are indexed by the thread pool and added as they become ready
+    auto queue = std::make_shared<IndexingQueue>();
     for (auto &entry : std::filesystem::directory_iterator(savesPath)) {
-        if (std::filesystem::is_regular_file(entry) && boost::to_lower_copy(entry.path().extension().string()) == ".sav") {
-            indexSavedGame(entry);
+        if (!std::filesystem::is_regular_file(entry) || boost::to_lower_copy(entry.path().extension().string()) != ".sav") {
+            continue;
+        }
+        IndexedSavedGame indexed;
+        indexed.path = entry.path();
+        try {
+            std::filesystem::path basename(indexed.path.filename());
+            basename.replace_extension();
+            indexed.number = stoi(basename.string());
+        } catch (const std::exception &e) {
+            warn("Error indexing a saved game: " + std::string(e.what()));
+            continue;
+        }
+        auto cached = _cache->find(indexed.path);
+        if (cached) {
+            indexed.info = std::move(*cached);
+            addSavedGame(std::move(indexed));
+            continue;
         }
+        ++queue->numPending;
+        auto task = _services.system.threadPool.enqueue([queue, cache = _cache, indexed = std::move(indexed)](const std::atomic_bool &canceled) mutable {
+            bool success = false;
+            if (!canceled) {
+                try {
+                    indexed.info = peekSavedGame(indexed.path);
+                    cache->put(indexed.path, indexed.info);
+                    success = true;
+                } catch (const std::exception &e) {
+                    warn("Error indexing a saved game: " + std::string(e.what()));
+                }
+            }
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            if (success) {
+                queue->indexed.push_back(std::move(indexed));
+            }
+            --queue->numPending;
+        });
+        _indexingTasks.push_back(std::move(task));
     }
-
-    _controls.LB_GAMES->clearItems();
-    for (size_t i = 0; i < _saves.size(); ++i) {
-        std::string name(str(boost::format("%06d") % _saves[i].number));
-        ListBox::Item item;
-        item.tag = name;
-        item.text = name;
-        _controls.LB_GAMES->addItem(std::move(item));
+    if (queue->numPending > 0) {
+        _indexingQueue = std::move(queue);
+    } else {
+        _cache->save();
     }
-}
 
-static SavedGame peekSavedGame(const std::filesystem::path &path) {
-    auto erfResourceContainer = ErfResourceContainer(path);
+    refreshSavedGameItems();
+}
 
-    auto nfoData = erfResourceContainer.findResourceData(ResourceId("savenfo", ResType::Res));
-    auto nfoStream = MemoryInputStream(*nfoData);
-    GffReader nfo(nfoStream);
-    nfo.load();
+void SaveLoad::cancelIndexing() {
+    for (auto &task : _indexingTasks) {
+        task->cancel();
+    }
+    _indexingTasks.clear();
+    _indexingQueue.reset();
+}
 
-    std::shared_ptr<Texture> screen;
-    auto screenData = erfResourceContainer.findResourceData(ResourceId("screen", ResType::Tga));
-    if (screenData) {
-        auto tga = MemoryInputStream(*screenData);
-        TgaReader tgaReader(tga, "screen", TextureUsage::GUI);
-        tgaReader.load();
-        screen = tgaReader.texture();
+void SaveLoad::update(float dt) {
+    GameGUI::update(dt);
+    if (_indexingQueue) {
+        mergeIndexedSavedGames();
     }
+}
 
-    SavedGame result;
-    result.screen = std::move(screen);
-    result.lastModule = nfo.root()->getString("LastModule");
+void SaveLoad::mergeIndexedSavedGames() {
+    std::vector<IndexedSavedGame> indexed;
+    int numPending;
+    {
+        std::lock_guard<std::mutex> lock(_indexingQueue->mutex);
+        indexed.swap(_indexingQueue->indexed);
+        numPending = _indexingQueue->numPending;
+    }
+    for (auto &save : indexed) {
+        addSavedGame(std::move(save));
+    }
+    if (!indexed.empty()) {
+        refreshSavedGameItems();
+    }
+    if (numPending == 0) {
+        _indexingTasks.clear();
+        _indexingQueue.reset();
+        _cache->save();
+    }
+}
 
-    return result;
+void SaveLoad::addSavedGame(IndexedSavedGame indexed) {
+    SavedGameDescriptor descriptor;
+    descriptor.number = indexed.number;
+    descriptor.save.lastModule = std::move(indexed.info.lastModule);
+    if (!indexed.info.screenPixels.empty()) {
+        auto screen = std::make_shared<Texture>("screen", TextureType::TwoDim, getTextureProperties(TextureUsage::GUI));
+        auto pixels = std::make_shared<ByteBuffer>(std::move(indexed.info.screenPixels));
+        screen->setPixels(indexed.info.screenWidth, indexed.info.screenHeight, indexed.info.screenFormat, Texture::Layer {std::move(pixels)});
+        screen->init();
+        descriptor.save.screen = std::move(screen);
+    }
+    descriptor.path = std::move(indexed.path);
+    auto it = std::upper_bound(_saves.begin(), _saves.end(), descriptor.number, [](int number, auto &save) { return number < save.number; });
+    _saves.insert(it, std::move(descriptor));
 }
 
-void SaveLoad::indexSavedGame(std::filesystem::path path) {
-    try {
-        std::filesystem::path basename(path.filename());
-        basename.replace_extension();
-        int number = stoi(basename.string());
-
-        SavedGameDescriptor descriptor;
-        descriptor.number = number;
-        descriptor.save = peekSavedGame(path);
-        descriptor.path = std::move(path);
-        _saves.push_back(std::move(descriptor));
-    } catch (const std::exception &e) {
-        warn("Error indexing a saved game: " + std::string(e.what()));
+void SaveLoad::refreshSavedGameItems() {
+    _controls.LB_GAMES->clearItems();
+    for (size_t i = 0; i < _saves.size(); ++i) {
+        std::string name(str(boost::format("%06d") % _saves[i].number));
+        ListBox::Item item;
+        item.tag = name;
+        item.text = name;
+        _controls.LB_GAMES->addItem(std::move(item));
     }
 }
 
@@ -56,6 +56,7 @@
 #include "reone/scene/types.h"
 #include "reone/system/logutil.h"
 #include "reone/system/randomutil.h"
+#include "reone/system/tracer.h"
 
 using namespace reone::audio;
 using namespace reone::gui;
@@ -90,33 +91,33 @@ Area::Area(
         "",
         game,
         services),
-    _sceneName(std::move(sceneName)) {
+    _sceneName(std::move(sceneName)),
+    _pathService(_pathfinder, services.system.threadPool) {
 
     init();
-    _heartbeatTimer.reset(kHeartbeatInterval);
 }
 
 void Area::init() {
     const GraphicsOptions &opts = _game.options().graphics;
     _cameraAspect = opts.width / static_cast<float>(opts.height);
 
-    _objectsByType.insert(std::make_pair(ObjectType::Creature, ObjectList()));
-    _objectsByType.insert(std::make_pair(ObjectType::Item, ObjectList()));
-    _objectsByType.insert(std::make_pair(ObjectType::Trigger, ObjectList()));
-    _objectsByType.insert(std::make_pair(ObjectType::Door, ObjectList()));
-    _objectsByType.insert(std::make_pair(ObjectType::AreaOfEffect, ObjectList()));
-    _objectsByType.insert(std::make_pair(ObjectType::Waypoint, ObjectList()));
-    _objectsByType.insert(std::make_pair(ObjectType::Placeable, ObjectList()));
-    _objectsByType.insert(std::make_pair(ObjectType::Store, ObjectList()));
-    _objectsByType.insert(std::make_pair(ObjectType::Encounter, ObjectList()));
-    _objectsByType.insert(std::make_pair(ObjectType::Sound, ObjectList()));
+    _objectsByType.insert(std::make_pair(ObjectType::Creature, IndexedObjectList()));
+    _objectsByType.insert(std::make_pair(ObjectType::Item, IndexedObjectList()));
+    _objectsByType.insert(std::make_pair(ObjectType::Trigger, IndexedObjectList()));
+    _objectsByType.insert(std::make_pair(ObjectType::Door, IndexedObjectList()));
+    _objectsByType.insert(std::make_pair(ObjectType::AreaOfEffect, IndexedObjectList()));
+    _objectsByType.insert(std::make_pair(ObjectType::Waypoint, IndexedObjectList()));
+    _objectsByType.insert(std::make_pair(ObjectType::Placeable, IndexedObjectList()));
+    _objectsByType.insert(std::make_pair(ObjectType::Store, IndexedObjectList()));
+    _objectsByType.insert(std::make_pair(ObjectType::Encounter, IndexedObjectList()));
+    _objectsByType.insert(std::make_pair(ObjectType::Sound, IndexedObjectList()));
 }
 
-void Area::load(std::string name, const Gff &are, const Gff &git, bool fromSave) {
+void Area::load(std::string name, const GffView &are, const GffView &git, bool fromSave) {
     _name = std::move(name);
 
-    auto areParsed = resource::generated::parseARE(are);
-    auto gitParsed = resource::generated::parseGIT(git);
+    auto areParsed = resource::generated::decodeARE(are);
+    auto gitParsed = resource::generated::decodeGIT(git);
 
     loadARE(areParsed);
     loadGIT(gitParsed);
@@ -412,6 +413,7 @@ void Area::loadPTH() {
     }
 
     _pathfinder.load(path->points, pointZ);
+    _pathService.clearCache();
 }
 
 void Area::initCameras(const glm::vec3 &entryPosition, float entryFacing) {
@@ -437,10 +439,31 @@ void Area::initCameras(const glm::vec3 &entryPosition, float entryFacing) {
     _animatedCamera->load();
 }
 
+void IndexedObjectList::add(std::shared_ptr<Object> object) {
+    _indexById[object->id()] = _objects.size();
+    _objects.push_back(std::move(object));
+}
+
+bool IndexedObjectList::remove(const Object &object) {
+    auto it = _indexById.find(object.id());
+    if (it == _indexById.end()) {
+        return false;
+    }
+    size_t index = it->second;
+    _indexById.erase(it);
+    if (index != _objects.size() - 1) {
+        _objects[index] = std::move(_objects.back());
+        _indexById[_objects[index]->id()] = index;
+    }
+    _objects.pop_back();
+    return true;
+}
+
 void Area::add(const std::shared_ptr<Object> &object) {
-    _objects.push_back(object);
-    _objectsByType[object->type()].push_back(object);
+    _objects.add(object);
+    _objectsByType[object->type()].add(object);
     _objectsByTag[object->tag()].push_back(object);
+    _objectGridDirty = true;
 
     determineObjectRoom(*object);
 
@@ -540,12 +563,15 @@ void Area::doDestroyObject(uint32_t objectId) {
         }
     }
 
-    auto maybeObject = std::find_if(_objects.begin(), _objects.end(), [&object](auto &o) { return o.get() == object.get(); });
-    if (maybeObject != _objects.end()) {
-        _objects.erase(maybeObject);
-    }
+    _objects.remove(*object);
+    _objectsByType[object->type()].remove(*object);
+    _objectGrid.clear();
+    _objectGridDirty = true;
+    _nearestObjects.clear();
+
     auto maybeTagObjects = _objectsByTag.find(object->tag());
     if (maybeTagObjects != _objectsByTag.end()) {
+        // Linear, but lists are short, and order must be preserved for nth lookups by tag
         auto &tagObjects = maybeTagObjects->second;
         auto maybeObjectByTag = std::find_if(tagObjects.begin(), tagObjects.end(), [&object](auto &o) { return o.get() == object.get(); });
         if (maybeObjectByTag != tagObjects.end()) {
@@ -555,15 +581,10 @@ void Area::doDestroyObject(uint32_t objectId) {
             _objectsByTag.erase(maybeTagObjects);
         }
     }
-    auto &typeObjects = _objectsByType.find(object->type())->second;
-    auto maybeObjectByType = std::find_if(typeObjects.begin(), typeObjects.end(), [&object](auto &o) { return o.get() == object.get(); });
-    if (maybeObjectByType != typeObjects.end()) {
-        typeObjects.erase(maybeObjectByType);
-    }
 }
 
 ObjectList &Area::getObjectsByType(ObjectType type) {
-    return _objectsByType.find(type)->second;
+    return _objectsByType.find(type)->second.objects();
 }
 
 std::shared_ptr<Object> Area::getObjectByTag(const std::string &tag, int nth) const {
@@ -638,6 +659,8 @@ bool Area::handleKeyDown(const input::KeyEvent &event) {
 }
 
 void Area::update(float dt) {
+    R_TRACE_ZONE("Area::update");
+
     doDestroyObjects();
     updateVisibility();
     updateObjectSelection();
@@ -647,7 +670,7 @@ void Area::update(float dt) {
     }
     Object::update(dt);
 
-    for (auto &object : _objects) {
+    for (auto &object : _objects.objects()) {
         object->update(dt);
     }
     updatePerception(dt);
@@ -742,7 +765,7 @@ bool Area::isObjectSeen(const Creature &subject, const Object &object) const {
 }
 
 void Area::runSpawnScripts() {
-    for (auto &creature : _objectsByType[ObjectType::Creature]) {
+    for (auto &creature : _objectsByType[ObjectType::Creature].objects()) {
         static_cast<Creature &>(*creature).runSpawnScript();
     }
 }
@@ -867,12 +890,12 @@ void Area::updateVisibility() {
 void Area::checkTriggersIntersection(const std::shared_ptr<Object> &triggerrer) {
     glm::vec2 position2d(triggerrer->position());
 
-    for (auto &object : _objectsByType[ObjectType::Trigger]) {
+    for (auto &object : _objectsByType[ObjectType::Trigger].objects()) {
         auto trigger = std::static_pointer_cast<Trigger>(object);
         if (trigger->isTenant(triggerrer) || !trigger->isIn(position2d)) {
             continue;
         }
-        debug(str(boost::format("Trigger '%s' triggerred by '%s'") % trigger->tag() % triggerrer->tag()));
+        R_LOG_DEBUG(LogChannel::Global, str(boost::format("Trigger '%s' triggerred by '%s'") % trigger->tag() % triggerrer->tag()));
         trigger->addTenant(triggerrer);
 
         if (!trigger->linkedToModule().empty()) {
@@ -886,19 +909,26 @@ void Area::checkTriggersIntersection(const std::shared_ptr<Object> &triggerrer)
 }
 
 void Area::updateHeartbeat(float dt) {
-    _heartbeatTimer.update(dt);
-    if (_heartbeatTimer.elapsed()) {
-        if (!_onHeartbeat.empty()) {
-            _game.scriptRunner().run(_onHeartbeat, _id);
+    R_TRACE_ZONE("Area::updateHeartbeat");
+
+    _heartbeatScheduler.update(dt, [this](int phase) {
+        if (!_onHeartbeat.empty() && _heartbeatScheduler.phaseOf(_id) == phase) {
+            _heartbeatScheduler.enqueue(_id, _onHeartbeat);
         }
-        for (auto &object : _objects) {
-            std::string heartbeat(object->getOnHeartbeat());
-            if (!heartbeat.empty()) {
-                _game.scriptRunner().run(heartbeat, object->id());
+        for (auto &object : _objects.objects()) {
+            auto &heartbeat = object->getOnHeartbeat();
+            if (!heartbeat.empty() && _heartbeatScheduler.phaseOf(object->id()) == phase) {
+                _heartbeatScheduler.enqueue(object->id(), heartbeat);
             }
         }
-        _heartbeatTimer.reset(kHeartbeatInterval);
-    }
+    });
+    _heartbeatScheduler.dispatch([this](const auto &event) {
+        // Object might have been destroyed since the event was queued
+        if (event.callerId != _id && !_game.getObjectById(event.callerId)) {
+            return;
+        }
+        _game.scriptRunner().run(event.resRef, event.callerId);
+    });
 }
 
 Camera *Area::getCamera(CameraType type) {
@@ -919,7 +949,7 @@ Camera *Area::getCamera(CameraType type) {
 }
 
 void Area::setStaticCamera(int cameraId) {
-    for (auto &object : _objectsByType[ObjectType::Camera]) {
+    for (auto &object : _objectsByType[ObjectType::Camera].objects()) {
         auto camera = static_cast<Camera *>(object.get());
         if (camera->cameraId() == cameraId) {
             _staticCamera = static_cast<StaticCamera *>(camera);
@@ -1040,41 +1070,39 @@ void Area::selectObject(std::shared_ptr<Object> object) {
     _selectedObject = std::move(object);
 }
 
-std::shared_ptr<Object> Area::getNearestObject(const glm::vec3 &origin, int nth, const std::function<bool(const std::shared_ptr<Object> &)> &predicate) {
-    std::vector<std::pair<std::shared_ptr<Object>, float>> candidates;
-
-    for (auto &object : _objects) {
-        if (predicate(object)) {
-            candidates.push_back(std::make_pair(object, object->getSquareDistanceTo(origin)));
-        }
+void Area::refreshObjectGrid() {
+    // Rebuild only when objects were added or removed, or moved out of tolerance
+    if (!_objectGridDirty && !_objectGrid.isStale(kObjectGridMargin)) {
+        return;
+    }
+    _objectGrid.clear();
+    for (auto &object : _objects.objects()) {
+        _objectGrid.add(object);
     }
-    sort(candidates.begin(), candidates.end(), [](auto &left, auto &right) { return left.second < right.second; });
+    _objectGridDirty = false;
+}
+
+std::shared_ptr<Object> Area::getNearestObject(const glm::vec3 &origin, int nth, const std::function<bool(const std::shared_ptr<Object> &)> &predicate) {
+    refreshObjectGrid();
+    _objectGrid.findNearest(origin, nth + 1, predicate, _nearestObjects, kObjectGridMargin);
 
-    int candidateCount = static_cast<int>(candidates.size());
+    int candidateCount = static_cast<int>(_nearestObjects.size());
     if (nth >= candidateCount) {
-        debug(str(boost::format("getNearestObject: nth is out of bounds: %d/%d") % nth % candidateCount));
+        R_LOG_DEBUG(LogChannel::Global, str(boost::format("getNearestObject: nth is out of bounds: %d/%d") % nth % candidateCount));
         return nullptr;
     }
 
-    return candidates[nth].first;
+    return _nearestObjects[nth].first;
 }
 
 std::shared_ptr<Creature> Area::getNearestCreature(const std::shared_ptr<Object> &target, const SearchCriteriaList &criterias, int nth) {
-    std::vector<std::pair<std::shared_ptr<Creature>, float>> candidates;
-
-    for (auto &object : getObjectsByType(ObjectType::Creature)) {
-        auto creature = std::static_pointer_cast<Creature>(object);
-        if (matchesCriterias(*creature, criterias, target)) {
-            float distance2 = creature->getSquareDistanceTo(*target);
-            candidates.push_back(std::make_pair(std::move(creature), distance2));
-        }
-    }
+    refreshObjectGrid();
+    auto predicate = [this, &target, &criterias](const std::shared_ptr<Object> &object) {
+        return object->type() == ObjectType::Creature && matchesCriterias(static_cast<const Creature &>(*object), criterias, target);
+    };
+    _objectGrid.findNearest(target->position(), nth + 1, predicate, _nearestObjects, kObjectGridMargin);
 
-    sort(candidates.begin(), candidates.end(), [](auto &left, auto &right) {
-        return left.second < right.second;
-    });
-
-    return nth < candidates.size() ? candidates[nth].first : nullptr;
+    return nth < _nearestObjects.size() ? std::static_pointer_cast<Creature>(_nearestObjects[nth].first) : nullptr;
 }
 
 bool Area::matchesCriterias(const Creature &creature, const SearchCriteriaList &criterias, std::shared_ptr<Object> target) const {
@@ -1150,24 +1178,18 @@ bool Area::matchesCriterias(const Creature &creature, const SearchCriteriaList &
 }
 
 std::shared_ptr<Creature> Area::getNearestCreatureToLocation(const Location &location, const SearchCriteriaList &criterias, int nth) {
-    std::vector<std::pair<std::shared_ptr<Creature>, float>> candidates;
+    refreshObjectGrid();
+    auto predicate = [this, &criterias](const std::shared_ptr<Object> &object) {
+        return object->type() == ObjectType::Creature && matchesCriterias(static_cast<const Creature &>(*object), criterias);
+    };
+    _objectGrid.findNearest(location.position(), nth + 1, predicate, _nearestObjects, kObjectGridMargin);
 
-    for (auto &object : getObjectsByType(ObjectType::Creature)) {
-        auto creature = std::static_pointer_cast<Creature>(object);
-        if (matchesCriterias(*creature, criterias)) {
-            float distance2 = creature->getSquareDistanceTo(location.position());
-            candidates.push_back(std::make_pair(std::move(creature), distance2));
-        }
-    }
-
-    std::sort(candidates.begin(), candidates.end(), [](auto &left, auto &right) {
-        return left.second < right.second;
-    });
-
-    return nth < candidates.size() ? candidates[nth].first : nullptr;
+    return nth < _nearestObjects.size() ? std::static_pointer_cast<Creature>(_nearestObjects[nth].first) : nullptr;
 }
 
 void Area::updatePerception(float dt) {
+    R_TRACE_ZONE("Area::updatePerception");
+
     _perceptionTimer.update(dt);
     if (_perceptionTimer.elapsed()) {
         doUpdatePerception();
@@ -1206,20 +1228,20 @@ void Area::doUpdatePerception() {
             // Hearing
             bool wasHeard = creature->perception().heard.count(other) > 0;
             if (!wasHeard && heard) {
-                debug(str(boost::format("%s heard by %s") % other->tag() % creature->tag()), LogChannel::Perception);
+                R_LOG_DEBUG(LogChannel::Perception, str(boost::format("%s heard by %s") % other->tag() % creature->tag()));
                 creature->onObjectHeard(other);
             } else if (wasHeard && !heard) {
-                debug(str(boost::format("%s inaudible to %s") % other->tag() % creature->tag()), LogChannel::Perception);
+                R_LOG_DEBUG(LogChannel::Perception, str(boost::format("%s inaudible to %s") % other->tag() % creature->tag()));
                 creature->onObjectInaudible(other);
             }
 
             // Sight
             bool wasSeen = creature->perception().seen.count(other) > 0;
             if (!wasSeen && seen) {
-                debug(str(boost::format("%s seen by %s") % other->tag() % creature->tag()), LogChannel::Perception);
+                R_LOG_DEBUG(LogChannel::Perception, str(boost::format("%s seen by %s") % other->tag() % creature->tag()));
                 creature->onObjectSeen(other);
             } else if (wasSeen && !seen) {
-                debug(str(boost::format("%s vanished from %s") % other->tag() % creature->tag()), LogChannel::Perception);
+                R_LOG_DEBUG(LogChannel::Perception, str(boost::format("%s vanished from %s") % other->tag() % creature->tag()));
                 creature->onObjectVanished(other);
             }
         }
@@ -64,6 +64,7 @@ namespace game {
 
 static constexpr int kStrRefRemains = 38151;
 static constexpr float kKeepPathDuration = 1000.0f;
+static constexpr float kReplanDistance = 2.0f;
 
 static std::string g_talkDummyNode("talkdummy");
 
@@ -72,6 +73,107 @@ static const std::string g_maskHookNode("gogglehook");
 static const std::string g_rightHandNode("rhand");
 static const std::string g_leftHandNode("lhand");
 
+static constexpr int kNumBodyVariations = 26; // a-z
+
+struct AppearanceColumns {
+    TwoDA::ColumnRef modelType;
+    TwoDA::ColumnRef walkDist;
+    TwoDA::ColumnRef runDist;
+    TwoDA::ColumnRef footstepType;
+    TwoDA::ColumnRef envmap;
+    TwoDA::ColumnRef normalHead;
+    TwoDA::ColumnRef race;
+    TwoDA::ColumnRef raceTex;
+    TwoDA::ColumnRef model[kNumBodyVariations];
+    TwoDA::ColumnRef tex[kNumBodyVariations];
+
+    AppearanceColumns() = default;
+
+    AppearanceColumns(const TwoDA &appearance) :
+        modelType(appearance.column("modeltype")),
+        walkDist(appearance.column("walkdist")),
+        runDist(appearance.column("rundist")),
+        footstepType(appearance.column("footsteptype")),
+        envmap(appearance.column("envmap")),
+        normalHead(appearance.column("normalhead")),
+        race(appearance.column("race")),
+        raceTex(appearance.column("racetex")) {
+        for (int i = 0; i < kNumBodyVariations; ++i) {
+            char variation = static_cast<char>('a' + i);
+            model[i] = appearance.column(std::string("model") + variation);
+            tex[i] = appearance.column(std::string("tex") + variation);
+        }
+    }
+};
+
+struct HeadColumns {
+    TwoDA::ColumnRef head;
+
+    HeadColumns() = default;
+
+    HeadColumns(const TwoDA &heads) :
+        head(heads.column("head")) {
+    }
+};
+
+struct SoundSetColumns {
+    TwoDA::ColumnRef resRef;
+
+    SoundSetColumns() = default;
+
+    SoundSetColumns(const TwoDA &soundSets) :
+        resRef(soundSets.column("resref")) {
+    }
+};
+
+struct BodyBagColumns {
+    TwoDA::ColumnRef name;
+    TwoDA::ColumnRef appearance;
+    TwoDA::ColumnRef corpse;
+
+    BodyBagColumns() = default;
+
+    BodyBagColumns(const TwoDA &bodyBags) :
+        name(bodyBags.column("name")),
+        appearance(bodyBags.column("appearance")),
+        corpse(bodyBags.column("corpse")) {
+    }
+};
+
+struct RangeColumns {
+    TwoDA::ColumnRef primaryRange;
+    TwoDA::ColumnRef secondaryRange;
+
+    RangeColumns() = default;
+
+    RangeColumns(const TwoDA &ranges) :
+        primaryRange(ranges.column("primaryrange")),
+        secondaryRange(ranges.column("secondaryrange")) {
+    }
+};
+
+/**
+ * Resolves columns of a 2DA table once, and again only when the table is reloaded.
+ * Creatures are loaded on the main thread.
+ */
+template <class Columns>
+static const Columns &getColumns(const std::shared_ptr<TwoDA> &table) {
+    static std::weak_ptr<TwoDA> resolvedTable;
+    static Columns columns;
+    if (resolvedTable.lock() != table) {
+        columns = Columns(*table);
+        resolvedTable = table;
+    }
+    return columns;
+}
+
+static TwoDA::ColumnRef getBodyVariationColumn(const TwoDA &appearance, const TwoDA::ColumnRef (&columns)[kNumBodyVariations], const std::string &prefix, const std::string &variation) {
+    if (variation.size() == 1 && variation[0] >= 'a' && variation[0] <= 'z') {
+        return columns[variation[0] - 'a'];
+    }
+    return appearance.column(prefix + variation);
+}
+
 void Creature::Path::selectNextPoint() {
     size_t pointCount = points.size();
     if (pointIdx < pointCount) {
@@ -86,11 +188,11 @@ void Creature::loadFromGIT(const resource::generated::GIT_Creature_List &git) {
 }
 
 void Creature::loadFromBlueprint(const std::string &resRef) {
-    auto utc = _services.resource.gffs.get(resRef, ResType::Utc);
+    auto utc = _services.resource.gffs.getView(resRef, ResType::Utc);
     if (!utc) {
         return;
     }
-    loadUTC(resource::generated::parseUTC(*utc));
+    loadUTC(resource::generated::decodeUTC(*utc));
     loadAppearance();
 }
 
@@ -100,11 +202,12 @@ void Creature::loadAppearance() {
         throw ResourceNotFoundException("appearance 2DA not found");
     }
 
-    _modelType = parseModelType(appearances->getString(_appearance, "modeltype"));
-    _walkSpeed = appearances->getFloat(_appearance, "walkdist", 1.0f);
-    _runSpeed = appearances->getFloat(_appearance, "rundist", 1.0f);
-    _footstepType = appearances->getInt(_appearance, "footsteptype", -1);
-    _envmap = boost::to_lower_copy(appearances->getString(_appearance, "envmap"));
+    auto &columns = getColumns<AppearanceColumns>(appearances);
+    _modelType = parseModelType(appearances->getString(_appearance, columns.modelType));
+    _walkSpeed = appearances->getFloat(_appearance, columns.walkDist, 1.0f);
+    _runSpeed = appearances->getFloat(_appearance, columns.runDist, 1.0f);
+    _footstepType = appearances->getInt(_appearance, columns.footstepType, -1);
+    _envmap = boost::to_lower_copy(appearances->getString(_appearance, columns.envmap));
 
     if (_portraitId > 0) {
         _portrait = _services.game.portraits.getTextureByIndex(_portraitId);
@@ -113,6 +216,7 @@ void Creature::loadAppearance() {
     }
 
     auto modelSceneNode = buildModel();
+    _animations = AnimationTable();
     if (modelSceneNode) {
         finalizeModel(*modelSceneNode);
         _sceneNode = std::move(modelSceneNode);
@@ -204,21 +308,22 @@ void Creature::updateModelAnimation() {
     std::shared_ptr<Animation> anim;
     std::shared_ptr<Animation> talkAnim;
 
+    auto &animations = getAnimationTable(model->model());
     switch (_movementType) {
     case MovementType::Run:
-        anim = model->model().getAnimation(getRunAnimation());
+        anim = animations.run[static_cast<int>(getRunAnimationType())];
         break;
     case MovementType::Walk:
-        anim = model->model().getAnimation(getWalkAnimation());
+        anim = animations.walk;
         break;
     default:
         if (_dead) {
-            anim = model->model().getAnimation(getDeadAnimation());
+            anim = animations.dead;
         } else if (_talking) {
-            anim = model->model().getAnimation(getTalkNormalAnimation());
-            talkAnim = model->model().getAnimation(getHeadTalkAnimation());
+            anim = animations.talkNormal;
+            talkAnim = animations.headTalk;
         } else {
-            anim = model->model().getAnimation(getPauseAnimation());
+            anim = animations.pause[getPauseAnimationIndex()];
         }
         break;
     }
@@ -301,10 +406,57 @@ void Creature::playAnimation(const std::shared_ptr<Animation> &anim, AnimationPr
 }
 
 void Creature::playAnimation(CombatAnimation anim, CreatureWieldType wield, int variant) {
-    std::string animName(getAnimationName(anim, wield, variant));
-    if (!animName.empty()) {
-        playAnimation(animName, AnimationProperties::fromFlags(AnimationFlags::blend));
+    auto model = std::static_pointer_cast<ModelSceneNode>(_sceneNode);
+    if (!model) {
+        return;
     }
+    auto animation = getCombatAnimation(model->model(), anim, wield, variant);
+    if (animation) {
+        playAnimation(animation, AnimationProperties::fromFlags(AnimationFlags::blend));
+    }
+}
+
+Creature::AnimationTable &Creature::getAnimationTable(const Model &model) {
+    if (_animations.model == &model) {
+        return _animations;
+    }
+    _animations = AnimationTable();
+    _animations.model = &model;
+    for (int i = 0; i < kNumPauseAnimations; ++i) {
+        _animations.pause[i] = model.getAnimation(getPauseAnimation(i));
+    }
+    for (int i = 0; i < static_cast<int>(RunAnimation::Count); ++i) {
+        _animations.run[i] = model.getAnimation(getRunAnimation(static_cast<RunAnimation>(i)));
+    }
+    _animations.walk = model.getAnimation(getWalkAnimation());
+    _animations.dead = model.getAnimation(getDeadAnimation());
+    _animations.talkNormal = model.getAnimation(getTalkNormalAnimation());
+    _animations.headTalk = model.getAnimation(getHeadTalkAnimation());
+    int numCombatAnimations = kNumCombatAnimations * kNumWieldTypes * kNumAnimationVariants;
+    _animations.combat.resize(numCombatAnimations);
+    _animations.combatResolved.resize(numCombatAnimations, false);
+    return _animations;
+}
+
+std::shared_ptr<Animation> Creature::getCombatAnimation(const Model &model, CombatAnimation anim, CreatureWieldType wield, int variant) {
+    int animIdx = static_cast<int>(anim);
+    int wieldIdx = static_cast<int>(wield);
+    if (animIdx < 0 || animIdx >= kNumCombatAnimations ||
+        wieldIdx < 0 || wieldIdx >= kNumWieldTypes ||
+        variant < 0 || variant >= kNumAnimationVariants) {
+        auto name = getAnimationName(anim, wield, variant);
+        return !name.empty() ? model.getAnimation(name) : nullptr;
+    }
+    auto &animations = getAnimationTable(model);
+    int idx = (animIdx * kNumWieldTypes + wieldIdx) * kNumAnimationVariants + variant;
+    if (!animations.combatResolved[idx]) {
+        auto name = getAnimationName(anim, wield, variant);
+        if (!name.empty()) {
+            animations.combat[idx] = model.getAnimation(name);
+        }
+        animations.combatResolved[idx] = true;
+    }
+    return animations.combat[idx];
 }
 
 bool Creature::equip(const std::string &resRef) {
@@ -402,6 +554,7 @@ void Creature::setPath(const glm::vec3 &dest, std::vector<glm::vec3> &&points, u
     }
     auto path = std::make_unique<Path>();
     path->destination = dest;
+    path->plannedDestination = dest;
     path->points = points;
     path->timeFound = timeFound;
     path->pointIdx = pointIdx;
@@ -411,6 +564,7 @@ void Creature::setPath(const glm::vec3 &dest, std::vector<glm::vec3> &&points, u
 
 void Creature::clearPath() {
     _path.reset();
+    _pathRequest.reset();
 }
 
 glm::vec3 Creature::getSelectablePosition() const {
@@ -492,7 +646,7 @@ void Creature::die() {
     _dead = true;
     _name = _services.resource.strings.getText(kStrRefRemains);
 
-    debug(str(boost::format("Creature %s is dead") % _tag));
+    R_LOG_DEBUG(LogChannel::Global, str(boost::format("Creature %s is dead") % _tag));
 
     playSound(SoundSetEntry::Dead);
     playAnimation(getDieAnimation());
@@ -729,17 +883,30 @@ bool Creature::navigateTo(const glm::vec3 &dest, bool run, float distance, float
         return true;
     }
 
+    if (_pathRequest) {
+        if (_pathRequest->isDone()) {
+            applyPathRequest(_pathRequest->points());
+        } else if (_services.system.clock.millis() - _pathRequestTime > kKeepPathDuration) {
+            // Request is stuck in the thread pool, find the path synchronously
+            applyPathRequest(_game.module()->area()->pathfinder().findPath(_position, _pathRequestDest));
+        }
+    }
     bool updPath = true;
     if (_path) {
+        // Follow small movements of destination without replanning
         uint32_t now = _services.system.clock.millis();
-        if (_path->destination == dest || now - _path->timeFound <= kKeepPathDuration) {
-            advanceOnPath(run, dt);
+        float destMoved2 = glm::distance2(_path->plannedDestination, dest);
+        if (destMoved2 <= kReplanDistance * kReplanDistance || now - _path->timeFound <= kKeepPathDuration) {
+            _path->destination = dest;
             updPath = false;
         }
     }
-    if (updPath) {
+    if (updPath && !_pathRequest) {
         updatePath(dest);
     }
+    if (_path) {
+        advanceOnPath(run, dt);
+    }
 
     return false;
 }
@@ -783,9 +950,21 @@ void Creature::advanceOnPath(bool run, float dt) {
 }
 
 void Creature::updatePath(const glm::vec3 &dest) {
-    std::vector<glm::vec3> points(_game.module()->area()->pathfinder().findPath(_position, dest));
+    _pathRequest = _game.module()->area()->pathService().requestPath(_position, dest);
+    _pathRequestDest = dest;
+    _pathRequestTime = _services.system.clock.millis();
+    if (_pathRequest->isDone()) {
+        applyPathRequest(_pathRequest->points());
+    }
+}
+
+void Creature::applyPathRequest(std::vector<glm::vec3> points) {
+    if (points.empty()) {
+        points = std::vector<glm::vec3> {_position, _pathRequestDest};
+    }
+    _pathRequest.reset();
     uint32_t now = _services.system.clock.millis();
-    setPath(dest, std::move(points), now);
+    setPath(_pathRequestDest, std::move(points), now);
 }
 
 std::string Creature::getAnimationName(AnimationType anim) const {
@@ -924,23 +1103,33 @@ std::string Creature::getDeadAnimation() const {
 }
 
 std::string Creature::getPauseAnimation() const {
+    return getPauseAnimation(getPauseAnimationIndex());
+}
+
+std::string Creature::getPauseAnimation(int pauseIdx) const {
     if (_modelType == Creature::ModelType::Creature)
         return "cpause1";
 
     // TODO: if (_lowHP) return "pauseinj"
 
-    if (_combatState.active) {
-        WeaponType type = WeaponType::None;
-        WeaponWield wield = WeaponWield::None;
-        getWeaponInfo(type, wield);
-
-        int wieldNumber = getWeaponWieldNumber(wield);
-        return str(boost::format("g%dr1") % wieldNumber);
+    if (pauseIdx > 0) {
+        return str(boost::format("g%dr1") % pauseIdx);
     }
 
     return "pause1";
 }
 
+int Creature::getPauseAnimationIndex() const {
+    if (_modelType == Creature::ModelType::Creature || !_combatState.active) {
+        return 0;
+    }
+    WeaponType type = WeaponType::None;
+    WeaponWield wield = WeaponWield::None;
+    getWeaponInfo(type, wield);
+
+    return getWeaponWieldNumber(wield);
+}
+
 bool Creature::getWeaponInfo(WeaponType &type, WeaponWield &wield) const {
     std::shared_ptr<Item> item(getEquippedItem(InventorySlots::rightWeapon));
     if (item) {
@@ -976,30 +1165,48 @@ std::string Creature::getWalkAnimation() const {
 }
 
 std::string Creature::getRunAnimation() const {
+    return getRunAnimation(getRunAnimationType());
+}
+
+std::string Creature::getRunAnimation(RunAnimation run) const {
     if (_modelType == Creature::ModelType::Creature)
         return "crun";
 
     // TODO: if (_lowHP) return "runinj"
 
-    if (_combatState.active) {
-        WeaponType type = WeaponType::None;
-        WeaponWield wield = WeaponWield::None;
-        getWeaponInfo(type, wield);
+    switch (run) {
+    case RunAnimation::SingleSword:
+        return "runss";
+    case RunAnimation::DualSwords:
+        return "runds";
+    case RunAnimation::DoubleBladedSword:
+        return "runst";
+    case RunAnimation::Rifle:
+        return "runrf";
+    default:
+        return "run";
+    }
+}
 
-        switch (wield) {
-        case WeaponWield::SingleSword:
-            return isSlotEquipped(InventorySlots::leftWeapon) ? "runds" : "runss";
-        case WeaponWield::DoubleBladedSword:
-            return "runst";
-        case WeaponWield::BlasterRifle:
-        case WeaponWield::HeavyWeapon:
-            return "runrf";
-        default:
-            break;
-        }
+Creature::RunAnimation Creature::getRunAnimationType() const {
+    if (_modelType == Creature::ModelType::Creature || !_combatState.active) {
+        return RunAnimation::Default;
     }
+    WeaponType type = WeaponType::None;
+    WeaponWield wield = WeaponWield::None;
+    getWeaponInfo(type, wield);
 
-    return "run";
+    switch (wield) {
+    case WeaponWield::SingleSword:
+        return isSlotEquipped(InventorySlots::leftWeapon) ? RunAnimation::DualSwords : RunAnimation::SingleSword;
+    case WeaponWield::DoubleBladedSword:
+        return RunAnimation::DoubleBladedSword;
+    case WeaponWield::BlasterRifle:
+    case WeaponWield::HeavyWeapon:
+        return RunAnimation::Rifle;
+    default:
+        return RunAnimation::Default;
+    }
 }
 
 std::string Creature::getTalkNormalAnimation() const {
@@ -1136,26 +1343,25 @@ void Creature::finalizeModel(ModelSceneNode &body) {
 }
 
 std::string Creature::getBodyModelName() const {
-    std::string column;
+    std::shared_ptr<TwoDA> appearance(_services.resource.twoDas.get("appearance"));
+    if (!appearance) {
+        throw ResourceNotFoundException("appearance 2DA not found");
+    }
+    auto &columns = getColumns<AppearanceColumns>(appearance);
 
-    if (_modelType == Creature::ModelType::Character) {
-        column = "model";
+    TwoDA::ColumnRef column;
 
+    if (_modelType == Creature::ModelType::Character) {
         std::shared_ptr<Item> bodyItem(getEquippedItem(InventorySlots::body));
         if (bodyItem) {
             std::string baseBodyVar(bodyItem->baseBodyVariation());
-            column += baseBodyVar;
+            column = getBodyVariationColumn(*appearance, columns.model, "model", baseBodyVar);
         } else {
-            column += "a";
+            column = columns.model[0];
         }
 
     } else {
-        column = "race";
-    }
-
-    std::shared_ptr<TwoDA> appearance(_services.resource.twoDas.get("appearance"));
-    if (!appearance) {
-        throw ResourceNotFoundException("appearance 2DA not found");
+        column = columns.race;
     }
 
     std::string modelName(appearance->getString(_appearance, column));
@@ -1165,25 +1371,24 @@ std::string Creature::getBodyModelName() const {
 }
 
 std::string Creature::getBodyTextureName() const {
-    std::string column;
+    std::shared_ptr<TwoDA> appearance(_services.resource.twoDas.get("appearance"));
+    if (!appearance) {
+        throw ResourceNotFoundException("appearance 2DA not found");
+    }
+    auto &columns = getColumns<AppearanceColumns>(appearance);
+
+    TwoDA::ColumnRef column;
     std::shared_ptr<Item> bodyItem(getEquippedItem(InventorySlots::body));
 
     if (_modelType == Creature::ModelType::Character) {
-        column = "tex";
-
         if (bodyItem) {
             std::string baseBodyVar(bodyItem->baseBodyVariation());
-            column += baseBodyVar;
+            column = getBodyVariationColumn(*appearance, columns.tex, "tex", baseBodyVar);
         } else {
-            column += "a";
+            column = columns.tex[0];
         }
     } else {
-        column = "racetex";
-    }
-
-    std::shared_ptr<TwoDA> appearance(_services.resource.twoDas.get("appearance"));
-    if (!appearance) {
-        throw ResourceNotFoundException("appearance 2DA not found");
+        column = columns.raceTex;
     }
 
     std::string texName(boost::to_lower_copy(appearance->getString(_appearance, column)));
@@ -1216,7 +1421,7 @@ std::string Creature::getHeadModelName() const {
     if (!appearance) {
         throw ResourceNotFoundException("appearance 2DA not found");
     }
-    int headIdx = appearance->getInt(_appearance, "normalhead", -1);
+    int headIdx = appearance->getInt(_appearance, getColumns<AppearanceColumns>(appearance).normalHead, -1);
     if (headIdx == -1) {
         return "";
     }
@@ -1225,7 +1430,7 @@ std::string Creature::getHeadModelName() const {
         throw ResourceNotFoundException("heads 2DA not found");
     }
 
-    std::string modelName(heads->getString(headIdx, "head"));
+    std::string modelName(heads->getString(headIdx, getColumns<HeadColumns>(heads).head));
     boost::to_lower(modelName);
 
     return modelName;
@@ -1348,7 +1553,7 @@ void Creature::loadSoundSetFromUTC(const resource::generated::UTC &utc) {
     if (!soundSetTable) {
         return;
     }
-    std::string soundSetResRef(soundSetTable->getString(soundSetIdx, "resref"));
+    std::string soundSetResRef(soundSetTable->getString(soundSetIdx, getColumns<SoundSetColumns>(soundSetTable).resRef));
     if (!soundSetResRef.empty()) {
         _soundSet = _services.resource.soundSets.get(soundSetResRef);
     }
@@ -1359,10 +1564,11 @@ void Creature::loadBodyBagFromUTC(const resource::generated::UTC &utc) {
     if (!bodyBags) {
         return;
     }
+    auto &columns = getColumns<BodyBagColumns>(bodyBags);
     int bodyBag = utc.BodyBag;
-    _bodyBag.name = _services.resource.strings.getText(bodyBags->getInt(bodyBag, "name"));
-    _bodyBag.appearance = bodyBags->getInt(bodyBag, "appearance");
-    _bodyBag.corpse = bodyBags->getBool(bodyBag, "corpse");
+    _bodyBag.name = _services.resource.strings.getText(bodyBags->getInt(bodyBag, columns.name));
+    _bodyBag.appearance = bodyBags->getInt(bodyBag, columns.appearance);
+    _bodyBag.corpse = bodyBags->getBool(bodyBag, columns.corpse);
 }
 
 void Creature::loadAttributesFromUTC(const resource::generated::UTC &utc) {
@@ -1400,9 +1606,10 @@ void Creature::loadPerceptionRangeFromUTC(const resource::generated::UTC &utc) {
     if (!ranges) {
         return;
     }
+    auto &columns = getColumns<RangeColumns>(ranges);
     int rangeIdx = utc.PerceptionRange;
-    _perception.sightRange = ranges->getFloat(rangeIdx, "primaryrange");
-    _perception.hearingRange = ranges->getFloat(rangeIdx, "secondaryrange");
+    _perception.sightRange = ranges->getFloat(rangeIdx, columns.primaryRange);
+    _perception.hearingRange = ranges->getFloat(rangeIdx, columns.secondaryRange);
 }
 
 } // namespace game
@@ -57,11 +57,11 @@ void Door::loadFromGIT(const resource::generated::GIT_Door_List &git) {
 }
 
 void Door::loadFromBlueprint(const std::string &resRef) {
-    std::shared_ptr<Gff> utd(_services.resource.gffs.get(resRef, ResType::Utd));
+    std::shared_ptr<GffView> utd(_services.resource.gffs.getView(resRef, ResType::Utd));
     if (!utd) {
         return;
     }
-    auto utdParsed = resource::generated::parseUTD(*utd);
+    auto utdParsed = resource::generated::decodeUTD(*utd);
     loadUTD(utdParsed);
     std::shared_ptr<TwoDA> doors(_services.resource.twoDas.get("genericdoors"));
     std::string modelName(boost::to_lower_copy(doors->getString(_genericType, "modelname")));
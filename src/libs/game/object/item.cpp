@@ -41,9 +41,9 @@ namespace reone {
 namespace game {
 
 void Item::loadFromBlueprint(const std::string &resRef) {
-    std::shared_ptr<Gff> uti(_services.resource.gffs.get(resRef, ResType::Uti));
+    std::shared_ptr<GffView> uti(_services.resource.gffs.getView(resRef, ResType::Uti));
     if (uti) {
-        auto utiParsed = resource::generated::parseUTI(*uti);
+        auto utiParsed = resource::generated::decodeUTI(*uti);
         loadUTI(utiParsed);
     }
 }
@@ -78,12 +78,12 @@ void Module::loadArea(const resource::generated::IFO &ifo, bool fromSave) {
 
     _area = _game.newArea();
 
-    std::shared_ptr<Gff> are(_services.resource.gffs.get(_info.entryArea, ResType::Are));
+    std::shared_ptr<GffView> are(_services.resource.gffs.getView(_info.entryArea, ResType::Are));
     if (!are) {
         throw ResourceNotFoundException("Area ARE not found: " + _info.entryArea);
     }
 
-    std::shared_ptr<Gff> git(_services.resource.gffs.get(_info.entryArea, ResType::Git));
+    std::shared_ptr<GffView> git(_services.resource.gffs.getView(_info.entryArea, ResType::Git));
     if (!git) {
         throw ResourceNotFoundException("Area GIT not found: " + _info.entryArea);
     }
@@ -221,7 +221,7 @@ void Module::onObjectClick(const std::shared_ptr<Object> &object) {
 }
 
 void Module::onCreatureClick(const std::shared_ptr<Creature> &creature) {
-    debug(str(boost::format("Module: click: creature '%s', faction %d") % creature->tag() % static_cast<int>(creature->faction())));
+    R_LOG_DEBUG(LogChannel::Global, str(boost::format("Module: click: creature '%s', faction %d") % creature->tag() % static_cast<int>(creature->faction())));
 
     std::shared_ptr<Creature> partyLeader(_game.party().getLeader());
 
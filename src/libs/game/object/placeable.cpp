@@ -50,11 +50,11 @@ void Placeable::loadFromGIT(const resource::generated::GIT_Placeable_List &git)
 }
 
 void Placeable::loadFromBlueprint(const std::string &resRef) {
-    std::shared_ptr<Gff> utp(_services.resource.gffs.get(resRef, ResType::Utp));
+    std::shared_ptr<GffView> utp(_services.resource.gffs.getView(resRef, ResType::Utp));
     if (!utp) {
         return;
     }
-    auto utpParsed = resource::generated::parseUTP(*utp);
+    auto utpParsed = resource::generated::decodeUTP(*utp);
     loadUTP(utpParsed);
     std::shared_ptr<TwoDA> placeables(_services.resource.twoDas.get("placeables"));
     std::string modelName(boost::to_lower_copy(placeables->getString(_appearance, "modelname")));
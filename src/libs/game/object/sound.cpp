@@ -46,11 +46,11 @@ void Sound::loadFromGIT(const resource::generated::GIT_SoundList &git) {
 }
 
 void Sound::loadFromBlueprint(const std::string &resRef) {
-    std::shared_ptr<Gff> uts(_services.resource.gffs.get(resRef, ResType::Uts));
+    std::shared_ptr<GffView> uts(_services.resource.gffs.getView(resRef, ResType::Uts));
     if (!uts) {
         return;
     }
-    auto utsParsed = resource::generated::parseUTS(*uts);
+    auto utsParsed = resource::generated::decodeUTS(*uts);
     loadUTS(utsParsed);
 }
 
@@ -75,9 +75,9 @@ void Trigger::loadGeometryFromGIT(const resource::generated::GIT_TriggerList &gi
 }
 
 void Trigger::loadFromBlueprint(const std::string &resRef) {
-    std::shared_ptr<Gff> utt(_services.resource.gffs.get(resRef, ResType::Utt));
+    std::shared_ptr<GffView> utt(_services.resource.gffs.getView(resRef, ResType::Utt));
     if (utt) {
-        auto uttParsed = resource::generated::parseUTT(*utt);
+        auto uttParsed = resource::generated::decodeUTT(*utt);
         loadUTT(uttParsed);
     }
 }
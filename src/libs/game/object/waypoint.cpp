@@ -46,9 +46,9 @@ void Waypoint::loadFromGIT(const resource::generated::GIT_WaypointList &git) {
 }
 
 void Waypoint::loadFromBlueprint(const std::string &resRef) {
-    std::shared_ptr<Gff> utw(_services.resource.gffs.get(resRef, ResType::Utw));
+    std::shared_ptr<GffView> utw(_services.resource.gffs.getView(resRef, ResType::Utw));
     if (utw) {
-        auto utwParsed = resource::generated::parseUTW(*utw);
+        auto utwParsed = resource::generated::decodeUTW(*utw);
         loadUTW(utwParsed);
     }
 }
@@ -61,14 +61,27 @@ const std::vector<glm::vec3> Pathfinder::findPath(const glm::vec3 &from, const g
     }
 
     // Find vertices nearest to start and end points
-    uint16_t fromIdx = getNearestVertex(from);
-    uint16_t toIdx = getNearestVertex(to);
+    int fromVertex = getNearestVertex(from);
+    int toVertex = getNearestVertex(to);
 
     // When start and end point have a common nearest vertex, return a path of start and end point
-    if (fromIdx == toIdx) {
+    if (fromVertex == toVertex) {
         return std::vector<glm::vec3> {from, to};
     }
 
+    auto path = findPath(fromVertex, toVertex);
+    if (path.empty()) {
+        // Return a path of start and end points by default
+        return std::vector<glm::vec3> {from, to};
+    }
+
+    return path;
+}
+
+std::vector<glm::vec3> Pathfinder::findPath(int fromVertex, int toVertex) const {
+    auto fromIdx = static_cast<uint16_t>(fromVertex);
+    auto toIdx = static_cast<uint16_t>(toVertex);
+
     Context ctx;
 
     // Add vertex, nearest to start point, to open list
@@ -129,18 +142,17 @@ const std::vector<glm::vec3> Pathfinder::findPath(const glm::vec3 &from, const g
         }
     }
 
-    // Return a path of start and end points by default
-    return std::vector<glm::vec3> {from, to};
+    return std::vector<glm::vec3>();
 }
 
-uint16_t Pathfinder::getNearestVertex(const glm::vec3 &point) const {
-    uint16_t index = 0xffff;
+int Pathfinder::getNearestVertex(const glm::vec3 &point) const {
+    int index = -1;
     float minDist = 0.0f;
 
     for (int i = 0; i < _vertices.size(); ++i) {
         float dist = glm::distance2(point, _vertices[i]);
 
-        if (index == 0xffff || dist < minDist) {
+        if (index == -1 || dist < minDist) {
             index = i;
             minDist = dist;
         }
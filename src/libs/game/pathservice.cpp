@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/game/pathservice.h"
+
+namespace reone {
+
+namespace game {
+
+static uint32_t getPathKey(int fromVertex, int toVertex) {
+    return (static_cast<uint32_t>(fromVertex) << 16) | static_cast<uint32_t>(toVertex);
+}
+
+PathService::~PathService() {
+    // Tasks that have not started yet either return early or are dropped by
+    // the thread pool, so only wait for running tasks, as they reference
+    // pathfinder
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _inFlight.clear();
+    }
+    std::unique_lock<std::mutex> lock(_taskState->mutex);
+    _taskState->quit = true;
+    _taskState->condVar.wait(lock, [this]() { return _taskState->numRunning == 0; });
+}
+
+std::shared_ptr<PathService::Request> PathService::requestPath(const glm::vec3 &from, const glm::vec3 &to) {
+    int fromVertex = _pathfinder.getNearestVertex(from);
+    int toVertex = _pathfinder.getNearestVertex(to);
+    if (fromVertex == -1 || fromVertex == toVertex) {
+        auto request = std::make_shared<Request>();
+        request->_done = true;
+        return request;
+    }
+    auto key = getPathKey(fromVertex, toVertex);
+    std::shared_ptr<Request> request;
+    uint32_t generation;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto cached = _cache.find(key);
+        if (cached != _cache.end()) {
+            return cached->second;
+        }
+        auto inFlight = _inFlight.find(key);
+        if (inFlight != _inFlight.end()) {
+            return inFlight->second;
+        }
+        request = std::make_shared<Request>();
+        _inFlight.insert(std::make_pair(key, request));
+        generation = _generation;
+    }
+    auto task = _threadPool.enqueue([this, state = _taskState, key, generation, fromVertex, toVertex, request](const std::atomic_bool &canceled) {
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (state->quit || canceled) {
+                return;
+            }
+            ++state->numRunning;
+        }
+        solve(key, generation, fromVertex, toVertex, request);
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            --state->numRunning;
+        }
+        state->condVar.notify_all();
+    });
+    if (!task) {
+        // Thread pool is not available - solve synchronously
+        solve(key, generation, fromVertex, toVertex, request);
+    }
+    return request;
+}
+
+void PathService::solve(uint32_t key, uint32_t generation, int fromVertex, int toVertex, std::shared_ptr<Request> request) {
+    request->_points = _pathfinder.findPath(fromVertex, toVertex);
+    request->_done.store(true, std::memory_order_release);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (generation != _generation) {
+        // Path was found by the pathfinder that has since been reloaded
+        return;
+    }
+    _inFlight.erase(key);
+    if (_cache.count(key) == 0) {
+        if (_cacheOrder.size() >= kMaxCachedPaths) {
+            _cache.erase(_cacheOrder.front());
+            _cacheOrder.pop_front();
+        }
+        _cache.insert(std::make_pair(key, std::move(request)));
+        _cacheOrder.push_back(key);
+    }
+}
+
+void PathService::clearCache() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cache.clear();
+    _cacheOrder.clear();
+    _inFlight.clear();
+    ++_generation;
+}
+
+int PathService::numCachedPaths() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return static_cast<int>(_cache.size());
+}
+
+} // namespace game
+
+} // namespace reone
@@ -36,16 +36,22 @@ void Portraits::init() {
         return;
     }
 
+    auto baseResRefColumn = portraits->column("baseresref");
+    auto appearanceNumberColumn = portraits->column("appearancenumber");
+    auto appearanceSColumn = portraits->column("appearance_s");
+    auto appearanceLColumn = portraits->column("appearance_l");
+    auto forPCColumn = portraits->column("forpc");
+    auto sexColumn = portraits->column("sex");
     for (int row = 0; row < portraits->getRowCount(); ++row) {
-        std::string resRef(boost::to_lower_copy(portraits->getString(row, "baseresref")));
+        std::string resRef(boost::to_lower_copy(portraits->getString(row, baseResRefColumn)));
 
         Portrait portrait;
         portrait.resRef = resRef;
-        portrait.appearanceNumber = portraits->getInt(row, "appearancenumber");
-        portrait.appearanceS = portraits->getInt(row, "appearance_s");
-        portrait.appearanceL = portraits->getInt(row, "appearance_l");
-        portrait.forPC = portraits->getBool(row, "forpc");
-        portrait.sex = portraits->getInt(row, "sex");
+        portrait.appearanceNumber = portraits->getInt(row, appearanceNumberColumn);
+        portrait.appearanceS = portraits->getInt(row, appearanceSColumn);
+        portrait.appearanceL = portraits->getInt(row, appearanceLColumn);
+        portrait.forPC = portraits->getBool(row, forPCColumn);
+        portrait.sex = portraits->getInt(row, sexColumn);
 
         _portraits.push_back(std::move(portrait));
     }
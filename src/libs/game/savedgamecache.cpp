@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/game/savedgamecache.h"
+
+#include "reone/system/binaryreader.h"
+#include "reone/system/binarywriter.h"
+#include "reone/system/exception/validation.h"
+#include "reone/system/logutil.h"
+#include "reone/system/stream/fileinput.h"
+#include "reone/system/stream/fileoutput.h"
+#include "reone/system/stream/memoryinput.h"
+
+using namespace reone::graphics;
+
+namespace reone {
+
+namespace game {
+
+static constexpr char kSignature[] = "RSAVV1.0";
+
+static int getBytesPerPixel(PixelFormat format) {
+    switch (format) {
+    case PixelFormat::R8:
+        return 1;
+    case PixelFormat::BGR8:
+        return 3;
+    case PixelFormat::BGRA8:
+        return 4;
+    default:
+        throw std::invalid_argument("Unsupported screenshot pixel format: " + std::to_string(static_cast<int>(format)));
+    }
+}
+
+void SavedGameCache::load() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pathToInfo.clear();
+    _dirty = false;
+
+    if (!std::filesystem::exists(_path)) {
+        return;
+    }
+    auto file = FileInputStream(_path);
+    auto buffer = ByteBuffer(file.length());
+    if (buffer.empty()) {
+        return;
+    }
+    file.read(&buffer[0], static_cast<int>(buffer.size()));
+
+    auto stream = MemoryInputStream(buffer);
+    auto reader = BinaryReader(stream);
+    auto readSized = [&reader, &buffer](size_t maxSize) {
+        uint32_t len = reader.readUint32();
+        if (len > maxSize || reader.position() + len > buffer.size()) {
+            throw ValidationException("Saved game cache record out of bounds");
+        }
+        return reader.readBytes(static_cast<int>(len));
+    };
+    try {
+        if (reader.readString(8) != std::string(kSignature)) {
+            throw ValidationException("Invalid saved game cache signature");
+        }
+        uint32_t numEntries = reader.readUint32();
+        for (uint32_t i = 0; i < numEntries; ++i) {
+            auto path = readSized(buffer.size());
+            auto cached = CachedInfo();
+            cached.stamp.size = reader.readUint64();
+            cached.stamp.modifiedAt = reader.readInt64();
+            auto lastModule = readSized(buffer.size());
+            cached.info.lastModule = std::string(lastModule.begin(), lastModule.end());
+            cached.info.screenWidth = reader.readUint16();
+            cached.info.screenHeight = reader.readUint16();
+            cached.info.screenFormat = static_cast<PixelFormat>(reader.readUint32());
+            cached.info.screenPixels = readSized(buffer.size());
+            size_t expectedSize = cached.info.screenPixels.empty()
+                                      ? 0
+                                      : static_cast<size_t>(getBytesPerPixel(cached.info.screenFormat)) * cached.info.screenWidth * cached.info.screenHeight;
+            if (cached.info.screenPixels.size() != expectedSize) {
+                throw ValidationException("Saved game cache screenshot size mismatch");
+            }
+            _pathToInfo[std::string(path.begin(), path.end())] = std::move(cached);
+        }
+    } catch (const std::exception &e) {
+        warn("Ignoring saved game cache: " + std::string(e.what()));
+        _pathToInfo.clear();
+    }
+}
+
+void SavedGameCache::save() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto it = _pathToInfo.begin(); it != _pathToInfo.end();) {
+        if (!it->second.used) {
+            it = _pathToInfo.erase(it);
+            _dirty = true;
+        } else {
+            // Entry must be used again before next save to survive it
+            it->second.used = false;
+            ++it;
+        }
+    }
+    if (!_dirty) {
+        return;
+    }
+
+    auto tmpPath = _path;
+    tmpPath += ".tmp";
+    {
+        auto out = FileOutputStream(tmpPath);
+        auto writer = BinaryWriter(out);
+        writer.writeString(kSignature);
+        writer.writeUint32(static_cast<uint32_t>(_pathToInfo.size()));
+        for (auto &[path, cached] : _pathToInfo) {
+            writer.writeUint32(static_cast<uint32_t>(path.size()));
+            writer.writeString(path);
+            writer.writeInt64(static_cast<int64_t>(cached.stamp.size));
+            writer.writeInt64(cached.stamp.modifiedAt);
+            writer.writeUint32(static_cast<uint32_t>(cached.info.lastModule.size()));
+            writer.writeString(cached.info.lastModule);
+            writer.writeUint16(static_cast<uint16_t>(cached.info.screenWidth));
+            writer.writeUint16(static_cast<uint16_t>(cached.info.screenHeight));
+            writer.writeUint32(static_cast<uint32_t>(cached.info.screenFormat));
+            writer.writeUint32(static_cast<uint32_t>(cached.info.screenPixels.size()));
+            writer.write(cached.info.screenPixels);
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, _path, ec);
+    if (ec) {
+        warn("Unable to save saved game cache: " + ec.message());
+        std::filesystem::remove(tmpPath, ec);
+        return;
+    }
+    _dirty = false;
+}
+
+std::optional<SavedGameInfo> SavedGameCache::find(const std::filesystem::path &savePath) {
+    auto stamp = stampFile(savePath);
+    if (!stamp) {
+        return std::nullopt;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _pathToInfo.find(savePath.string());
+    if (it == _pathToInfo.end() || !(it->second.stamp == *stamp)) {
+        return std::nullopt;
+    }
+    it->second.used = true;
+    return it->second.info;
+}
+
+void SavedGameCache::put(const std::filesystem::path &savePath, SavedGameInfo info) {
+    auto stamp = stampFile(savePath);
+    if (!stamp) {
+        return;
+    }
+    auto cached = CachedInfo();
+    cached.info = std::move(info);
+    cached.stamp = *stamp;
+    cached.used = true;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pathToInfo[savePath.string()] = std::move(cached);
+    _dirty = true;
+}
+
+std::optional<SavedGameCache::FileStamp> SavedGameCache::stampFile(const std::filesystem::path &path) const {
+    std::error_code ec;
+    auto size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    auto modifiedAt = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    auto stamp = FileStamp();
+    stamp.size = size;
+    stamp.modifiedAt = static_cast<int64_t>(modifiedAt.time_since_epoch().count());
+    return stamp;
+}
+
+void downscaleScreenshot(SavedGameInfo &info, int maxSize) {
+    if (info.screenPixels.empty()) {
+        return;
+    }
+    int factor = 1;
+    while (info.screenWidth / factor > maxSize || info.screenHeight / factor > maxSize) {
+        ++factor;
+    }
+    if (factor == 1) {
+        return;
+    }
+    int bpp = getBytesPerPixel(info.screenFormat);
+    int w = info.screenWidth / factor;
+    int h = info.screenHeight / factor;
+    auto pixels = ByteBuffer(static_cast<size_t>(bpp) * w * h);
+    int area = factor * factor;
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) {
+            for (int c = 0; c < bpp; ++c) {
+                int sum = 0;
+                for (int sy = 0; sy < factor; ++sy) {
+                    const char *row = &info.screenPixels[(static_cast<size_t>(y * factor + sy) * info.screenWidth + x * factor) * bpp];
+                    for (int sx = 0; sx < factor; ++sx) {
+                        sum += static_cast<uint8_t>(row[sx * bpp + c]);
+                    }
+                }
+                pixels[(static_cast<size_t>(y) * w + x) * bpp + c] = static_cast<char>(sum / area);
+            }
+        }
+    }
+    info.screenWidth = w;
+    info.screenHeight = h;
+    info.screenPixels = std::move(pixels);
+}
+
+} // namespace game
+
+} // namespace reone
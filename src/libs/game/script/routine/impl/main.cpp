@@ -32,7 +32,8 @@
 #include "reone/script/routine/exception/notimplemented.h"
 #include "reone/script/variable.h"
 #include "reone/system/logutil.h"
-#include "reone/system/randomutil.h"
+#include "reone/system/di/services.h"
+#include "reone/system/random.h"
 
 #define R_VOID script::VariableType::Void
 #define R_INT script::VariableType::Int
@@ -69,7 +70,7 @@ static Variable Random(const std::vector<Variable> &args, const RoutineContext &
     // Transform
 
     // Execute
-    return Variable::ofInt(randomInt(0, nMaxInteger - 1));
+    return Variable::ofInt(ctx.services.system.random.stream(RandomStream::Scripts).nextInt(0, nMaxInteger - 1));
 }
 
 static Variable PrintString(const std::vector<Variable> &args, const RoutineContext &ctx) {
@@ -859,7 +860,7 @@ static Variable d2(const std::vector<Variable> &args, const RoutineContext &ctx)
     // Execute
     int total = 0;
     for (int i = 0; i < numDice; ++i) {
-        total += reone::randomInt(1, 2);
+        total += ctx.services.system.random.stream(RandomStream::Scripts).nextInt(1, 2);
     }
     return Variable::ofInt(total);
 }
@@ -874,7 +875,7 @@ static Variable d3(const std::vector<Variable> &args, const RoutineContext &ctx)
     // Execute
     int total = 0;
     for (int i = 0; i < numDice; ++i) {
-        total += reone::randomInt(1, 3);
+        total += ctx.services.system.random.stream(RandomStream::Scripts).nextInt(1, 3);
     }
     return Variable::ofInt(total);
 }
@@ -889,7 +890,7 @@ static Variable d4(const std::vector<Variable> &args, const RoutineContext &ctx)
     // Execute
     int total = 0;
     for (int i = 0; i < numDice; ++i) {
-        total += reone::randomInt(1, 4);
+        total += ctx.services.system.random.stream(RandomStream::Scripts).nextInt(1, 4);
     }
     return Variable::ofInt(total);
 }
@@ -904,7 +905,7 @@ static Variable d6(const std::vector<Variable> &args, const RoutineContext &ctx)
     // Execute
     int total = 0;
     for (int i = 0; i < numDice; ++i) {
-        total += reone::randomInt(1, 6);
+        total += ctx.services.system.random.stream(RandomStream::Scripts).nextInt(1, 6);
     }
     return Variable::ofInt(total);
 }
@@ -919,7 +920,7 @@ static Variable d8(const std::vector<Variable> &args, const RoutineContext &ctx)
     // Execute
     int total = 0;
     for (int i = 0; i < numDice; ++i) {
-        total += reone::randomInt(1, 8);
+        total += ctx.services.system.random.stream(RandomStream::Scripts).nextInt(1, 8);
     }
     return Variable::ofInt(total);
 }
@@ -934,7 +935,7 @@ static Variable d10(const std::vector<Variable> &args, const RoutineContext &ctx
     // Execute
     int total = 0;
     for (int i = 0; i < numDice; ++i) {
-        total += reone::randomInt(1, 10);
+        total += ctx.services.system.random.stream(RandomStream::Scripts).nextInt(1, 10);
     }
     return Variable::ofInt(total);
 }
@@ -949,7 +950,7 @@ static Variable d12(const std::vector<Variable> &args, const RoutineContext &ctx
     // Execute
     int total = 0;
     for (int i = 0; i < numDice; ++i) {
-        total += reone::randomInt(1, 12);
+        total += ctx.services.system.random.stream(RandomStream::Scripts).nextInt(1, 12);
     }
     return Variable::ofInt(total);
 }
@@ -964,7 +965,7 @@ static Variable d20(const std::vector<Variable> &args, const RoutineContext &ctx
     // Execute
     int total = 0;
     for (int i = 0; i < numDice; ++i) {
-        total += reone::randomInt(1, 20);
+        total += ctx.services.system.random.stream(RandomStream::Scripts).nextInt(1, 20);
     }
     return Variable::ofInt(total);
 }
@@ -979,7 +980,7 @@ static Variable d100(const std::vector<Variable> &args, const RoutineContext &ct
     // Execute
     int total = 0;
     for (int i = 0; i < numDice; ++i) {
-        total += reone::randomInt(1, 100);
+        total += ctx.services.system.random.stream(RandomStream::Scripts).nextInt(1, 100);
     }
     return Variable::ofInt(total);
 }
@@ -1209,7 +1210,7 @@ static Variable SignalEvent(const std::vector<Variable> &args, const RoutineCont
     // Transform
 
     // Execute
-    debug(str(boost::format("Event signalled: %s %s") % oObject->tag() % evToRun->number()), LogChannel::Script);
+    R_LOG_DEBUG(LogChannel::Script, str(boost::format("Event signalled: %s %s") % oObject->tag() % evToRun->number()));
     ctx.game.scriptRunner().run(oObject->getOnUserDefined(), oObject->id(), kObjectInvalid, evToRun->number());
     return Variable::ofNull();
 }
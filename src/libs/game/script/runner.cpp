@@ -21,8 +21,6 @@
 #include "reone/resource/provider/scripts.h"
 #include "reone/script/executioncontext.h"
 #include "reone/script/routines.h"
-#include "reone/script/virtualmachine.h"
-
 
 using namespace reone::script;
 
@@ -49,7 +47,11 @@ int ScriptRunner::run(const std::string &resRef, uint32_t callerId, uint32_t tri
     ctx->userDefinedEventNumber = userDefinedEventNumber;
     ctx->scriptVar = scriptVar;
 
-    return VirtualMachine(program, std::move(ctx)).run();
+    return run(std::move(program), std::move(ctx));
+}
+
+int ScriptRunner::run(std::shared_ptr<ScriptProgram> program, std::unique_ptr<ExecutionContext> context) {
+    return _machines.run(std::move(program), std::move(context));
 }
 
 } // namespace game
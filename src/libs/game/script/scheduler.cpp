@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/game/script/scheduler.h"
+
+namespace reone {
+
+namespace game {
+
+void ScriptEventScheduler::update(float dt, const std::function<void(int)> &onPhaseDue) {
+    float phaseDuration = _interval / _numPhases;
+    _phaseTime += dt;
+    int numDue = 0;
+    while (_phaseTime >= phaseDuration) {
+        if (numDue == _numPhases) {
+            // Every phase is already due, drop the rest of the backlog
+            _phaseTime = std::fmod(_phaseTime, phaseDuration);
+            break;
+        }
+        _phaseTime -= phaseDuration;
+        onPhaseDue(_nextPhase);
+        _nextPhase = (_nextPhase + 1) % _numPhases;
+        ++numDue;
+    }
+}
+
+bool ScriptEventScheduler::enqueue(uint32_t callerId, std::string resRef) {
+    if (!_queuedCallers.insert(callerId).second) {
+        ++_numSkipped;
+        return false;
+    }
+    _queue.push_back(Event {callerId, std::move(resRef)});
+    _metrics.queueDepth = static_cast<int>(_queue.size());
+    _metrics.maxQueueDepth = std::max(_metrics.maxQueueDepth, _metrics.queueDepth);
+    return true;
+}
+
+void ScriptEventScheduler::dispatch(const std::function<void(const Event &)> &run) {
+    auto start = std::chrono::steady_clock::now();
+    auto maxTime = std::chrono::duration<float>(_maxTimePerFrame);
+    int numDispatched = 0;
+    while (!_queue.empty() && numDispatched < _maxEventsPerFrame) {
+        if (numDispatched > 0 && std::chrono::steady_clock::now() - start >= maxTime) {
+            break;
+        }
+        auto event = std::move(_queue.front());
+        _queue.pop_front();
+        _queuedCallers.erase(event.callerId);
+        run(event);
+        ++numDispatched;
+    }
+    _metrics.numDispatched = numDispatched;
+    _metrics.numCarriedOver = static_cast<int>(_queue.size());
+    _metrics.numSkipped = _numSkipped;
+    _metrics.queueDepth = static_cast<int>(_queue.size());
+    _numSkipped = 0;
+}
+
+void ScriptEventScheduler::clear() {
+    _queue.clear();
+    _queuedCallers.clear();
+    _numSkipped = 0;
+    _metrics.queueDepth = 0;
+}
+
+} // namespace game
+
+} // namespace reone
@@ -31,14 +31,20 @@ void Surfaces::init() {
     if (!surfacemat) {
         return;
     }
+    auto labelColumn = surfacemat->column("label");
+    auto walkColumn = surfacemat->column("walk");
+    auto walkcheckColumn = surfacemat->column("walkcheck");
+    auto lineOfSightColumn = surfacemat->column("lineofsight");
+    auto grassColumn = surfacemat->column("grass");
+    auto soundColumn = surfacemat->column("sound");
     for (int row = 0; row < surfacemat->getRowCount(); ++row) {
         Surface surface;
-        surface.label = surfacemat->getString(row, "label");
-        surface.walk = surfacemat->getBool(row, "walk");
-        surface.walkcheck = surfacemat->getBool(row, "walkcheck");
-        surface.lineOfSight = surfacemat->getBool(row, "lineofsight");
-        surface.grass = surfacemat->getBool(row, "grass");
-        surface.sound = surfacemat->getString(row, "sound");
+        surface.label = surfacemat->getString(row, labelColumn);
+        surface.walk = surfacemat->getBool(row, walkColumn);
+        surface.walkcheck = surfacemat->getBool(row, walkcheckColumn);
+        surface.lineOfSight = surfacemat->getBool(row, lineOfSightColumn);
+        surface.grass = surfacemat->getBool(row, grassColumn);
+        surface.sound = surfacemat->getString(row, soundColumn);
         _surfaces.push_back(std::move(surface));
     }
 }
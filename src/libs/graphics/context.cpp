@@ -17,6 +17,7 @@
 
 #include "reone/graphics/context.h"
 #include "reone/graphics/framebuffer.h"
+#include "reone/graphics/glutil.h"
 #include "reone/graphics/shaderprogram.h"
 #include "reone/graphics/texture.h"
 #include "reone/graphics/uniformbuffer.h"
@@ -38,7 +39,7 @@ static constexpr GLenum kColorAttachments[] {
     GL_COLOR_ATTACHMENT7};
 
 void Context::init() {
-    if (_inited) {
+    if (_inited || isHeadless()) {
         return;
     }
     checkMainThread();
@@ -17,11 +17,18 @@
 
 #include "reone/graphics/di/module.h"
 
+#include "reone/graphics/glutil.h"
+
 namespace reone {
 
 namespace graphics {
 
+static constexpr char kPBRCacheDirName[] = "pbrcache";
+static constexpr char kProgramBinaryCacheDirName[] = "shadercache";
+
 void GraphicsModule::init() {
+    setHeadless(_options.headless);
+
     _context = std::make_unique<Context>(_options);
     _statistic = std::make_unique<Statistic>();
     _meshRegistry = std::make_unique<MeshRegistry>(*_statistic);
@@ -34,6 +41,9 @@ void GraphicsModule::init() {
         *_shaderRegistry,
         *_statistic,
         *_uniforms);
+    _pbrCache = std::make_unique<PBRCache>(std::filesystem::current_path() / kPBRCacheDirName);
+    _pbrTextures->setCache(_pbrCache.get());
+    _programBinaryCache = std::make_unique<ProgramBinaryCache>(std::filesystem::current_path() / kProgramBinaryCacheDirName);
 
     _services = std::make_unique<GraphicsServices>(
         *_context,
@@ -48,12 +58,16 @@ void GraphicsModule::init() {
     _meshRegistry->init();
     _textureRegistry->init();
     _uniforms->init();
+    _pbrCache->init();
+    _programBinaryCache->init();
 }
 
 void GraphicsModule::deinit() {
     _services.reset();
 
     _pbrTextures.reset();
+    _pbrCache.reset();
+    _programBinaryCache.reset();
     _uniforms.reset();
     _meshRegistry.reset();
     _textureRegistry.reset();
@@ -33,7 +33,10 @@ void Font::load(std::shared_ptr<Texture> texture) {
 
     const Texture::Features &features = texture->features();
     _height = features.fontHeight * 100.0f;
+    _glyphs.clear();
     _glyphs.reserve(features.numChars);
+    _glyphRuns.clear();
+    _lineBreaks.clear();
 
     for (int i = 0; i < features.numChars; ++i) {
         glm::vec2 ul(features.upperLeftCoords[i]);
@@ -64,36 +67,38 @@ void Font::render(const std::string &text, const glm::vec3 &position, const glm:
         locals.color = glm::vec4(color, 1.0f);
     });
 
-    int numBlocks = static_cast<int>(text.size()) / kMaxTextChars;
-    if (text.size() % kMaxTextChars > 0) {
-        ++numBlocks;
-    }
-    glm::vec3 textOffset(getTextOffset(text, gravity), 0.0f);
-    for (int i = 0; i < numBlocks; ++i) {
-        int numChars = glm::min(kMaxTextChars, static_cast<int>(text.size()) - i * kMaxTextChars);
-        _uniforms.setText([this, &text, &position, &textOffset, &i, &numChars](auto &uniforms) {
+    auto run = getGlyphRun(text);
+    glm::vec2 origin(glm::vec2(position) + getTextOffset(run->width, gravity));
+    int numGlyphs = static_cast<int>(run->posScale.size());
+    for (int start = 0; start < numGlyphs; start += kMaxTextChars) {
+        int numChars = glm::min(kMaxTextChars, numGlyphs - start);
+        _uniforms.setText([&run, &origin, &start, &numChars](auto &uniforms) {
             for (int j = 0; j < numChars; ++j) {
-                const Glyph &glyph = _glyphs[static_cast<unsigned char>(text[i * kMaxTextChars + j])];
-
-                glm::vec4 posScale;
-                posScale[0] = position.x + textOffset.x;
-                posScale[1] = position.y + textOffset.y;
-                posScale[2] = glyph.size.x;
-                posScale[3] = glyph.size.y;
-
-                uniforms.chars[j].posScale = std::move(posScale);
-                uniforms.chars[j].uv = glm::vec4(glyph.ul.x, glyph.lr.y, glyph.lr.x - glyph.ul.x, glyph.ul.y - glyph.lr.y);
-
-                textOffset.x += glyph.size.x;
+                const glm::vec4 &posScale = run->posScale[start + j];
+                uniforms.chars[j].posScale = glm::vec4(origin.x + posScale[0], origin.y + posScale[1], posScale[2], posScale[3]);
+                uniforms.chars[j].uv = run->uv[start + j];
             }
         });
         _meshRegistry.get(MeshName::quad).drawInstanced(numChars, _statistic);
     }
 }
 
-glm::vec2 Font::getTextOffset(const std::string &text, TextGravity gravity) const {
-    float w = measure(text);
+std::shared_ptr<Font::GlyphRun> Font::getGlyphRun(const std::string &text) {
+    return _glyphRuns.getOrAdd(text, [this, &text]() {
+        auto run = std::make_shared<GlyphRun>();
+        run->posScale.reserve(text.size());
+        run->uv.reserve(text.size());
+        for (auto &ch : text) {
+            const Glyph &glyph = _glyphs[static_cast<unsigned char>(ch)];
+            run->posScale.push_back(glm::vec4(run->width, 0.0f, glyph.size.x, glyph.size.y));
+            run->uv.push_back(glm::vec4(glyph.ul.x, glyph.lr.y, glyph.lr.x - glyph.ul.x, glyph.ul.y - glyph.lr.y));
+            run->width += glyph.size.x;
+        }
+        return run;
+    });
+}
 
+glm::vec2 Font::getTextOffset(float w, TextGravity gravity) const {
     switch (gravity) {
     case TextGravity::LeftCenter:
         return glm::vec2(-w, -0.5f * _height);
@@ -17,6 +17,7 @@
 
 #include "reone/graphics/framebuffer.h"
 
+#include "reone/graphics/glutil.h"
 #include "reone/graphics/renderbuffer.h"
 #include "reone/graphics/texture.h"
 #include "reone/system/exception/notimplemented.h"
@@ -27,7 +28,7 @@ namespace reone {
 namespace graphics {
 
 void Framebuffer::init() {
-    if (_inited) {
+    if (_inited || isHeadless()) {
         return;
     }
     checkMainThread();
@@ -18,6 +18,7 @@
 #include "reone/graphics/mesh.h"
 
 #include "reone/graphics/barycentricutil.h"
+#include "reone/graphics/glutil.h"
 #include "reone/graphics/statistic.h"
 #include "reone/graphics/triangleutil.h"
 #include "reone/system/checkutil.h"
@@ -28,7 +29,7 @@ namespace reone {
 namespace graphics {
 
 void Mesh::init() {
-    if (_inited) {
+    if (_inited || isHeadless()) {
         return;
     }
     checkMainThread();
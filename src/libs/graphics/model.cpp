@@ -72,6 +72,18 @@ void Model::computeAABB() {
 
 void Model::init() {
     _rootNode->init();
+    resolveAnimations();
+}
+
+void Model::resolveAnimations() {
+    _resolvedAnimations = _animations;
+    if (_superModel) {
+        for (auto &name : _superModel->getAnimationNames()) {
+            // Animations of this model take precedence
+            _resolvedAnimations.emplace(name, _superModel->getAnimation(name));
+        }
+    }
+    _animationsResolved = true;
 }
 
 std::shared_ptr<ModelNode> Model::getNodeByNumber(uint16_t number) const {
@@ -121,6 +133,11 @@ std::vector<std::string> Model::getAnimationNames() const {
 }
 
 std::shared_ptr<Animation> Model::getAnimation(const std::string &name) const {
+    if (_animationsResolved) {
+        auto maybeResolved = _resolvedAnimations.find(name);
+        return maybeResolved != _resolvedAnimations.end() ? maybeResolved->second : nullptr;
+    }
+
     auto maybeAnim = _animations.find(name);
     if (maybeAnim != _animations.end())
         return maybeAnim->second;
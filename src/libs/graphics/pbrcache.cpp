@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/graphics/pbrcache.h"
+
+#include "reone/graphics/texture.h"
+#include "reone/system/logutil.h"
+#include "reone/system/threadutil.h"
+
+namespace reone {
+
+namespace graphics {
+
+static constexpr char kSignature[] = "RPBRV1.0";
+static constexpr int kSignatureSize = 8;
+
+static constexpr uint64_t kFNVOffsetBasis = 0xcbf29ce484222325ull;
+static constexpr uint64_t kFNVPrime = 0x100000001b3ull;
+
+static void hashBytes(uint64_t &hash, const void *data, size_t size) {
+    auto bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= kFNVPrime;
+    }
+}
+
+void PBRCache::init() {
+    if (_inited) {
+        return;
+    }
+    std::error_code ec;
+    std::filesystem::create_directories(_dir, ec);
+    _quit = false;
+    _worker = std::thread {std::bind(&PBRCache::work, this)};
+    _inited = true;
+}
+
+void PBRCache::deinit() {
+    if (!_inited) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _quit = true;
+    }
+    _condVar.notify_one();
+    _worker.join();
+    _inited = false;
+}
+
+std::future<PBRCache::Entry> PBRCache::load(std::string key) {
+    Job job;
+    job.key = std::move(key);
+    auto result = job.result.get_future();
+    enqueue(std::move(job));
+    return result;
+}
+
+std::future<PBRCache::Entry> PBRCache::loadEnvMapDerived(const Texture &envMap) {
+    Job job;
+    job.key = envMap.name();
+    job.hashKey = true;
+    job.keyHash = kFNVOffsetBasis;
+    int width = envMap.width();
+    int height = envMap.height();
+    auto format = static_cast<int>(envMap.pixelFormat());
+    hashBytes(job.keyHash, &width, sizeof(width));
+    hashBytes(job.keyHash, &height, sizeof(height));
+    hashBytes(job.keyHash, &format, sizeof(format));
+    for (auto &layer : envMap.layers()) {
+        if (layer.pixels) {
+            job.keyData.push_back(layer.pixels);
+        }
+    }
+    auto result = job.result.get_future();
+    enqueue(std::move(job));
+    return result;
+}
+
+void PBRCache::save(std::string key, std::shared_ptr<ByteBuffer> data) {
+    Job job;
+    job.key = std::move(key);
+    job.data = std::move(data);
+    job.write = true;
+    enqueue(std::move(job));
+}
+
+void PBRCache::enqueue(Job job) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _jobs.push_back(std::move(job));
+    }
+    _condVar.notify_one();
+}
+
+void PBRCache::work() {
+    setThreadName("pbrcache");
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condVar.wait(lock, [this]() { return _quit || !_jobs.empty(); });
+            if (_jobs.empty()) {
+                // Pending writes are flushed before quitting
+                return;
+            }
+            job = std::move(_jobs.front());
+            _jobs.pop_front();
+        }
+        if (job.hashKey) {
+            for (auto &data : job.keyData) {
+                hashBytes(job.keyHash, data->data(), data->size());
+            }
+            job.key = str(boost::format("%s_%016x") % job.key % job.keyHash);
+        }
+        if (job.write) {
+            write(job.key, *job.data);
+        } else {
+            auto data = read(job.key);
+            job.result.set_value(Entry {std::move(job.key), std::move(data)});
+        }
+    }
+}
+
+std::shared_ptr<ByteBuffer> PBRCache::read(const std::string &key) const {
+    auto path = getPath(key);
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream) {
+        return nullptr;
+    }
+    std::error_code ec;
+    auto fileSize = std::filesystem::file_size(path, ec);
+    char signature[kSignatureSize];
+    uint32_t size = 0;
+    stream.read(signature, kSignatureSize);
+    stream.read(reinterpret_cast<char *>(&size), sizeof(size));
+    if (ec || !stream || std::memcmp(signature, kSignature, kSignatureSize) != 0) {
+        return nullptr;
+    }
+    // Reject corrupted or truncated files before allocating
+    if (size == 0 || fileSize != kSignatureSize + sizeof(size) + size) {
+        return nullptr;
+    }
+    auto data = std::make_shared<ByteBuffer>(size);
+    stream.read(&(*data)[0], size);
+    if (static_cast<uint32_t>(stream.gcount()) != size) {
+        return nullptr;
+    }
+    return data;
+}
+
+void PBRCache::write(const std::string &key, const ByteBuffer &data) const {
+    if (data.empty()) {
+        return;
+    }
+    auto path = getPath(key);
+    auto tmpPath = path;
+    tmpPath += ".tmp";
+    {
+        std::ofstream stream(tmpPath, std::ios::binary);
+        if (!stream) {
+            warn("Unable to write PBR cache file: " + path.string());
+            return;
+        }
+        uint32_t size = static_cast<uint32_t>(data.size());
+        stream.write(kSignature, kSignatureSize);
+        stream.write(reinterpret_cast<const char *>(&size), sizeof(size));
+        stream.write(&data[0], size);
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, path, ec);
+}
+
+std::filesystem::path PBRCache::getPath(const std::string &key) const {
+    return _dir / (key + ".bin");
+}
+
+} // namespace graphics
+
+} // namespace reone
@@ -19,6 +19,7 @@
 
 #include "reone/graphics/context.h"
 #include "reone/graphics/meshregistry.h"
+#include "reone/graphics/pbrcache.h"
 #include "reone/graphics/shaderregistry.h"
 #include "reone/graphics/textureutil.h"
 #include "reone/graphics/uniforms.h"
@@ -30,6 +31,12 @@ static constexpr int kPrefilteredTextureSize = 128;
 static constexpr int kNumPrefilteredMipMaps = 5;
 static constexpr int kMaxEnvMapDerivedLayers = 16;
 
+static constexpr char kBRDFCacheKey[] = "brdf_lut";
+static constexpr int kBRDFBytesPerPixel = 2 * 4;
+static constexpr int kDerivedBytesPerPixel = 3;
+
+static const reone::graphics::UniformHandle kRoughnessUniform("uRoughness");
+
 static const glm::mat4 kCubeMapProjection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 10.0f);
 static const glm::mat4 kCubeMapViews[] {
     glm::lookAt(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f)),
@@ -44,6 +51,15 @@ namespace reone {
 
 namespace graphics {
 
+static size_t getEnvMapDerivedSize() {
+    size_t size = kNumCubeFaces * kIrradianceTextureSize * kIrradianceTextureSize * kDerivedBytesPerPixel;
+    for (int mip = 0; mip < kNumPrefilteredMipMaps; ++mip) {
+        int w = kPrefilteredTextureSize >> mip;
+        size += kNumCubeFaces * w * w * kDerivedBytesPerPixel;
+    }
+    return size;
+}
+
 void PBRTextures::refresh() {
     if (!_brdfLUT) {
         initBRDFLUT();
@@ -54,21 +70,63 @@ void PBRTextures::refresh() {
     if (!_prefilteredEnvMapArray) {
         initPrefilteredEnvMapArray();
     }
-    if (!_envMapDerivedRequests.empty()) {
-        auto &request = *_envMapDerivedRequests.begin();
-        refreshEnvMapDerived(request);
-        _envMapDerivedRequests.erase(request);
+    if (_pendingEnvMapDerived) {
+        auto &pending = *_pendingEnvMapDerived;
+        if (pending.cached.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return;
+        }
+        auto cached = pending.cached.get();
+        refreshEnvMapDerived(*pending.envMap, cached.key, cached.data);
+        _pendingEnvMapDerived.reset();
+    }
+    while (!_envMapDerivedRequests.empty()) {
+        auto envMap = _envMapDerivedRequests.begin()->texture;
+        _envMapDerivedRequests.erase(_envMapDerivedRequests.begin());
+        if (_envMapToDerivedLayer.count(envMap->name()) > 0) {
+            continue;
+        }
+        if (_cache) {
+            requestCachedEnvMapDerived(std::move(envMap));
+        } else {
+            refreshEnvMapDerived(*envMap, "", nullptr);
+        }
+        break;
     }
 }
 
+void PBRTextures::requestCachedEnvMapDerived(std::shared_ptr<Texture> envMap) {
+    PendingEnvMapDerived pending;
+    pending.cached = _cache->loadEnvMapDerived(*envMap);
+    pending.envMap = std::move(envMap);
+    _pendingEnvMapDerived = std::move(pending);
+}
+
 void PBRTextures::initBRDFLUT() {
     _brdfLUT = std::make_unique<Texture>(
         "pbr_color_buffer",
         TextureType::TwoDim,
         getTextureProperties(TextureUsage::ColorBuffer));
+
+    std::shared_ptr<ByteBuffer> cached;
+    if (_cache) {
+        cached = _cache->load(kBRDFCacheKey).get().data;
+    }
+    if (cached && cached->size() == kBRDFTextureSize * kBRDFTextureSize * kBRDFBytesPerPixel) {
+        _brdfLUT->setPixels(kBRDFTextureSize, kBRDFTextureSize, PixelFormat::RG16F, Texture::Layer {std::move(cached)});
+        _brdfLUT->init();
+        return;
+    }
     _brdfLUT->clear(kBRDFTextureSize, kBRDFTextureSize, PixelFormat::RG16F);
     _brdfLUT->init();
+    renderBRDFLUT();
 
+    if (_cache) {
+        _brdfLUT->flushGPUToCPU();
+        _cache->save(kBRDFCacheKey, _brdfLUT->layers().front().pixels);
+    }
+}
+
+void PBRTextures::renderBRDFLUT() {
     _brdfDepthBuffer = std::make_unique<Renderbuffer>();
     _brdfDepthBuffer->configure(kBRDFTextureSize, kBRDFTextureSize, PixelFormat::Depth24);
     _brdfDepthBuffer->init();
@@ -139,24 +197,72 @@ void PBRTextures::initPrefilteredEnvMapArray() {
     _prefilterFramebuffer->init();
 }
 
-void PBRTextures::refreshEnvMapDerived(const EnvMapDerivedRequest &request) {
-    refreshIrradianceMap(request, _envMapDerivedLayer);
-    refreshPrefilteredEnvMap(request, _envMapDerivedLayer);
-    _envMapToDerivedLayer.insert({request.texture.name(), _envMapDerivedLayer});
+void PBRTextures::refreshEnvMapDerived(Texture &envMap, const std::string &cacheKey, const std::shared_ptr<ByteBuffer> &cached) {
+    int layer = _envMapDerivedLayer;
+    if (!cached || !loadEnvMapDerived(*cached, layer)) {
+        std::unique_ptr<ByteBuffer> readback;
+        if (_cache) {
+            readback = std::make_unique<ByteBuffer>();
+            readback->reserve(getEnvMapDerivedSize());
+        }
+        refreshIrradianceMap(envMap, layer, readback.get());
+        refreshPrefilteredEnvMap(envMap, layer, readback.get());
+        if (readback) {
+            _cache->save(cacheKey, std::make_shared<ByteBuffer>(std::move(*readback)));
+        }
+    }
+    _envMapToDerivedLayer.insert({envMap.name(), layer});
     if (++_envMapDerivedLayer == kMaxEnvMapDerivedLayers) {
         _envMapDerivedLayer = 0;
     }
 }
 
-void PBRTextures::refreshIrradianceMap(const EnvMapDerivedRequest &request, int layer) {
+static void readFramebufferPixels(int w, int h, ByteBuffer &readback) {
+    size_t offset = readback.size();
+    readback.resize(offset + w * h * kDerivedBytesPerPixel);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, w, h, GL_RGB, GL_UNSIGNED_BYTE, &readback[offset]);
+}
+
+bool PBRTextures::loadEnvMapDerived(const ByteBuffer &cached, int layer) {
+    if (cached.size() != getEnvMapDerivedSize()) {
+        return false;
+    }
+    const char *pixels = cached.data();
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    _context.bindTexture(*_irradianceMapArray, TextureUnits::irradianceMapArray);
+    for (int i = 0; i < kNumCubeFaces; ++i) {
+        glTexSubImage3D(GL_TEXTURE_CUBE_MAP_ARRAY, 0, 0, 0, kNumCubeFaces * layer + i, kIrradianceTextureSize, kIrradianceTextureSize, 1, GL_RGB, GL_UNSIGNED_BYTE, pixels);
+        pixels += kIrradianceTextureSize * kIrradianceTextureSize * kDerivedBytesPerPixel;
+    }
+
+    _context.bindTexture(*_prefilteredEnvMapArray, TextureUnits::prefilteredEnvMapArray);
+    for (int mip = 0; mip < kNumPrefilteredMipMaps; ++mip) {
+        int w = kPrefilteredTextureSize >> mip;
+        for (int i = 0; i < kNumCubeFaces; ++i) {
+            glTexSubImage3D(GL_TEXTURE_CUBE_MAP_ARRAY, mip, 0, 0, kNumCubeFaces * layer + i, w, w, 1, GL_RGB, GL_UNSIGNED_BYTE, pixels);
+            pixels += w * w * kDerivedBytesPerPixel;
+        }
+    }
+    glGenerateMipmap(GL_TEXTURE_CUBE_MAP_ARRAY);
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    return true;
+}
+
+void PBRTextures::refreshIrradianceMap(Texture &envMap, int layer, ByteBuffer *readback) {
     _context.bindDrawFramebuffer(*_irradianceFramebuffer, {0});
+    if (readback) {
+        _context.bindReadFramebuffer(*_irradianceFramebuffer, 0);
+    }
     auto &shader = _shaderRegistry.get(ShaderProgramId::pbrIrradiance);
     _context.useProgram(shader);
-    _context.bindTexture(request.texture, TextureUnits::envMapCube);
+    _context.bindTexture(envMap, TextureUnits::envMapCube);
     _uniforms.setLocals([](auto &locals) {
         locals.reset();
     });
-    _context.withViewport(glm::ivec4 {0, 0, kIrradianceTextureSize, kIrradianceTextureSize}, [this, &layer]() {
+    _context.withViewport(glm::ivec4 {0, 0, kIrradianceTextureSize, kIrradianceTextureSize}, [this, &layer, &readback]() {
         for (int i = 0; i < kNumCubeFaces; ++i) {
             _irradianceFramebuffer->attachTextureLayer(*_irradianceMapArray, kNumCubeFaces * layer + i, 0, Framebuffer::Attachment::Color);
             _uniforms.setGlobals([&i](auto &globals) {
@@ -166,23 +272,32 @@ void PBRTextures::refreshIrradianceMap(const EnvMapDerivedRequest &request, int
             });
             _context.clearColorDepth();
             _meshRegistry.get(MeshName::cubemap).draw(_statistic);
+            if (readback) {
+                readFramebufferPixels(kIrradianceTextureSize, kIrradianceTextureSize, *readback);
+            }
         }
     });
     _context.resetDrawFramebuffer();
+    if (readback) {
+        _context.resetReadFramebuffer();
+    }
 }
 
-void PBRTextures::refreshPrefilteredEnvMap(const EnvMapDerivedRequest &request, int layer) {
+void PBRTextures::refreshPrefilteredEnvMap(Texture &envMap, int layer, ByteBuffer *readback) {
     _context.bindDrawFramebuffer(*_prefilterFramebuffer, {0});
+    if (readback) {
+        _context.bindReadFramebuffer(*_prefilterFramebuffer, 0);
+    }
     auto &shader = _shaderRegistry.get(ShaderProgramId::pbrPrefilter);
     _context.useProgram(shader);
-    _context.bindTexture(request.texture, TextureUnits::envMapCube);
+    _context.bindTexture(envMap, TextureUnits::envMapCube);
     _uniforms.setLocals([](auto &locals) {
         locals.reset();
     });
     for (int mip = 0; mip < kNumPrefilteredMipMaps; ++mip) {
         int w = static_cast<int>(kPrefilteredTextureSize * std::pow(0.5, mip));
         int h = static_cast<int>(kPrefilteredTextureSize * std::pow(0.5, mip));
-        _context.withViewport(glm::ivec4 {0, 0, w, h}, [this, &request, &layer, &shader, &mip]() {
+        _context.withViewport(glm::ivec4 {0, 0, w, h}, [this, &layer, &shader, &mip, &w, &h, &readback]() {
             for (int i = 0; i < kNumCubeFaces; ++i) {
                 _irradianceFramebuffer->attachTextureLayer(*_prefilteredEnvMapArray, kNumCubeFaces * layer + i, mip, Framebuffer::Attachment::Color);
                 _irradianceFramebuffer->attachRenderbuffer(*_prefilterDepthBuffers[mip], Framebuffer::Attachment::Depth);
@@ -192,17 +307,22 @@ void PBRTextures::refreshPrefilteredEnvMap(const EnvMapDerivedRequest &request,
                     globals.view = kCubeMapViews[i];
                 });
                 float roughness = mip / static_cast<float>(kNumPrefilteredMipMaps - 1);
-                shader.setUniform("uRoughness", mip);
+                shader.setUniform(kRoughnessUniform, mip);
                 _context.clearColorDepth();
                 _meshRegistry.get(MeshName::cubemap).draw(_statistic);
+                if (readback) {
+                    readFramebufferPixels(w, h, *readback);
+                }
             }
         });
     }
     _context.resetDrawFramebuffer();
+    if (readback) {
+        _context.resetReadFramebuffer();
+    }
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP_ARRAY, _prefilteredEnvMapArray->nameGL());
+    _context.bindTexture(*_prefilteredEnvMapArray, TextureUnits::prefilteredEnvMapArray);
     glGenerateMipmap(GL_TEXTURE_CUBE_MAP_ARRAY);
-    glBindTexture(GL_TEXTURE_CUBE_MAP_ARRAY, 0);
 }
 
 } // namespace graphics
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/graphics/programbinarycache.h"
+
+#include "reone/graphics/glutil.h"
+#include "reone/system/logutil.h"
+
+namespace reone {
+
+namespace graphics {
+
+static constexpr char kSignature[] = "RPRGV1.0";
+static constexpr int kSignatureSize = 8;
+
+static constexpr uint64_t kFNVOffsetBasis = 0xcbf29ce484222325ull;
+static constexpr uint64_t kFNVPrime = 0x100000001b3ull;
+
+static void hashBytes(uint64_t &hash, const void *data, size_t size) {
+    auto bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= kFNVPrime;
+    }
+}
+
+static std::string getGLString(GLenum name) {
+    auto value = reinterpret_cast<const char *>(glGetString(name));
+    return value ? value : "";
+}
+
+void ProgramBinaryCache::init() {
+    if (isHeadless()) {
+        return;
+    }
+    GLint numFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+    _supported = numFormats > 0;
+    _driver = getGLString(GL_VENDOR) + "|" + getGLString(GL_RENDERER) + "|" + getGLString(GL_VERSION);
+    if (!_supported) {
+        info("Shader program binaries are not supported by the driver");
+        return;
+    }
+    std::error_code ec;
+    std::filesystem::create_directories(_dir, ec);
+}
+
+std::optional<ProgramBinaryCache::Binary> ProgramBinaryCache::load(const std::string &key) const {
+    std::ifstream stream(getPath(key), std::ios::binary);
+    if (!stream) {
+        return std::nullopt;
+    }
+    char signature[kSignatureSize];
+    Binary binary;
+    uint32_t size = 0;
+    stream.read(signature, kSignatureSize);
+    stream.read(reinterpret_cast<char *>(&binary.format), sizeof(binary.format));
+    stream.read(reinterpret_cast<char *>(&size), sizeof(size));
+    if (!stream || std::memcmp(signature, kSignature, kSignatureSize) != 0 || size == 0) {
+        return std::nullopt;
+    }
+    binary.data.resize(size);
+    stream.read(&binary.data[0], size);
+    if (static_cast<uint32_t>(stream.gcount()) != size) {
+        return std::nullopt;
+    }
+    return binary;
+}
+
+void ProgramBinaryCache::save(const std::string &key, const Binary &binary) const {
+    if (binary.data.empty()) {
+        return;
+    }
+    auto path = getPath(key);
+    auto tmpPath = path;
+    tmpPath += ".tmp";
+    {
+        std::ofstream stream(tmpPath, std::ios::binary);
+        if (!stream) {
+            warn("Unable to write shader program binary: " + path.string());
+            return;
+        }
+        uint32_t size = static_cast<uint32_t>(binary.data.size());
+        stream.write(kSignature, kSignatureSize);
+        stream.write(reinterpret_cast<const char *>(&binary.format), sizeof(binary.format));
+        stream.write(reinterpret_cast<const char *>(&size), sizeof(size));
+        stream.write(&binary.data[0], size);
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, path, ec);
+}
+
+std::filesystem::path ProgramBinaryCache::getPath(const std::string &key) const {
+    return _dir / (key + ".bin");
+}
+
+std::string ProgramBinaryCache::getKey(const std::vector<std::string> &sources, const std::string &driver) {
+    uint64_t hash = kFNVOffsetBasis;
+    hashBytes(hash, driver.data(), driver.size());
+    for (auto &source : sources) {
+        // Separate sources, so that moving text between them changes the key
+        uint64_t size = source.size();
+        hashBytes(hash, &size, sizeof(size));
+        hashBytes(hash, source.data(), source.size());
+    }
+    return str(boost::format("%016x") % hash);
+}
+
+} // namespace graphics
+
+} // namespace reone
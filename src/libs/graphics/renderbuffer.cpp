@@ -17,6 +17,7 @@
 
 #include "reone/graphics/renderbuffer.h"
 
+#include "reone/graphics/glutil.h"
 #include "reone/graphics/pixelutil.h"
 #include "reone/system/threadutil.h"
 
@@ -25,7 +26,7 @@ namespace reone {
 namespace graphics {
 
 void Renderbuffer::init() {
-    if (_inited) {
+    if (_inited || isHeadless()) {
         return;
     }
     checkMainThread();
@@ -17,6 +17,7 @@
 
 #include "reone/graphics/shader.h"
 
+#include "reone/graphics/glutil.h"
 #include "reone/system/threadutil.h"
 
 namespace reone {
@@ -37,7 +38,7 @@ static GLenum getShaderTypeGL(ShaderType type) {
 }
 
 void Shader::init() {
-    if (_inited) {
+    if (_inited || isHeadless()) {
         return;
     }
     checkMainThread();
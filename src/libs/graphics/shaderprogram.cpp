@@ -17,21 +17,85 @@
 
 #include "reone/graphics/shaderprogram.h"
 
+#include "reone/graphics/glutil.h"
+#include "reone/graphics/programbinarycache.h"
 #include "reone/graphics/types.h"
+#include "reone/system/logutil.h"
 #include "reone/system/threadutil.h"
 
 namespace reone {
 
 namespace graphics {
 
+namespace {
+
+class UniformNames : boost::noncopyable {
+public:
+    static UniformNames &instance() {
+        static UniformNames names;
+        return names;
+    }
+
+    int intern(const std::string &name) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _idByName.find(name);
+        if (it != _idByName.end()) {
+            return it->second;
+        }
+        int id = static_cast<int>(_names.size());
+        _names.push_back(std::make_unique<std::string>(name));
+        _idByName.insert(std::make_pair(name, id));
+        return id;
+    }
+
+    const std::string &get(int id) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return *_names[id];
+    }
+
+private:
+    std::vector<std::unique_ptr<std::string>> _names;
+    std::unordered_map<std::string, int> _idByName;
+    std::mutex _mutex;
+};
+
+} // namespace
+
+UniformHandle::UniformHandle(const std::string &name) :
+    _id(UniformNames::instance().intern(name)) {
+}
+
+const std::string &UniformHandle::name() const {
+    return UniformNames::instance().get(_id);
+}
+
 void ShaderProgram::init() {
-    if (_inited) {
+    if (_inited || isHeadless()) {
         return;
     }
     checkMainThread();
 
+    std::string binaryKey;
+    if (_binaryCache && _binaryCache->isSupported()) {
+        std::vector<std::string> sources;
+        for (auto &shader : _shaders) {
+            sources.push_back(std::to_string(static_cast<int>(shader->type())));
+            sources.insert(sources.end(), shader->sources().begin(), shader->sources().end());
+        }
+        binaryKey = ProgramBinaryCache::getKey(sources, _binaryCache->driver());
+        if (initFromBinaryCache(binaryKey)) {
+            reflectUniforms();
+            _inited = true;
+            return;
+        }
+    }
+
     _nameGL = glCreateProgram();
+    if (!binaryKey.empty()) {
+        glProgramParameteri(_nameGL, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
     for (auto &shader : _shaders) {
+        shader->init();
         glAttachShader(_nameGL, shader->nameGL());
     }
     glLinkProgram(_nameGL);
@@ -44,10 +108,86 @@ void ShaderProgram::init() {
         glGetProgramInfoLog(_nameGL, sizeof(log), &logSize, log);
         throw std::runtime_error("Failed linking shader program: " + std::string(log, logSize));
     }
+    if (!binaryKey.empty()) {
+        saveToBinaryCache(binaryKey);
+    }
+    reflectUniforms();
 
     _inited = true;
 }
 
+bool ShaderProgram::initFromBinaryCache(const std::string &key) {
+    auto binary = _binaryCache->load(key);
+    if (!binary) {
+        return false;
+    }
+    _nameGL = glCreateProgram();
+    glProgramBinary(_nameGL, binary->format, &binary->data[0], static_cast<GLsizei>(binary->data.size()));
+    GLint success;
+    glGetProgramiv(_nameGL, GL_LINK_STATUS, &success);
+    if (!success) {
+        // Driver rejected the binary, e.g. after an update - recompile from source
+        debug("Cached shader program binary rejected: " + key, LogChannel::Graphics);
+        glDeleteProgram(_nameGL);
+        _nameGL = 0;
+        return false;
+    }
+    return true;
+}
+
+void ShaderProgram::saveToBinaryCache(const std::string &key) {
+    GLint length = 0;
+    glGetProgramiv(_nameGL, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return;
+    }
+    ProgramBinaryCache::Binary binary;
+    binary.data.resize(length);
+    GLenum format = 0;
+    GLsizei actualLength = 0;
+    glGetProgramBinary(_nameGL, length, &actualLength, &format, &binary.data[0]);
+    binary.data.resize(actualLength);
+    binary.format = format;
+    _binaryCache->save(key, binary);
+}
+
+void ShaderProgram::reflectUniforms() {
+    _uniforms.clear();
+    _uniformIdxByName.clear();
+    _uniformIdxByHandle.clear();
+
+    GLint numUniforms = 0;
+    GLint maxNameLength = 0;
+    glGetProgramiv(_nameGL, GL_ACTIVE_UNIFORMS, &numUniforms);
+    glGetProgramiv(_nameGL, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+    if (numUniforms <= 0) {
+        return;
+    }
+
+    std::string name(std::max(maxNameLength, 1), '\0');
+    for (GLint i = 0; i < numUniforms; ++i) {
+        GLsizei nameLength = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(_nameGL, i, static_cast<GLsizei>(name.size()), &nameLength, &size, &type, &name[0]);
+        auto uniformName = name.substr(0, nameLength);
+        auto location = glGetUniformLocation(_nameGL, uniformName.c_str());
+        if (location == -1) {
+            // Uniform block member
+            continue;
+        }
+        int index = static_cast<int>(_uniforms.size());
+        Uniform uniform;
+        uniform.location = location;
+        _uniforms.push_back(std::move(uniform));
+        _uniformIdxByName.insert(std::make_pair(uniformName, index));
+        // Arrays are reported by name of their first element
+        if (boost::ends_with(uniformName, "[0]")) {
+            _uniformIdxByName.insert(std::make_pair(uniformName.substr(0, uniformName.size() - 3), index));
+        }
+    }
+}
+
 void ShaderProgram::deinit() {
     if (!_inited) {
         return;
@@ -55,6 +195,9 @@ void ShaderProgram::deinit() {
     checkMainThread();
     glDeleteProgram(_nameGL);
     _shaders.clear();
+    _uniforms.clear();
+    _uniformIdxByName.clear();
+    _uniformIdxByHandle.clear();
     _inited = false;
 }
 
@@ -70,68 +213,132 @@ void ShaderProgram::bindUniformBlock(const std::string &name, int bindingPoint)
     glUniformBlockBinding(_nameGL, blockIdx, bindingPoint);
 }
 
+int ShaderProgram::getUniformIndex(const UniformHandle &handle) {
+    int id = handle.id();
+    if (id >= static_cast<int>(_uniformIdxByHandle.size())) {
+        _uniformIdxByHandle.resize(id + 1, kUnresolvedUniform);
+    }
+    auto &index = _uniformIdxByHandle[id];
+    if (index == kUnresolvedUniform) {
+        index = getUniformIndex(handle.name());
+    }
+    return index;
+}
+
+int ShaderProgram::getUniformIndex(const std::string &name) const {
+    auto it = _uniformIdxByName.find(name);
+    return it != _uniformIdxByName.end() ? it->second : kMissingUniform;
+}
+
+void ShaderProgram::setUniform(const UniformHandle &handle, int value) {
+    setUniformValue(getUniformIndex(handle), value, [&value](int loc) {
+        glUniform1i(loc, value);
+    });
+}
+
+void ShaderProgram::setUniform(const UniformHandle &handle, float value) {
+    setUniformValue(getUniformIndex(handle), value, [&value](int loc) {
+        glUniform1f(loc, value);
+    });
+}
+
+void ShaderProgram::setUniform(const UniformHandle &handle, const glm::vec2 &v) {
+    setUniformValue(getUniformIndex(handle), v, [&v](int loc) {
+        glUniform2f(loc, v.x, v.y);
+    });
+}
+
+void ShaderProgram::setUniform(const UniformHandle &handle, const glm::vec3 &v) {
+    setUniformValue(getUniformIndex(handle), v, [&v](int loc) {
+        glUniform3f(loc, v.x, v.y, v.z);
+    });
+}
+
+void ShaderProgram::setUniform(const UniformHandle &handle, const glm::vec4 &v) {
+    setUniformValue(getUniformIndex(handle), v, [&v](int loc) {
+        glUniform4f(loc, v.x, v.y, v.z, v.w);
+    });
+}
+
+void ShaderProgram::setUniform(const UniformHandle &handle, const glm::mat4 &m) {
+    setUniformValue(getUniformIndex(handle), m, [&m](int loc) {
+        glUniformMatrix4fv(loc, 1, GL_FALSE, glm::value_ptr(m));
+    });
+}
+
+void ShaderProgram::setUniform(const UniformHandle &handle, const std::vector<glm::vec4> &arr) {
+    setUniformArray(getUniformIndex(handle), [&arr](int loc) {
+        glUniform4fv(loc, static_cast<GLsizei>(arr.size()), reinterpret_cast<const GLfloat *>(&arr[0]));
+    });
+}
+
+void ShaderProgram::setUniform(const UniformHandle &handle, const std::vector<glm::mat4> &arr) {
+    setUniformArray(getUniformIndex(handle), [&arr](int loc) {
+        glUniformMatrix4fv(loc, static_cast<GLsizei>(arr.size()), GL_FALSE, reinterpret_cast<const GLfloat *>(&arr[0]));
+    });
+}
+
 void ShaderProgram::setUniform(const std::string &name, int value) {
-    setUniform(name, [this, &value](int loc) {
+    setUniformValue(getUniformIndex(name), value, [&value](int loc) {
         glUniform1i(loc, value);
     });
 }
 
 void ShaderProgram::setUniform(const std::string &name, float value) {
-    setUniform(name, [this, &value](int loc) {
+    setUniformValue(getUniformIndex(name), value, [&value](int loc) {
         glUniform1f(loc, value);
     });
 }
 
 void ShaderProgram::setUniform(const std::string &name, const glm::vec2 &v) {
-    setUniform(name, [this, &v](int loc) {
+    setUniformValue(getUniformIndex(name), v, [&v](int loc) {
         glUniform2f(loc, v.x, v.y);
     });
 }
 
 void ShaderProgram::setUniform(const std::string &name, const glm::vec3 &v) {
-    setUniform(name, [this, &v](int loc) {
+    setUniformValue(getUniformIndex(name), v, [&v](int loc) {
         glUniform3f(loc, v.x, v.y, v.z);
     });
 }
 
 void ShaderProgram::setUniform(const std::string &name, const glm::vec4 &v) {
-    setUniform(name, [this, &v](int loc) {
+    setUniformValue(getUniformIndex(name), v, [&v](int loc) {
         glUniform4f(loc, v.x, v.y, v.z, v.w);
     });
 }
 
 void ShaderProgram::setUniform(const std::string &name, const glm::mat4 &m) {
-    setUniform(name, [this, &m](int loc) {
+    setUniformValue(getUniformIndex(name), m, [&m](int loc) {
         glUniformMatrix4fv(loc, 1, GL_FALSE, glm::value_ptr(m));
     });
 }
 
 void ShaderProgram::setUniform(const std::string &name, const std::vector<glm::vec4> &arr) {
-    setUniform(name, [this, &arr](int loc) {
+    setUniformArray(getUniformIndex(name), [&arr](int loc) {
         glUniform4fv(loc, static_cast<GLsizei>(arr.size()), reinterpret_cast<const GLfloat *>(&arr[0]));
     });
 }
 
 void ShaderProgram::setUniform(const std::string &name, const std::vector<glm::mat4> &arr) {
-    setUniform(name, [this, &arr](int loc) {
+    setUniformArray(getUniformIndex(name), [&arr](int loc) {
         glUniformMatrix4fv(loc, static_cast<GLsizei>(arr.size()), GL_FALSE, reinterpret_cast<const GLfloat *>(&arr[0]));
     });
 }
 
 void ShaderProgram::setUniform(const std::string &name, const std::function<void(int)> &setter) {
-    GLint location;
-
-    auto maybeLocation = _uniformLocations.find(name);
-    if (maybeLocation != _uniformLocations.end()) {
-        location = maybeLocation->second;
-    } else {
-        location = glGetUniformLocation(_nameGL, name.c_str());
-        _uniformLocations.insert(std::make_pair(name, location));
-    }
+    setUniformArray(getUniformIndex(name), setter);
+}
 
-    if (location != -1) {
-        setter(location);
+void ShaderProgram::setUniformArray(int index, const std::function<void(int)> &setter) {
+    if (index < 0) {
+        return;
     }
+    // Value is unknown, so the next write of a single value must not be skipped
+    auto &uniform = _uniforms[index];
+    uniform.value.invalidate();
+    setter(uniform.location);
+    R_TRACE_COUNT(UniformUpdates, 1);
 }
 
 } // namespace graphics
@@ -17,10 +17,12 @@
 
 #include "reone/graphics/texture.h"
 
+#include "reone/graphics/glutil.h"
 #include "reone/graphics/pixelutil.h"
 #include "reone/graphics/textureutil.h"
 #include "reone/system/exception/notimplemented.h"
 #include "reone/system/threadutil.h"
+#include "reone/system/tracer.h"
 
 namespace reone {
 
@@ -111,7 +113,7 @@ static uint32_t getFilterGL(Texture::Filtering filter) {
 }
 
 void Texture::init() {
-    if (_inited) {
+    if (_inited || isHeadless()) {
         return;
     }
     checkMainThread();
@@ -198,6 +200,8 @@ void Texture::configureCubeMap() {
 }
 
 void Texture::refresh() {
+    R_TRACE_COUNT(TextureUploads, 1);
+
     if (isCubeMapArray()) {
         refreshCubeMapArray();
     } else if (isCubeMap()) {
@@ -23,7 +23,7 @@ namespace reone {
 
 namespace graphics {
 
-std::vector<std::string> breakText(const std::string &text, Font &font, int maxWidth) {
+static std::vector<std::string> breakTextUncached(const std::string &text, Font &font, int maxWidth) {
     std::vector<std::string> result;
     std::string line;
     std::ostringstream tokenBuffer;
@@ -93,6 +93,13 @@ std::vector<std::string> breakText(const std::string &text, Font &font, int maxW
     return result;
 }
 
+std::vector<std::string> breakText(const std::string &text, Font &font, int maxWidth) {
+    auto lines = font.lineBreaks().getOrAdd(std::make_pair(text, maxWidth), [&text, &font, &maxWidth]() {
+        return std::make_shared<std::vector<std::string>>(breakTextUncached(text, font, maxWidth));
+    });
+    return *lines;
+}
+
 } // namespace graphics
 
 } // namespace reone
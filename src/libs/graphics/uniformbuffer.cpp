@@ -17,6 +17,7 @@
 
 #include "reone/graphics/uniformbuffer.h"
 
+#include "reone/graphics/glutil.h"
 #include "reone/system/threadutil.h"
 
 namespace reone {
@@ -24,7 +25,7 @@ namespace reone {
 namespace graphics {
 
 void UniformBuffer::init() {
-    if (_inited) {
+    if (_inited || isHeadless()) {
         return;
     }
     checkMainThread();
@@ -37,6 +37,7 @@ void Uniforms::init() {
     static WalkmeshUniforms defaultWalkmesh;
     static TextUniforms defaultText;
     static ScreenEffectUniforms defaultScreenEffect;
+    static GUIQuadUniforms defaultGUIQuads;
 
     _ubGlobals = initBuffer(&defaultGlobals, sizeof(GlobalUniforms));
     _ubLocals = initBuffer(&defaultLocals, sizeof(LocalUniforms));
@@ -47,6 +48,7 @@ void Uniforms::init() {
     _ubWalkmesh = initBuffer(&defaultWalkmesh, sizeof(WalkmeshUniforms));
     _ubText = initBuffer(&defaultText, sizeof(TextUniforms));
     _ubScreenEffect = initBuffer(&defaultScreenEffect, sizeof(ScreenEffectUniforms));
+    _ubGUIQuads = initBuffer(&defaultGUIQuads, sizeof(GUIQuadUniforms));
 
     _context.bindUniformBuffer(*_ubGlobals, UniformBlockBindingPoints::globals);
     _context.bindUniformBuffer(*_ubLocals, UniformBlockBindingPoints::locals);
@@ -57,6 +59,7 @@ void Uniforms::init() {
     _context.bindUniformBuffer(*_ubWalkmesh, UniformBlockBindingPoints::walkmesh);
     _context.bindUniformBuffer(*_ubText, UniformBlockBindingPoints::text);
     _context.bindUniformBuffer(*_ubScreenEffect, UniformBlockBindingPoints::screenEffect);
+    _context.bindUniformBuffer(*_ubGUIQuads, UniformBlockBindingPoints::guiQuads);
 
     _inited = true;
 }
@@ -75,6 +78,7 @@ void Uniforms::deinit() {
     _ubWalkmesh.reset();
     _ubText.reset();
     _ubScreenEffect.reset();
+    _ubGUIQuads.reset();
 
     _inited = false;
 }
@@ -133,6 +137,12 @@ void Uniforms::setScreenEffect(const std::function<void(ScreenEffectUniforms &)>
     _ubScreenEffect->setData(&_screenEffect, sizeof(ScreenEffectUniforms));
 }
 
+void Uniforms::setGUIQuads(const std::function<void(GUIQuadUniforms &)> &block) {
+    block(_guiQuads);
+    _context.bindUniformBuffer(*_ubGUIQuads, UniformBlockBindingPoints::guiQuads);
+    _ubGUIQuads->setData(&_guiQuads, sizeof(GUIQuadUniforms));
+}
+
 std::unique_ptr<UniformBuffer> Uniforms::initBuffer(const void *data, ptrdiff_t size) {
     auto buf = std::make_unique<UniformBuffer>();
     buf->setData(data, size, false);
@@ -17,6 +17,8 @@
 
 #include "reone/graphics/walkmesh.h"
 
+#include "reone/system/tracer.h"
+
 namespace reone {
 
 namespace graphics {
@@ -27,6 +29,7 @@ const Walkmesh::Face *Walkmesh::raycast(
     const glm::vec3 &dir,
     float maxDistance,
     float &outDistance) const {
+    R_TRACE_COUNT(Raycasts, 1);
 
     // For area walkmeshes, find intersection via AABB tree
     if (_rootAabb) {
@@ -18,12 +18,14 @@
 #include "reone/gui/control.h"
 
 #include "reone/graphics/context.h"
+#include "reone/graphics/font.h"
 #include "reone/graphics/mesh.h"
 #include "reone/graphics/meshregistry.h"
 #include "reone/graphics/renderbuffer.h"
 #include "reone/graphics/shaderregistry.h"
 #include "reone/graphics/textutil.h"
 #include "reone/graphics/uniforms.h"
+#include "reone/gui/drawlist.h"
 #include "reone/resource/gff.h"
 #include "reone/resource/provider/fonts.h"
 #include "reone/resource/provider/textures.h"
@@ -199,64 +201,72 @@ void Control::update(float dt) {
 
 void Control::render(const glm::ivec2 &screenSize,
                      const glm::ivec2 &offset,
-                     IRenderPass &pass) {
+                     DrawList &drawList) {
     if (!_visible) {
         return;
     }
     glm::ivec2 size(_extent.width, _extent.height);
     if (_selected && _hilight) {
-        renderBorder(*_hilight, offset, size, pass);
+        renderBorder(*_hilight, offset, size, drawList);
     } else if (_border) {
-        renderBorder(*_border, offset, size, pass);
+        renderBorder(*_border, offset, size, drawList);
     }
     if (!_textLines.empty()) {
-        renderText(_textLines, offset, size, pass);
+        renderText(_textLines, offset, size, drawList);
     }
     if (!_sceneName.empty()) {
-        std::optional<std::reference_wrapper<Texture>> output;
-        _graphicsSvc.context.withBlendMode(BlendMode::None, [this, &output]() {
-            output = _sceneGraphs.get(_sceneName).render({_extent.width, _extent.height});
-        });
-        _graphicsSvc.uniforms.setGlobals([&screenSize](auto &globals) {
-            globals.reset();
-            globals.projection = glm::ortho(
-                0.0f,
-                static_cast<float>(screenSize.x),
-                static_cast<float>(screenSize.y),
-                0.0f, 0.0f, 100.0f);
-            globals.projectionInv = glm::inverse(globals.projection);
-        });
-        _graphicsSvc.context.withDepthTestMode(DepthTestMode::None, [this, &offset, &pass, &output]() {
-            pass.drawImage(
-                *output,
-                {_extent.left + offset.x, _extent.top + offset.y},
-                {_extent.width, _extent.height});
+        glm::ivec2 position(_extent.left + offset.x, _extent.top + offset.y);
+        glm::ivec4 bounds(position, position + size);
+        drawList.addCustom(bounds, [this, screenSize, position]() {
+            renderScene(screenSize, position);
         });
     }
 }
 
+void Control::renderScene(const glm::ivec2 &screenSize, const glm::ivec2 &position) {
+    std::optional<std::reference_wrapper<Texture>> output;
+    _graphicsSvc.context.withBlendMode(BlendMode::None, [this, &output]() {
+        output = _sceneGraphs.get(_sceneName).render({_extent.width, _extent.height});
+    });
+    _graphicsSvc.uniforms.setGlobals([&screenSize](auto &globals) {
+        globals.reset();
+        globals.projection = glm::ortho(
+            0.0f,
+            static_cast<float>(screenSize.x),
+            static_cast<float>(screenSize.y),
+            0.0f, 0.0f, 100.0f);
+        globals.projectionInv = glm::inverse(globals.projection);
+    });
+    _graphicsSvc.uniforms.setLocals([this, &position](auto &locals) {
+        locals.reset();
+        locals.model = glm::translate(glm::vec3(position.x, position.y, 0.0f));
+        locals.model *= glm::scale(glm::vec3(_extent.width, _extent.height, 1.0f));
+    });
+    _graphicsSvc.context.useProgram(_graphicsSvc.shaderRegistry.get(ShaderProgramId::mvpTexture));
+    _graphicsSvc.context.bindTexture(*output, TextureUnits::mainTex);
+    _graphicsSvc.context.withDepthTestMode(DepthTestMode::None, [this]() {
+        _graphicsSvc.meshRegistry.get(MeshName::quad).draw(_graphicsSvc.statistic);
+    });
+}
+
 void Control::renderBorder(const Border &border,
                            const glm::ivec2 &offset,
                            const glm::ivec2 &size,
-                           IRenderPass &pass) {
-    _graphicsSvc.context.useProgram(_graphicsSvc.shaderRegistry.get(ShaderProgramId::mvpTexture));
-
+                           DrawList &drawList) {
     glm::vec3 color(getBorderColor());
-    glm::mat4 transform(1.0f);
     glm::mat3x4 uv(1.0f);
 
     if (border.fill) {
         auto blending = border.fill->features().blending == Texture::Blending::Additive
                             ? BlendMode::Additive
                             : BlendMode::Normal;
-        _graphicsSvc.context.withBlendMode(blending, [&]() {
-            pass.drawImage(
-                *border.fill,
-                {_extent.left + border.dimension + offset.x, _extent.top + border.dimension + offset.y},
-                {size.x - 2 * border.dimension, size.y - 2 * border.dimension},
-                glm::vec4(1.0f),
-                uv);
-        });
+        drawList.addQuad(
+            border.fill,
+            {_extent.left + border.dimension + offset.x, _extent.top + border.dimension + offset.y},
+            {size.x - 2 * border.dimension, size.y - 2 * border.dimension},
+            glm::vec4(1.0f),
+            uv,
+            blending);
     }
 
     if (border.edge) {
@@ -272,8 +282,8 @@ void Control::renderBorder(const Border &border,
                 glm::vec4(0.0f, -1.0f, 0.0f, 0.0f),
                 glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
                 glm::vec4(0.0f, 1.0f, 0.0f, 0.0f));
-            pass.drawImage(
-                *border.edge,
+            drawList.addQuad(
+                border.edge,
                 {x, y},
                 {border.dimension, height},
                 glm::vec4(color, 1.0f),
@@ -284,8 +294,8 @@ void Control::renderBorder(const Border &border,
                 glm::vec4(0.0f, 1.0f, 0.0f, 0.0f),
                 glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
                 glm::vec4(0.0f, 0.0f, 0.0f, 0.0f));
-            pass.drawImage(
-                *border.edge,
+            drawList.addQuad(
+                border.edge,
                 {x + size.x - border.dimension, y},
                 {border.dimension, height},
                 glm::vec4(color, 1.0f),
@@ -297,8 +307,8 @@ void Control::renderBorder(const Border &border,
             int y = _extent.top + offset.y;
 
             // Top edge
-            pass.drawImage(
-                *border.edge,
+            drawList.addQuad(
+                border.edge,
                 {x, y},
                 {width, border.dimension},
                 glm::vec4(color, 1.0f));
@@ -308,8 +318,8 @@ void Control::renderBorder(const Border &border,
                 glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
                 glm::vec4(0.0f, -1.0f, 0.0f, 0.0f),
                 glm::vec4(0.0f, 1.0f, 0.0f, 0.0f));
-            pass.drawImage(
-                *border.edge,
+            drawList.addQuad(
+                border.edge,
                 {x, y + size.y - border.dimension},
                 {width, border.dimension},
                 glm::vec4(color, 1.0f),
@@ -322,8 +332,8 @@ void Control::renderBorder(const Border &border,
         int y = _extent.top + offset.y;
 
         // Top left corner
-        pass.drawImage(
-            *border.corner,
+        drawList.addQuad(
+            border.corner,
             {x, y},
             {border.dimension, border.dimension},
             glm::vec4(color, 1.0f));
@@ -333,8 +343,8 @@ void Control::renderBorder(const Border &border,
             glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
             glm::vec4(0.0f, -1.0f, 0.0f, 0.0f),
             glm::vec4(0.0f, 1.0f, 0.0f, 0.0f));
-        pass.drawImage(
-            *border.corner,
+        drawList.addQuad(
+            border.corner,
             {x, y + size.y - border.dimension},
             {border.dimension, border.dimension},
             glm::vec4(color, 1.0f),
@@ -345,8 +355,8 @@ void Control::renderBorder(const Border &border,
             glm::vec4(-1.0f, 0.0f, 0.0f, 0.0f),
             glm::vec4(0.0f, 1.0f, 0.0f, 0.0f),
             glm::vec4(1.0f, 0.0f, 0.0f, 0.0f));
-        pass.drawImage(
-            *border.corner,
+        drawList.addQuad(
+            border.corner,
             {x + size.x - border.dimension, y},
             {border.dimension, border.dimension},
             glm::vec4(color, 1.0f),
@@ -357,8 +367,8 @@ void Control::renderBorder(const Border &border,
             glm::vec4(-1.0f, 0.0f, 0.0f, 0.0f),
             glm::vec4(0.0f, -1.0f, 0.0f, 0.0f),
             glm::vec4(1.0f, 1.0f, 0.0f, 0.0f));
-        pass.drawImage(
-            *border.corner,
+        drawList.addQuad(
+            border.corner,
             {x + size.x - border.dimension, y + size.y - border.dimension},
             {border.dimension, border.dimension},
             glm::vec4(color, 1.0f),
@@ -376,20 +386,37 @@ const glm::vec3 &Control::getBorderColor() const {
 void Control::renderText(const std::vector<std::string> &lines,
                          const glm::ivec2 &offset,
                          const glm::ivec2 &size,
-                         IRenderPass &pass) {
+                         DrawList &drawList) {
     glm::ivec2 position;
     TextGravity gravity;
     getTextPosition(position, static_cast<int>(lines.size()), size, gravity);
+    position += offset;
 
-    glm::vec3 linePosition(0.0f);
+    auto font = _text.font;
     glm::vec3 color((_selected && _hilight) ? _hilight->color : _text.color);
 
+    drawList.addCustom(getTextBounds(*font, lines, position), [font, lines, position, color, gravity]() {
+        glm::vec3 linePosition(position, 0.0f);
+        for (auto &line : lines) {
+            font->render(line, linePosition, color, gravity);
+            linePosition.y += static_cast<int>(font->height());
+        }
+    });
+}
+
+glm::ivec4 Control::getTextBounds(Font &font, const std::vector<std::string> &lines, const glm::ivec2 &position) {
+    // Depending on gravity, text can extend in any direction from its position
+    float maxWidth = 0.0f;
     for (auto &line : lines) {
-        linePosition.x = static_cast<float>(position.x + offset.x);
-        linePosition.y = static_cast<float>(position.y + offset.y);
-        _text.font->render(line, linePosition, color, gravity);
-        position.y += static_cast<int>(_text.font->height());
+        maxWidth = glm::max(maxWidth, font.measure(line));
     }
+    int halfWidth = static_cast<int>(glm::ceil(maxWidth));
+    int lineHeight = static_cast<int>(glm::ceil(font.height()));
+    return glm::ivec4(
+        position.x - halfWidth,
+        position.y - lineHeight,
+        position.x + halfWidth,
+        position.y + lineHeight * static_cast<int>(lines.size()));
 }
 
 void Control::getTextPosition(glm::ivec2 &position, int lineCount, const glm::ivec2 &size, TextGravity &gravity) const {
@@ -466,6 +493,7 @@ void Control::stretch(float x, float y, int mask) {
         _extent.height = static_cast<int>(_extent.height * y);
     }
     updateTransform();
+    invalidate();
 }
 
 void Control::setSelectable(bool selectable) {
@@ -476,10 +504,12 @@ void Control::setHeight(int height) {
     _extent.height = height;
     updateTransform();
     updateTextLines();
+    invalidate();
 }
 
 void Control::setVisible(bool visible) {
     _visible = visible;
+    invalidate();
 }
 
 void Control::setDisabled(bool disabled) {
@@ -491,6 +521,7 @@ void Control::setSelected(bool setSelected) {
         return;
 
     _selected = setSelected;
+    invalidate();
 
     if (_onSelectedChanged) {
         _onSelectedChanged(setSelected);
@@ -501,20 +532,24 @@ void Control::setExtent(Extent extent) {
     _extent = std::move(extent);
     updateTransform();
     updateTextLines();
+    invalidate();
 }
 
 void Control::setExtentHeight(int height) {
     _extent.height = height;
     updateTransform();
+    invalidate();
 }
 
 void Control::setExtentTop(int top) {
     _extent.top = top;
     updateTransform();
+    invalidate();
 }
 
 void Control::setBorder(Border border) {
     _border = std::make_shared<Border>(std::move(border));
+    invalidate();
 }
 
 void Control::setBorderFill(std::string resRef) {
@@ -526,6 +561,7 @@ void Control::setBorderFill(std::string resRef) {
 }
 
 void Control::setBorderFill(std::shared_ptr<Texture> texture) {
+    invalidate();
     if (!texture && _border) {
         _border->fill.reset();
         return;
@@ -540,18 +576,22 @@ void Control::setBorderFill(std::shared_ptr<Texture> texture) {
 
 void Control::setBorderColor(glm::vec3 color) {
     _border->color = std::move(color);
+    invalidate();
 }
 
 void Control::setBorderColorOverride(glm::vec3 color) {
     _borderColorOverride = std::move(color);
+    invalidate();
 }
 
 void Control::setUseBorderColorOverride(bool use) {
     _useBorderColorOverride = use;
+    invalidate();
 }
 
 void Control::setHilight(Border hilight) {
     _hilight = std::make_shared<Border>(hilight);
+    invalidate();
 }
 
 void Control::setHilightColor(glm::vec3 color) {
@@ -559,6 +599,7 @@ void Control::setHilightColor(glm::vec3 color) {
         _hilight = std::make_shared<Border>();
     }
     _hilight->color = std::move(color);
+    invalidate();
 }
 
 void Control::setHilightFill(std::string resRef) {
@@ -570,6 +611,7 @@ void Control::setHilightFill(std::string resRef) {
 }
 
 void Control::setHilightFill(std::shared_ptr<Texture> texture) {
+    invalidate();
     if (!texture && _hilight) {
         _hilight->fill.reset();
         return;
@@ -585,30 +627,39 @@ void Control::setHilightFill(std::shared_ptr<Texture> texture) {
 void Control::setText(Text text) {
     _text = std::move(text);
     updateTextLines();
+    invalidate();
 }
 
 void Control::setTextMessage(std::string text) {
     _text.text = std::move(text);
     updateTextLines();
+    invalidate();
 }
 
 void Control::setTextFont(std::shared_ptr<Font> font) {
     _text.font = std::move(font);
     updateTextLines();
+    invalidate();
 }
 
 void Control::setTextColor(glm::vec3 color) {
     _text.color = std::move(color);
+    invalidate();
 }
 
 void Control::setSceneName(std::string name) {
     _sceneName = std::move(name);
+    invalidate();
 }
 
 void Control::setPadding(int padding) {
     _padding = padding;
 }
 
+void Control::invalidate() {
+    _gui.invalidateDrawList();
+}
+
 } // namespace gui
 
 } // namespace reone
@@ -25,10 +25,10 @@
 #include "reone/graphics/shaderregistry.h"
 #include "reone/graphics/texture.h"
 #include "reone/graphics/uniforms.h"
+#include "reone/gui/drawlist.h"
 #include "reone/gui/gui.h"
 #include "reone/resource/provider/fonts.h"
 #include "reone/resource/provider/textures.h"
-#include "reone/scene/render/pass.h"
 
 using namespace reone::graphics;
 using namespace reone::resource;
@@ -51,7 +51,7 @@ void ImageButton::render(
     const std::string &iconText,
     const std::shared_ptr<Texture> &iconTexture,
     const std::shared_ptr<Texture> &iconFrame,
-    IRenderPass &pass) {
+    DrawList &drawList) {
 
     if (!_visible)
         return;
@@ -62,15 +62,15 @@ void ImageButton::render(
     glm::ivec2 size(_extent.width - _extent.height, _extent.height);
 
     if (_selected && _hilight) {
-        renderBorder(*_hilight, borderOffset, size, pass);
+        renderBorder(*_hilight, borderOffset, size, drawList);
     } else if (_border) {
-        renderBorder(*_border, borderOffset, size, pass);
+        renderBorder(*_border, borderOffset, size, drawList);
     }
 
-    renderIcon(offset, iconText, iconTexture, iconFrame, pass);
+    renderIcon(offset, iconText, iconTexture, iconFrame, drawList);
 
     if (!text.empty()) {
-        renderText(text, borderOffset, size, pass);
+        renderText(text, borderOffset, size, drawList);
     }
 }
 
@@ -79,7 +79,7 @@ void ImageButton::renderIcon(
     const std::string &iconText,
     const std::shared_ptr<Texture> &iconTexture,
     const std::shared_ptr<Texture> &iconFrame,
-    IRenderPass &pass) {
+    DrawList &drawList) {
 
     if (!iconFrame && !iconTexture)
         return;
@@ -92,16 +92,16 @@ void ImageButton::renderIcon(
     }
 
     if (iconFrame) {
-        pass.drawImage(
-            *iconFrame,
+        drawList.addQuad(
+            iconFrame,
             {offset.x + _extent.left, offset.y + _extent.top},
             {_extent.height, _extent.height},
             glm::vec4(color, 1.0f));
     }
 
     if (iconTexture) {
-        pass.drawImage(
-            *iconTexture,
+        drawList.addQuad(
+            iconTexture,
             {offset.x + _extent.left, offset.y + _extent.top},
             {_extent.height, _extent.height});
     }
@@ -110,7 +110,10 @@ void ImageButton::renderIcon(
         glm::vec3 position(0.0f);
         position.x = static_cast<float>(offset.x + _extent.left + _extent.height);
         position.y = static_cast<float>(offset.y + _extent.top + _extent.height - 0.5f * _iconFont->height());
-        _iconFont->render(iconText, position, color, TextGravity::LeftCenter);
+        auto bounds = getTextBounds(*_iconFont, {iconText}, glm::ivec2(position));
+        drawList.addCustom(bounds, [font = _iconFont, iconText, position, color]() {
+            font->render(iconText, position, color, TextGravity::LeftCenter);
+        });
     }
 }
 
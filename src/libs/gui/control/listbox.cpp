@@ -25,6 +25,7 @@
 #include "reone/gui/control/button.h"
 #include "reone/gui/control/imagebutton.h"
 #include "reone/gui/control/scrollbar.h"
+#include "reone/gui/drawlist.h"
 #include "reone/gui/gui.h"
 #include "reone/resource/gff.h"
 #include "reone/resource/resources.h"
@@ -44,6 +45,7 @@ void ListBox::clearItems() {
     _items.clear();
     _itemOffset = 0;
     _selectedItemIndex = -1;
+    invalidate();
 }
 
 void ListBox::addItem(Item &&item) {
@@ -73,6 +75,7 @@ void ListBox::addTextLinesAsItems(const std::string &text) {
 
 void ListBox::clearSelection() {
     _selectedItemIndex = -1;
+    invalidate();
 }
 
 void ListBox::load(const resource::generated::GUI_BASECONTROL &gui, bool protoItem) {
@@ -91,7 +94,11 @@ void ListBox::load(const resource::generated::GUI_BASECONTROL &gui, bool protoIt
 
 bool ListBox::handleMouseMotion(int x, int y) {
     if (_selectionMode == SelectionMode::OnHover) {
-        _selectedItemIndex = getItemIndex(y);
+        int itemIdx = getItemIndex(y);
+        if (_selectedItemIndex != itemIdx) {
+            _selectedItemIndex = itemIdx;
+            invalidate();
+        }
     }
     return false;
 }
@@ -163,6 +170,8 @@ void ListBox::updateItemSlots() {
     if (_scrollBar) {
         _scrollBar->setVisible(_items.size() > _slotCount);
     }
+
+    invalidate();
 }
 
 bool ListBox::handleClick(int x, int y) {
@@ -172,6 +181,7 @@ bool ListBox::handleClick(int x, int y) {
 
     if (_selectionMode == SelectionMode::OnClick) {
         _selectedItemIndex = itemIdx;
+        invalidate();
     }
     if (_onItemClick) {
         _onItemClick(_items[itemIdx].tag);
@@ -182,11 +192,11 @@ bool ListBox::handleClick(int x, int y) {
 
 void ListBox::render(const glm::ivec2 &screenSize,
                      const glm::ivec2 &offset,
-                     IRenderPass &pass) {
+                     DrawList &drawList) {
     if (!_visible)
         return;
 
-    Control::render(screenSize, offset, pass);
+    Control::render(screenSize, offset, drawList);
 
     if (!_protoItem)
         return;
@@ -206,10 +216,10 @@ void ListBox::render(const glm::ivec2 &screenSize,
 
         auto imageButton = std::dynamic_pointer_cast<ImageButton>(_protoItem);
         if (imageButton) {
-            imageButton->render(itemOffset, item._textLines, item.iconText, item.iconTexture, item.iconFrame, pass);
+            imageButton->render(itemOffset, item._textLines, item.iconText, item.iconTexture, item.iconFrame, drawList);
         } else {
             _protoItem->setTextLines(item._textLines);
-            _protoItem->render(screenSize, itemOffset, pass);
+            _protoItem->render(screenSize, itemOffset, drawList);
         }
 
         if (_protoMatchContent) {
@@ -226,7 +236,7 @@ void ListBox::render(const glm::ivec2 &screenSize,
         state.offset = _itemOffset;
         auto &scrollBar = static_cast<ScrollBar &>(*_scrollBar);
         scrollBar.setScrollState(std::move(state));
-        scrollBar.render(screenSize, offset, pass);
+        scrollBar.render(screenSize, offset, drawList);
     }
 }
 
@@ -247,6 +257,7 @@ void ListBox::setSelected(bool selected) {
     Control::setSelected(selected);
     if (!selected && _selectionMode == SelectionMode::OnHover) {
         _selectedItemIndex = -1;
+        invalidate();
     }
 }
 
@@ -287,6 +298,7 @@ void ListBox::setSelectionMode(SelectionMode mode) {
 
 void ListBox::setProtoMatchContent(bool match) {
     _protoMatchContent = match;
+    invalidate();
 }
 
 const ListBox::Item &ListBox::getItemAt(int index) const {
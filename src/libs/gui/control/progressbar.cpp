@@ -24,10 +24,10 @@
 #include "reone/graphics/shaderregistry.h"
 #include "reone/graphics/texture.h"
 #include "reone/graphics/uniforms.h"
+#include "reone/gui/drawlist.h"
 #include "reone/gui/gui.h"
 #include "reone/resource/gff.h"
 #include "reone/resource/provider/textures.h"
-#include "reone/scene/render/pass.h"
 
 using namespace reone::graphics;
 using namespace reone::resource;
@@ -47,13 +47,13 @@ void ProgressBar::load(const resource::generated::GUI_BASECONTROL &gui, bool pro
 
 void ProgressBar::render(const glm::ivec2 &screenSize,
                          const glm::ivec2 &offset,
-                         scene::IRenderPass &pass) {
+                         DrawList &drawList) {
     if (_value == 0 || !_progress.fill) {
         return;
     }
     float w = _extent.width * _value / 100.0f;
-    pass.drawImage(
-        *_progress.fill,
+    drawList.addQuad(
+        _progress.fill,
         {_extent.left + offset.x, _extent.top + offset.y},
         {w, _extent.height});
 }
@@ -63,6 +63,7 @@ void ProgressBar::setValue(int value) {
         throw std::out_of_range("value out of range: " + std::to_string(value));
     }
     _value = value;
+    invalidate();
 }
 
 } // namespace gui
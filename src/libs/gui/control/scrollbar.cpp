@@ -24,10 +24,10 @@
 #include "reone/graphics/shaderregistry.h"
 #include "reone/graphics/texture.h"
 #include "reone/graphics/uniforms.h"
+#include "reone/gui/drawlist.h"
 #include "reone/resource/gff.h"
 #include "reone/resource/provider/textures.h"
 #include "reone/resource/resources.h"
-#include "reone/scene/render/pass.h"
 
 #include "reone/gui/gui.h"
 
@@ -54,38 +54,38 @@ void ScrollBar::load(const resource::generated::GUI_BASECONTROL &gui, bool proto
 
 void ScrollBar::render(const glm::ivec2 &screenSize,
                        const glm::ivec2 &offset,
-                       scene::IRenderPass &pass) {
-    renderThumb(offset, pass);
-    renderArrows(offset, pass);
+                       DrawList &drawList) {
+    renderThumb(offset, drawList);
+    renderArrows(offset, drawList);
 }
 
 void ScrollBar::renderThumb(const glm::ivec2 &offset,
-                            scene::IRenderPass &pass) {
+                            DrawList &drawList) {
     if (!_thumb.image || _state.numVisible >= _state.count) {
         return;
     }
 
     // Top edge
-    pass.drawImage(
-        *_thumb.image,
+    drawList.addQuad(
+        _thumb.image,
         {_extent.left + offset.x, _extent.top + _extent.width + offset.y},
         {_extent.width, 1.0f});
 
     // Left edge
-    pass.drawImage(
-        *_thumb.image,
+    drawList.addQuad(
+        _thumb.image,
         {_extent.left + offset.x, _extent.top + _extent.width + offset.y},
         {1.0f, _extent.height - 2.0f * _extent.width});
 
     // Right edge
-    pass.drawImage(
-        *_thumb.image,
+    drawList.addQuad(
+        _thumb.image,
         {_extent.left + _extent.width - 1.0f + offset.x, _extent.top + _extent.width + offset.y},
         {1.0f, _extent.height - 2.0f * _extent.width});
 
     // Bottom edge
-    pass.drawImage(
-        *_thumb.image,
+    drawList.addQuad(
+        _thumb.image,
         {_extent.left + offset.x, _extent.top + _extent.height - _extent.width - 1.0f + offset.y},
         {_extent.width, 1.0f});
 
@@ -93,14 +93,14 @@ void ScrollBar::renderThumb(const glm::ivec2 &offset,
     float frameHeight = _extent.height - 2.0f * _extent.width - 4.0f;
     float thumbHeight = frameHeight * _state.numVisible / static_cast<float>(_state.count);
     float y = glm::mix(0.0f, frameHeight - thumbHeight, _state.offset / static_cast<float>(_state.count - _state.numVisible));
-    pass.drawImage(
-        *_thumb.image,
+    drawList.addQuad(
+        _thumb.image,
         {_extent.left + 2.0f + offset.x, _extent.top + _extent.width + 2.0f + offset.y + y},
         {_extent.width - 4.0f, thumbHeight});
 }
 
 void ScrollBar::renderArrows(const glm::ivec2 &offset,
-                             scene::IRenderPass &pass) {
+                             DrawList &drawList) {
     if (!_dir.image)
         return;
 
@@ -110,29 +110,29 @@ void ScrollBar::renderArrows(const glm::ivec2 &offset,
         return;
 
     if (canScrollUp) {
-        renderUpArrow(offset, pass);
+        renderUpArrow(offset, drawList);
     }
     if (canScrollDown) {
-        renderDownArrow(offset, pass);
+        renderDownArrow(offset, drawList);
     }
 }
 
 void ScrollBar::renderUpArrow(const glm::ivec2 &offset,
-                              scene::IRenderPass &pass) {
-    pass.drawImage(
-        *_dir.image,
+                              DrawList &drawList) {
+    drawList.addQuad(
+        _dir.image,
         {_extent.left + offset.x, _extent.top + offset.y},
         {_extent.width, _extent.width});
 }
 
 void ScrollBar::renderDownArrow(const glm::ivec2 &offset,
-                                scene::IRenderPass &pass) {
+                                DrawList &drawList) {
     auto uv = glm::mat3x4(
         glm::vec4(1.0f, 0.0f, 0.0f, 0.0f),
         glm::vec4(0.0f, -1.0f, 0.0f, 0.0f),
         glm::vec4(0.0f, 1.0f, 0.0f, 0.0f));
-    pass.drawImage(
-        *_dir.image,
+    drawList.addQuad(
+        _dir.image,
         {_extent.left + offset.x, _extent.top + _extent.height - _extent.width + offset.y},
         {_extent.width, _extent.width},
         glm::vec4(1.0f),
@@ -141,6 +141,7 @@ void ScrollBar::renderDownArrow(const glm::ivec2 &offset,
 
 void ScrollBar::setScrollState(ScrollState state) {
     _state = std::move(state);
+    invalidate();
 }
 
 } // namespace gui
@@ -29,10 +29,12 @@ const glm::vec3 &ToggleButton::getBorderColor() const {
 
 void ToggleButton::toggle() {
     _on = !_on;
+    invalidate();
 }
 
 void ToggleButton::setOnColor(const glm::vec3 &color) {
     _onColor = color;
+    invalidate();
 }
 
 } // namespace gui
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/gui/drawlist.h"
+
+using namespace reone::graphics;
+
+namespace reone {
+
+namespace gui {
+
+/**
+ * Maximum number of commands to look back at when searching for a batch to
+ * merge a quad into. Bounds the cost of rebuilding long lists.
+ */
+static constexpr int kMaxBatchLookback = 64;
+
+static glm::ivec4 getQuadBounds(const DrawList::Quad &quad) {
+    glm::ivec2 a(quad.position);
+    glm::ivec2 b(quad.position + quad.size);
+    return glm::ivec4(glm::min(a, b), glm::max(a, b));
+}
+
+static bool intersects(const glm::ivec4 &lhs, const glm::ivec4 &rhs) {
+    return lhs.x < rhs.z && rhs.x < lhs.z && lhs.y < rhs.w && rhs.y < lhs.w;
+}
+
+static void extendBounds(glm::ivec4 &bounds, const glm::ivec4 &other) {
+    bounds.x = glm::min(bounds.x, other.x);
+    bounds.y = glm::min(bounds.y, other.y);
+    bounds.z = glm::max(bounds.z, other.z);
+    bounds.w = glm::max(bounds.w, other.w);
+}
+
+void DrawList::clear() {
+    _commands.clear();
+    _numQuads = 0;
+}
+
+void DrawList::addQuad(std::shared_ptr<Texture> texture,
+                       const glm::ivec2 &position,
+                       const glm::ivec2 &size,
+                       glm::vec4 color,
+                       glm::mat3x4 uv,
+                       BlendMode blendMode) {
+    if (!texture) {
+        return;
+    }
+    Quad quad;
+    quad.position = position;
+    quad.size = size;
+    quad.color = std::move(color);
+    quad.uv = std::move(uv);
+    auto bounds = getQuadBounds(quad);
+    ++_numQuads;
+
+    int lookback = 0;
+    for (auto it = _commands.rbegin(); it != _commands.rend() && lookback < kMaxBatchLookback; ++it, ++lookback) {
+        if (it->texture == texture && it->blendMode == blendMode) {
+            it->quads.push_back(std::move(quad));
+            extendBounds(it->bounds, bounds);
+            return;
+        }
+        if (intersects(it->bounds, bounds)) {
+            break;
+        }
+    }
+
+    Command command;
+    command.texture = std::move(texture);
+    command.blendMode = blendMode;
+    command.quads.push_back(std::move(quad));
+    command.bounds = bounds;
+    _commands.push_back(std::move(command));
+}
+
+void DrawList::addCustom(const glm::ivec4 &bounds, std::function<void()> func) {
+    Command command;
+    command.custom = std::move(func);
+    command.bounds = bounds;
+    _commands.push_back(std::move(command));
+}
+
+} // namespace gui
+
+} // namespace reone
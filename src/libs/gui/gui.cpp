@@ -38,8 +38,6 @@
 #include "reone/resource/provider/gffs.h"
 #include "reone/resource/provider/textures.h"
 #include "reone/resource/resources.h"
-#include "reone/scene/render/pass/pbr.h"
-#include "reone/scene/render/pass/retro.h"
 #include "reone/system/exception/validation.h"
 #include "reone/system/logutil.h"
 
@@ -102,8 +100,7 @@ void GUI::loadControl(const resource::generated::GUI_CONTROLS &gui) {
     auto type = Control::getType(gui);
     auto tag = Control::getTag(gui);
     auto parentTag = Control::getParent(gui);
-    debug(str(boost::format("Loading control: type=%s, tag='%s', parent='%s'") % static_cast<int>(type) % tag % parentTag),
-          LogChannel::GUI);
+    R_LOG_DEBUG(LogChannel::GUI, str(boost::format("Loading control: type=%s, tag='%s', parent='%s'") % static_cast<int>(type) % tag % parentTag));
 
     auto control = newControl(type, tag);
     if (!control) {
@@ -248,51 +245,63 @@ void GUI::update(float dt) {
 }
 
 void GUI::render() {
+    if (_drawListDirty) {
+        rebuildDrawList();
+    }
     _graphicsSvc.context.withBlendMode(BlendMode::Normal, [this]() {
-        auto retroPass = RetroRenderPass(
-            _options,
-            _graphicsSvc.context,
-            _graphicsSvc.shaderRegistry,
-            _graphicsSvc.statistic,
-            _graphicsSvc.meshRegistry,
-            _graphicsSvc.textureRegistry,
-            _graphicsSvc.uniforms);
-        auto pbrPass = PBRRenderPass(
-            _options,
-            _graphicsSvc.context,
-            _graphicsSvc.shaderRegistry,
-            _graphicsSvc.statistic,
-            _graphicsSvc.meshRegistry,
-            _graphicsSvc.pbrTextures,
-            _graphicsSvc.textureRegistry,
-            _graphicsSvc.uniforms);
-        auto &pass = _options.pbr ? static_cast<IRenderPass &>(pbrPass)
-                                  : static_cast<IRenderPass &>(retroPass);
-        if (_background) {
-            renderBackground(pass);
-        }
-        if (!_rootControl) {
-            return;
-        }
+        renderDrawList();
+    });
+}
+
+void GUI::rebuildDrawList() {
+    _drawList.clear();
+    if (_background) {
+        _drawList.addQuad(_background, {0, 0}, {_options.width, _options.height});
+    }
+    if (_rootControl) {
         std::queue<std::pair<std::reference_wrapper<Control>, glm::ivec2>> controls;
         controls.push({*_rootControl, _rootOffset});
         while (!controls.empty()) {
             auto &[controlWrapper, offset] = controls.front();
             auto &control = controlWrapper.get();
             controls.pop();
-            control.render({_options.width, _options.height}, offset, pass);
+            control.render({_options.width, _options.height}, offset, _drawList);
             for (auto &child : control.children()) {
                 controls.push({child, _controlOffset});
             }
         }
-    });
+    }
+    // Controls may change their own state while being rendered, e.g. list
+    // boxes reuse a single proto item for all of their items
+    _drawListDirty = false;
 }
 
-void GUI::renderBackground(IRenderPass &pass) {
-    pass.drawImage(
-        *_background,
-        {0, 0},
-        {_options.width, _options.height});
+void GUI::renderDrawList() {
+    auto &quadMesh = _graphicsSvc.meshRegistry.get(MeshName::quad);
+    for (auto &command : _drawList.commands()) {
+        if (command.custom) {
+            command.custom();
+            continue;
+        }
+        _graphicsSvc.context.useProgram(_graphicsSvc.shaderRegistry.get(ShaderProgramId::guiQuads));
+        _graphicsSvc.context.bindTexture(*command.texture, TextureUnits::mainTex);
+        _graphicsSvc.context.withBlendMode(command.blendMode, [this, &command, &quadMesh]() {
+            for (size_t i = 0; i < command.quads.size(); i += kMaxGUIQuads) {
+                int numQuads = static_cast<int>(std::min(command.quads.size() - i, static_cast<size_t>(kMaxGUIQuads)));
+                _graphicsSvc.uniforms.setGUIQuads([&command, &i, &numQuads](auto &uniforms) {
+                    for (int j = 0; j < numQuads; ++j) {
+                        auto &quad = command.quads[i + j];
+                        auto &instance = uniforms.quads[j];
+                        instance.posScale = glm::vec4(quad.position, quad.size);
+                        instance.color = quad.color;
+                        instance.uvX = glm::vec4(quad.uv[0].x, quad.uv[1].x, quad.uv[2].x, 0.0f);
+                        instance.uvY = glm::vec4(quad.uv[0].y, quad.uv[1].y, quad.uv[2].y, 0.0f);
+                    }
+                });
+                quadMesh.drawInstanced(numQuads, _graphicsSvc.statistic);
+            }
+        });
+    }
 }
 
 void GUI::clearSelection() {
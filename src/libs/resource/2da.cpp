@@ -25,26 +25,55 @@ namespace resource {
 
 static constexpr char kCellValueDeleted[] = "****";
 
+static bool parseInt(const std::string &value, int base, int &outValue) {
+    errno = 0;
+    char *end = nullptr;
+    long parsed = std::strtol(value.c_str(), &end, base);
+    if (end == value.c_str() || errno == ERANGE || parsed < INT_MIN || parsed > INT_MAX) {
+        return false;
+    }
+    outValue = static_cast<int>(parsed);
+    return true;
+}
+
+static bool parseFloat(const std::string &value, float &outValue) {
+    errno = 0;
+    char *end = nullptr;
+    float parsed = std::strtof(value.c_str(), &end);
+    if (end == value.c_str() || errno == ERANGE) {
+        return false;
+    }
+    outValue = parsed;
+    return true;
+}
+
 int TwoDA::indexByCellValue(const std::string &column, const std::string &value) const {
     int columnIdx = getColumnIndex(column);
     if (columnIdx == -1) {
         warn("2DA: column not found: " + column);
         return -1;
     }
-    for (size_t i = 0; i < _rows.size(); ++i) {
-        if (_rows[i].values[columnIdx] == value)
-            return static_cast<int>(i);
-    }
+    return indexByCellValue(ColumnRef(columnIdx), value);
+}
 
-    return -1;
+int TwoDA::indexByCellValue(ColumnRef column, const std::string &value) const {
+    if (!column.isValid()) {
+        return -1;
+    }
+    auto &cache = indexedColumn(column.index());
+    auto it = cache.valueToRows.find(value);
+    if (it == cache.valueToRows.end()) {
+        return -1;
+    }
+    return it->second.front();
 }
 
 int TwoDA::getColumnIndex(const std::string &column) const {
-    for (size_t i = 0; i < _columns.size(); ++i) {
-        if (_columns[i] == column)
-            return static_cast<int>(i);
+    auto it = _columnIndices.find(column);
+    if (it == _columnIndices.end()) {
+        return -1;
     }
-    return -1;
+    return it->second;
 }
 
 static std::vector<std::string> getColumnNames(const std::vector<std::pair<std::string, std::string>> &values) {
@@ -58,10 +87,19 @@ static std::vector<std::string> getColumnNames(const std::vector<std::pair<std::
 int TwoDA::indexByCellValues(const std::vector<std::pair<std::string, std::string>> &values) const {
     std::vector<std::string> columns(getColumnNames(values));
     std::vector<int> columnIndices(getColumnIndices(columns));
+    if (values.empty()) {
+        return _rows.empty() ? -1 : 0;
+    }
 
-    for (size_t i = 0; i < _rows.size(); ++i) {
+    // Narrow down candidates using hash index of the first column
+    auto &cache = indexedColumn(columnIndices[0]);
+    auto it = cache.valueToRows.find(values[0].second);
+    if (it == cache.valueToRows.end()) {
+        return -1;
+    }
+    for (int i : it->second) {
         bool match = true;
-        for (size_t j = 0; j < values.size(); ++j) {
+        for (size_t j = 1; j < values.size(); ++j) {
             int columnIdx = columnIndices[j];
             if (_rows[i].values[columnIdx] != values[j].second) {
                 match = false;
@@ -69,7 +107,7 @@ int TwoDA::indexByCellValues(const std::vector<std::pair<std::string, std::strin
             }
         }
         if (match)
-            return static_cast<int>(i);
+            return i;
     }
 
     return -1;
@@ -87,77 +125,194 @@ std::vector<int> TwoDA::getColumnIndices(const std::vector<std::string> &columns
     return indices;
 }
 
+const TwoDA::ColumnCache &TwoDA::parsedColumn(int columnIdx) const {
+    auto &cache = _columnCaches[columnIdx];
+    std::call_once(cache.valuesParsed, [this, &cache, &columnIdx]() {
+        size_t numRows = _rows.size();
+        cache.flags.resize(numRows, 0);
+        cache.ints.resize(numRows, 0);
+        cache.hexInts.resize(numRows, 0);
+        cache.floats.resize(numRows, 0.0f);
+        for (size_t i = 0; i < numRows; ++i) {
+            const std::string &value = _rows[i].values[columnIdx];
+            if (value == kCellValueDeleted) {
+                cache.flags[i] = kCellDeleted;
+                continue;
+            }
+            if (value.empty()) {
+                cache.flags[i] = kCellEmpty;
+                continue;
+            }
+            uint8_t flags = 0;
+            int intValue;
+            if (parseInt(value, 10, intValue)) {
+                cache.ints[i] = intValue;
+                flags |= kCellInt;
+            }
+            if (parseInt(value, 16, intValue)) {
+                cache.hexInts[i] = static_cast<uint32_t>(intValue);
+                flags |= kCellHexInt;
+            }
+            float floatValue;
+            if (parseFloat(value, floatValue)) {
+                cache.floats[i] = floatValue;
+                flags |= kCellFloat;
+            }
+            cache.flags[i] = flags;
+        }
+    });
+    return cache;
+}
+
+const TwoDA::ColumnCache &TwoDA::indexedColumn(int columnIdx) const {
+    auto &cache = _columnCaches[columnIdx];
+    std::call_once(cache.rowsIndexed, [this, &cache, &columnIdx]() {
+        for (size_t i = 0; i < _rows.size(); ++i) {
+            cache.valueToRows[_rows[i].values[columnIdx]].push_back(static_cast<int>(i));
+        }
+    });
+    return cache;
+}
+
+std::optional<uint8_t> TwoDA::getCellFlags(int row, ColumnRef column) const {
+    if (row < 0 || row >= _rows.size()) {
+        warn("2DA: row index out of range: " + std::to_string(row));
+        return std::nullopt;
+    }
+    if (!column.isValid()) {
+        return std::nullopt;
+    }
+    uint8_t flags = parsedColumn(column.index()).flags[row];
+    if (flags & kCellDeleted) {
+        warn(str(boost::format("2DA: cell value was deleted: %d %s") % row % _columns[column.index()]));
+        return std::nullopt;
+    }
+    return flags;
+}
+
 std::string TwoDA::getString(int row, const std::string &column, std::string defValue) const {
-    return getStringOpt(row, column).value_or(defValue);
+    return getString(row, this->column(column), std::move(defValue));
 }
 
 std::optional<std::string> TwoDA::getStringOpt(int row, const std::string &column) const {
+    return getStringOpt(row, this->column(column));
+}
+
+int TwoDA::getInt(int row, const std::string &column, int defValue) const {
+    return getInt(row, this->column(column), defValue);
+}
+
+std::optional<int> TwoDA::getIntOpt(int row, const std::string &column) const {
+    return getIntOpt(row, this->column(column));
+}
+
+uint32_t TwoDA::getHexInt(int row, const std::string &column, uint32_t defValue) const {
+    return getHexInt(row, this->column(column), defValue);
+}
+
+std::optional<uint32_t> TwoDA::getHexIntOpt(int row, const std::string &column) const {
+    return getHexIntOpt(row, this->column(column));
+}
+
+float TwoDA::getFloat(int row, const std::string &column, float defValue) const {
+    return getFloat(row, this->column(column), defValue);
+}
+
+std::optional<float> TwoDA::getFloatOpt(int row, const std::string &column) const {
+    return getFloatOpt(row, this->column(column));
+}
+
+bool TwoDA::getBool(int row, const std::string &column, bool defValue) const {
+    return getBool(row, this->column(column), defValue);
+}
+
+std::optional<bool> TwoDA::getBoolOpt(int row, const std::string &column) const {
+    return getBoolOpt(row, this->column(column));
+}
+
+std::string TwoDA::getString(int row, ColumnRef column, std::string defValue) const {
+    auto value = getStringOpt(row, column);
+    if (!value) {
+        return defValue;
+    }
+    return std::move(*value);
+}
+
+std::optional<std::string> TwoDA::getStringOpt(int row, ColumnRef column) const {
     if (row < 0 || row >= _rows.size()) {
         warn("2DA: row index out of range: " + std::to_string(row));
         return std::nullopt;
     }
-
-    int columnIdx = getColumnIndex(column);
-    if (columnIdx == -1) {
+    if (!column.isValid()) {
         return std::nullopt;
     }
 
-    const std::string &value = _rows[row].values[columnIdx];
+    const std::string &value = _rows[row].values[column.index()];
 
     if (value == kCellValueDeleted) {
-        warn(str(boost::format("2DA: cell value was deleted: %d %s") % row % column));
+        warn(str(boost::format("2DA: cell value was deleted: %d %s") % row % _columns[column.index()]));
         return std::nullopt;
     }
 
     return value;
 }
 
-int TwoDA::getInt(int row, const std::string &column, int defValue) const {
+int TwoDA::getInt(int row, ColumnRef column, int defValue) const {
     return getIntOpt(row, column).value_or(defValue);
 }
 
-std::optional<int> TwoDA::getIntOpt(int row, const std::string &column) const {
-    const std::string &value = getString(row, column);
-    if (value.empty()) {
+std::optional<int> TwoDA::getIntOpt(int row, ColumnRef column) const {
+    auto flags = getCellFlags(row, column);
+    if (!flags || (*flags & kCellEmpty)) {
         return std::nullopt;
     }
-    return stoi(value);
+    if (!(*flags & kCellInt)) {
+        // Not parseable, let std::stoi report the error
+        return stoi(_rows[row].values[column.index()]);
+    }
+    return _columnCaches[column.index()].ints[row];
 }
 
-uint32_t TwoDA::getHexInt(int row, const std::string &column, uint32_t defValue) const {
+uint32_t TwoDA::getHexInt(int row, ColumnRef column, uint32_t defValue) const {
     return getHexIntOpt(row, column).value_or(defValue);
 }
 
-std::optional<uint32_t> TwoDA::getHexIntOpt(int row, const std::string &column) const {
-    const std::string &value = getString(row, column);
-    if (value.empty()) {
+std::optional<uint32_t> TwoDA::getHexIntOpt(int row, ColumnRef column) const {
+    auto flags = getCellFlags(row, column);
+    if (!flags || (*flags & kCellEmpty)) {
         return std::nullopt;
     }
-    return stoi(value, nullptr, 16);
+    if (!(*flags & kCellHexInt)) {
+        return stoi(_rows[row].values[column.index()], nullptr, 16);
+    }
+    return _columnCaches[column.index()].hexInts[row];
 }
 
-float TwoDA::getFloat(int row, const std::string &column, float defValue) const {
+float TwoDA::getFloat(int row, ColumnRef column, float defValue) const {
     return getFloatOpt(row, column).value_or(defValue);
 }
 
-std::optional<float> TwoDA::getFloatOpt(int row, const std::string &column) const {
-    const std::string &value = getString(row, column);
-    if (value.empty()) {
+std::optional<float> TwoDA::getFloatOpt(int row, ColumnRef column) const {
+    auto flags = getCellFlags(row, column);
+    if (!flags || (*flags & kCellEmpty)) {
         return std::nullopt;
     }
-    return stof(value);
+    if (!(*flags & kCellFloat)) {
+        return stof(_rows[row].values[column.index()]);
+    }
+    return _columnCaches[column.index()].floats[row];
 }
 
-bool TwoDA::getBool(int row, const std::string &column, bool defValue) const {
+bool TwoDA::getBool(int row, ColumnRef column, bool defValue) const {
     return getBoolOpt(row, column).value_or(defValue);
 }
 
-std::optional<bool> TwoDA::getBoolOpt(int row, const std::string &column) const {
-    const std::string &value = getString(row, column);
-    if (value.empty()) {
+std::optional<bool> TwoDA::getBoolOpt(int row, ColumnRef column) const {
+    auto value = getIntOpt(row, column);
+    if (!value) {
         return std::nullopt;
     }
-    return stoi(value) != 0;
+    return *value != 0;
 }
 
 } // namespace resource
@@ -42,6 +42,33 @@ void ErfResourceContainer::init() {
     }
 }
 
+void ErfResourceContainer::init(const ResourceIndex &index) {
+    _erf = std::make_unique<FileInputStream>(_path);
+
+    for (auto &entry : index.entries) {
+        auto resource = Resource();
+        resource.id = entry.id;
+        resource.offset = entry.offset;
+        resource.fileSize = entry.size;
+        _resourceIds.insert(resource.id);
+        _idToResource.insert(std::make_pair(entry.id, std::move(resource)));
+    }
+}
+
+ResourceIndex ErfResourceContainer::index() const {
+    auto index = ResourceIndex();
+    index.files.push_back(_path);
+    index.entries.reserve(_idToResource.size());
+    for (auto &[id, resource] : _idToResource) {
+        auto entry = ResourceIndex::Entry();
+        entry.id = id;
+        entry.offset = resource.offset;
+        entry.size = resource.fileSize;
+        index.entries.push_back(std::move(entry));
+    }
+    return index;
+}
+
 std::optional<ByteBuffer> ErfResourceContainer::findResourceData(const ResourceId &id) {
     auto it = _idToResource.find(id);
     if (it == _idToResource.end()) {
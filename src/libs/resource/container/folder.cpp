@@ -28,7 +28,38 @@ void FolderResourceContainer::init() {
     loadDirectory(_path);
 }
 
+void FolderResourceContainer::init(const ResourceIndex &index) {
+    _directories = index.files;
+
+    for (auto &entry : index.entries) {
+        Resource res;
+        res.path = _directories.at(entry.fileIdx) / entry.name;
+        res.type = entry.id.type;
+        res.directoryIdx = static_cast<int>(entry.fileIdx);
+
+        _resourceIds.insert(entry.id);
+        _idToResource.insert(std::make_pair(entry.id, std::move(res)));
+    }
+}
+
+ResourceIndex FolderResourceContainer::index() const {
+    auto index = ResourceIndex();
+    index.files = _directories;
+    index.entries.reserve(_idToResource.size());
+    for (auto &[id, res] : _idToResource) {
+        auto entry = ResourceIndex::Entry();
+        entry.id = id;
+        entry.fileIdx = static_cast<uint32_t>(res.directoryIdx);
+        entry.name = res.path.filename().string();
+        index.entries.push_back(std::move(entry));
+    }
+    return index;
+}
+
 void FolderResourceContainer::loadDirectory(const std::filesystem::path &path) {
+    auto directoryIdx = static_cast<int>(_directories.size());
+    _directories.push_back(path);
+
     for (auto &entry : std::filesystem::directory_iterator(path)) {
         if (std::filesystem::is_directory(entry.path())) {
             loadDirectory(entry.path());
@@ -42,6 +73,7 @@ void FolderResourceContainer::loadDirectory(const std::filesystem::path &path) {
         Resource res;
         res.path = entry.path();
         res.type = resType;
+        res.directoryIdx = directoryIdx;
 
         _resourceIds.insert(resId);
         _idToResource.insert(std::make_pair(resId, std::move(res)));
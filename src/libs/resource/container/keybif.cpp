@@ -61,10 +61,41 @@ void KeyBifResourceContainer::init() {
             _idToResource.insert(std::make_pair(key->resId, std::move(resource)));
         }
 
+        _bifPaths.push_back(bifPath);
         _bifs.push_back(std::move(bif));
     }
 }
 
+void KeyBifResourceContainer::init(const ResourceIndex &index) {
+    _bifPaths.assign(index.files.begin() + 1, index.files.end());
+    _bifs.resize(_bifPaths.size());
+
+    for (auto &entry : index.entries) {
+        auto resource = Resource();
+        resource.bifIdx = static_cast<int>(entry.fileIdx) - 1;
+        resource.bifOffset = entry.offset;
+        resource.fileSize = entry.size;
+        _resourceIds.insert(entry.id);
+        _idToResource.insert(std::make_pair(entry.id, std::move(resource)));
+    }
+}
+
+ResourceIndex KeyBifResourceContainer::index() const {
+    auto index = ResourceIndex();
+    index.files.push_back(_keyPath);
+    index.files.insert(index.files.end(), _bifPaths.begin(), _bifPaths.end());
+    index.entries.reserve(_idToResource.size());
+    for (auto &[id, resource] : _idToResource) {
+        auto entry = ResourceIndex::Entry();
+        entry.id = id;
+        entry.fileIdx = static_cast<uint32_t>(resource.bifIdx + 1);
+        entry.offset = resource.bifOffset;
+        entry.size = resource.fileSize;
+        index.entries.push_back(std::move(entry));
+    }
+    return index;
+}
+
 std::optional<ByteBuffer> KeyBifResourceContainer::findResourceData(const ResourceId &id) {
     auto it = _idToResource.find(id);
     if (it == _idToResource.end()) {
@@ -78,6 +109,9 @@ std::optional<ByteBuffer> KeyBifResourceContainer::findResourceData(const Resour
     buf.resize(resource.fileSize);
 
     auto &bif = _bifs.at(resource.bifIdx);
+    if (!bif) {
+        bif = std::make_unique<FileInputStream>(_bifPaths[resource.bifIdx]);
+    }
     bif->seek(resource.bifOffset, SeekOrigin::Begin);
     bif->read(&buf[0], buf.size());
 
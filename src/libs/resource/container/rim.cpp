@@ -40,6 +40,33 @@ void RimResourceContainer::init() {
     }
 }
 
+void RimResourceContainer::init(const ResourceIndex &index) {
+    _rim = std::make_unique<FileInputStream>(_path);
+
+    for (auto &entry : index.entries) {
+        auto resource = Resource();
+        resource.id = entry.id;
+        resource.offset = entry.offset;
+        resource.fileSize = entry.size;
+        _resourceIds.insert(resource.id);
+        _idToResource.insert(std::make_pair(resource.id, std::move(resource)));
+    }
+}
+
+ResourceIndex RimResourceContainer::index() const {
+    auto index = ResourceIndex();
+    index.files.push_back(_path);
+    index.entries.reserve(_idToResource.size());
+    for (auto &[id, resource] : _idToResource) {
+        auto entry = ResourceIndex::Entry();
+        entry.id = id;
+        entry.offset = resource.offset;
+        entry.size = resource.fileSize;
+        index.entries.push_back(std::move(entry));
+    }
+    return index;
+}
+
 std::optional<ByteBuffer> RimResourceContainer::findResourceData(const ResourceId &id) {
     auto it = _idToResource.find(id);
     if (it == _idToResource.end()) {
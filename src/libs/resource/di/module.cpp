@@ -25,12 +25,18 @@ namespace reone {
 
 namespace resource {
 
+static constexpr char kIndexCacheFilename[] = "resindex.bin";
+
 void ResourceModule::init() {
+    _indexCache = std::make_unique<ResourceIndexCache>(std::filesystem::current_path() / kIndexCacheFilename);
+    _indexCache->load();
     _resources = std::make_unique<Resources>();
+    _resources->setIndexCache(_indexCache.get());
     _strings = std::make_unique<Strings>();
     _twoDas = std::make_unique<TwoDAs>(*_resources);
     _gffs = std::make_unique<Gffs>(*_resources);
     _shaders = std::make_unique<Shaders>(_graphicsOpt, _graphics.shaderRegistry(), *_resources);
+    _shaders->setProgramBinaryCache(&_graphics.programBinaryCache());
     _textures = std::make_unique<Textures>(_graphicsOpt, *_resources);
     _models = std::make_unique<Models>(*_textures, *_resources, _graphics.statistic());
     _walkmeshes = std::make_unique<Walkmeshes>(*_resources);
@@ -72,7 +78,9 @@ void ResourceModule::init() {
         *_resources,
         *_scripts);
 
+    _director->setFixture(_fixture);
     _director->init();
+    _indexCache->save();
     _strings->init(_gamePath);
     _shaders->init();
     _textures->init();
@@ -125,6 +133,11 @@ void ResourceModule::deinit() {
     _twoDas.reset();
     _strings.reset();
     _resources.reset();
+
+    if (_indexCache) {
+        _indexCache->save();
+        _indexCache.reset();
+    }
 }
 
 } // namespace resource
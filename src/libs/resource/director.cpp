@@ -99,7 +99,9 @@ std::set<std::string> ResourceDirector::moduleNames() {
 }
 
 void ResourceDirector::loadGlobalResources() {
-    _resources.addERF(getFileIgnoreCase(std::filesystem::current_path(), kShaderPackFilename));
+    if (!_graphicsOpt.headless) {
+        _resources.addERF(getFileIgnoreCase(std::filesystem::current_path(), kShaderPackFilename));
+    }
 
     auto keyPath = findFileIgnoreCase(_gamePath, kKeyFilename);
     if (keyPath) {
@@ -112,13 +114,40 @@ void ResourceDirector::loadGlobalResources() {
         if (guiPackPath) {
             _resources.addERF(*guiPackPath);
         }
-        auto &texPack = kTexQualityToTexPack.at(_graphicsOpt.textureQuality);
+        auto &texPack = kTexQualityToTexPack.at(_fixture ? TextureQuality::High : _graphicsOpt.textureQuality);
         auto texPackPath = findFileIgnoreCase(*texPacksPath, texPack);
         if (texPackPath) {
             _resources.addERF(*texPackPath);
         }
     }
 
+    if (!_fixture) {
+        loadStreamedResources();
+    }
+
+    auto patchPath = findFileIgnoreCase(_gamePath, kPatchFilename);
+    if (patchPath) {
+        _resources.addERF(*patchPath);
+    }
+    if (!_fixture) {
+        auto overridePath = findFileIgnoreCase(_gamePath, kOverrideDirectoryName);
+        if (overridePath) {
+            _resources.addFolder(*overridePath);
+        }
+    }
+
+    std::optional<std::filesystem::path> exePath;
+    if (_gameId == GameID::TSL) {
+        exePath = findFileIgnoreCase(_gamePath, kExeFilenameTsl);
+    } else {
+        exePath = findFileIgnoreCase(_gamePath, kExeFilenameKotor);
+    }
+    if (exePath) {
+        _resources.addEXE(*exePath);
+    }
+}
+
+void ResourceDirector::loadStreamedResources() {
     auto musicPath = findFileIgnoreCase(_gamePath, kMusicDirectoryName);
     if (musicPath) {
         _resources.addFolder(*musicPath);
@@ -149,25 +178,6 @@ void ResourceDirector::loadGlobalResources() {
             }
         }
     }
-
-    auto patchPath = findFileIgnoreCase(_gamePath, kPatchFilename);
-    if (patchPath) {
-        _resources.addERF(*patchPath);
-    }
-    auto overridePath = findFileIgnoreCase(_gamePath, kOverrideDirectoryName);
-    if (overridePath) {
-        _resources.addFolder(*overridePath);
-    }
-
-    std::optional<std::filesystem::path> exePath;
-    if (_gameId == GameID::TSL) {
-        exePath = findFileIgnoreCase(_gamePath, kExeFilenameTsl);
-    } else {
-        exePath = findFileIgnoreCase(_gamePath, kExeFilenameKotor);
-    }
-    if (exePath) {
-        _resources.addEXE(*exePath);
-    }
 }
 
 void ResourceDirector::loadModuleResources(const std::string &name) {
@@ -194,7 +204,7 @@ void ResourceDirector::loadModuleResources(const std::string &name) {
     }
 
     auto lipsPath = findFileIgnoreCase(_gamePath, kLipsDirectoryName);
-    if (lipsPath) {
+    if (lipsPath && !_fixture) {
         auto locModPath = findFileIgnoreCase(*lipsPath, name + "_loc.mod");
         if (locModPath) {
             resources.addERF(*locModPath, true);
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/resource/format/archiveoutput.h"
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <unistd.h>
+#endif
+
+namespace reone {
+
+namespace resource {
+
+ArchiveFileOutput::ArchiveFileOutput(const std::filesystem::path &path, size_t bufferSize) :
+    _bufferSize(bufferSize) {
+#ifdef __linux__
+    _fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (_fd == -1) {
+        throw std::runtime_error("Failed to open file for writing: " + path.string());
+    }
+#else
+    _stream.open(path, std::ios::binary);
+    if (!_stream) {
+        throw std::runtime_error("Failed to open file for writing: " + path.string());
+    }
+#endif
+    _buffer.reserve(_bufferSize);
+}
+
+ArchiveFileOutput::~ArchiveFileOutput() {
+    try {
+        close();
+    } catch (const std::exception &) {
+    }
+}
+
+void ArchiveFileOutput::writeByte(uint8_t val) {
+    char ch = static_cast<char>(val);
+    write(&ch, 1);
+}
+
+void ArchiveFileOutput::write(const char *buf, int len) {
+    if (_buffer.size() + len > _bufferSize) {
+        flush();
+    }
+    if (static_cast<size_t>(len) > _bufferSize) {
+        writeDirect(buf, len);
+    } else {
+        _buffer.insert(_buffer.end(), buf, buf + len);
+    }
+    _position += len;
+}
+
+void ArchiveFileOutput::copyFrom(const std::filesystem::path &path, uint64_t size) {
+    flush();
+#ifdef __linux__
+    int inFd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (inFd == -1) {
+        throw std::runtime_error("Failed to open resource file: " + path.string());
+    }
+    uint64_t left = size;
+    bool copyRangeSupported = true;
+    while (left > 0) {
+        ssize_t copied = -1;
+        if (copyRangeSupported) {
+            copied = ::copy_file_range(inFd, nullptr, _fd, nullptr, left, 0);
+            if (copied == -1 && (errno == EXDEV || errno == ENOSYS || errno == EINVAL || errno == EOPNOTSUPP)) {
+                copyRangeSupported = false;
+                continue;
+            }
+        } else {
+            copied = ::sendfile(_fd, inFd, nullptr, left);
+        }
+        if (copied == -1 && errno == EINTR) {
+            continue;
+        }
+        if (copied <= 0) {
+            ::close(inFd);
+            throw std::runtime_error("Failed to copy resource file: " + path.string());
+        }
+        left -= copied;
+    }
+    ::close(inFd);
+#else
+    auto in = std::ifstream(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Failed to open resource file: " + path.string());
+    }
+    ByteBuffer chunk(std::min<uint64_t>(size, _bufferSize));
+    uint64_t left = size;
+    while (left > 0) {
+        auto chunkSize = static_cast<std::streamsize>(std::min<uint64_t>(left, chunk.size()));
+        in.read(&chunk[0], chunkSize);
+        if (in.gcount() != chunkSize) {
+            throw std::runtime_error("Failed to copy resource file: " + path.string());
+        }
+        writeDirect(&chunk[0], chunkSize);
+        left -= chunkSize;
+    }
+#endif
+    _position += size;
+}
+
+void ArchiveFileOutput::close() {
+#ifdef __linux__
+    if (_fd == -1) {
+        return;
+    }
+    flush();
+    ::close(_fd);
+    _fd = -1;
+#else
+    if (!_stream.is_open()) {
+        return;
+    }
+    flush();
+    _stream.close();
+#endif
+}
+
+void ArchiveFileOutput::flush() {
+    if (_buffer.empty()) {
+        return;
+    }
+    writeDirect(&_buffer[0], _buffer.size());
+    _buffer.clear();
+}
+
+void ArchiveFileOutput::writeDirect(const char *buf, size_t len) {
+#ifdef __linux__
+    while (len > 0) {
+        ssize_t written = ::write(_fd, buf, len);
+        if (written == -1 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            throw std::runtime_error("Failed to write to file");
+        }
+        buf += written;
+        len -= written;
+    }
+#else
+    _stream.write(buf, len);
+#endif
+}
+
+} // namespace resource
+
+} // namespace reone
@@ -17,8 +17,8 @@
 
 #include "reone/resource/format/erfwriter.h"
 
+#include "reone/resource/format/archiveoutput.h"
 #include "reone/system/binarywriter.h"
-#include "reone/system/stream/fileoutput.h"
 
 namespace reone {
 
@@ -28,17 +28,22 @@ static constexpr int kKeyStructSize = 24;
 static constexpr int kResourceStructSize = 8;
 
 void ErfWriter::add(Resource &&res) {
-    _resources.push_back(res);
+    add(std::move(res.resRef), res.resType, ResourcePayload::fromBytes(std::move(res.data)));
+}
+
+void ErfWriter::add(std::string resRef, ResType resType, ResourcePayload payload) {
+    _entries.push_back(Entry {std::move(resRef), resType, std::move(payload)});
 }
 
 void ErfWriter::save(FileType type, const std::filesystem::path &path) {
-    auto out = FileOutputStream(path);
+    auto out = ArchiveFileOutput(path);
     save(type, out);
+    out.close();
 }
 
 void ErfWriter::save(FileType type, IOutputStream &out) {
     BinaryWriter writer(out);
-    auto numResources = static_cast<uint32_t>(_resources.size());
+    auto numResources = static_cast<uint32_t>(_entries.size());
     uint32_t offResources = 0xa0 + kKeyStructSize * numResources;
 
     if (type == FileType::MOD) {
@@ -60,7 +65,7 @@ void ErfWriter::save(FileType type, IOutputStream &out) {
     uint32_t id = 0;
 
     // Write keys
-    for (auto &res : _resources) {
+    for (auto &res : _entries) {
         std::string resRef(res.resRef);
         resRef.resize(16);
         writer.writeString(resRef);
@@ -70,19 +75,21 @@ void ErfWriter::save(FileType type, IOutputStream &out) {
         writer.writeUint16(0); // unused
     }
 
-    uint32_t offset = 0xa0 + (kKeyStructSize + kResourceStructSize) * numResources;
+    uint64_t offset = 0xa0 + (kKeyStructSize + kResourceStructSize) * numResources;
 
     // Write resources
-    for (auto &res : _resources) {
-        auto size = static_cast<uint32_t>(res.data.size());
-        writer.writeUint32(offset);
-        writer.writeUint32(size);
-        offset += size;
+    for (auto &res : _entries) {
+        if (offset + res.payload.size > std::numeric_limits<uint32_t>::max()) {
+            throw std::runtime_error("ERF size exceeds 4 GiB");
+        }
+        writer.writeUint32(static_cast<uint32_t>(offset));
+        writer.writeUint32(res.payload.size);
+        offset += res.payload.size;
     }
 
     // Write resource data
-    for (auto &res : _resources) {
-        writer.write(res.data);
+    for (auto &res : _entries) {
+        res.payload.writeTo(out);
     }
 }
 
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/resource/format/gffview.h"
+
+#include "reone/system/exception/validation.h"
+#include "reone/system/logutil.h"
+
+namespace reone {
+
+namespace resource {
+
+static constexpr int kHeaderSize = 56;
+static constexpr int kLabelSize = 16;
+
+void GffView::init() {
+    checkRange(0, kHeaderSize);
+
+    _structOffset = readAt<uint32_t>(8);
+    _structCount = readAt<uint32_t>(12);
+    _fieldOffset = readAt<uint32_t>(16);
+    _fieldCount = readAt<uint32_t>(20);
+    _labelOffset = readAt<uint32_t>(24);
+    _labelCount = readAt<uint32_t>(28);
+    _fieldDataOffset = readAt<uint32_t>(32);
+    _fieldIndicesOffset = readAt<uint32_t>(40);
+    _listIndicesOffset = readAt<uint32_t>(48);
+
+    checkRange(_structOffset, 12ll * _structCount);
+    checkRange(_fieldOffset, 12ll * _fieldCount);
+    checkRange(_labelOffset, static_cast<int64_t>(kLabelSize) * _labelCount);
+}
+
+std::vector<int> GffView::mapLabels(const std::vector<std::string_view> &sortedNames) const {
+    std::vector<int> slots(_labelCount, -1);
+    for (uint32_t i = 0; i < _labelCount; ++i) {
+        auto name = label(i);
+        auto it = std::lower_bound(sortedNames.begin(), sortedNames.end(), name);
+        if (it != sortedNames.end() && *it == name) {
+            slots[i] = static_cast<int>(std::distance(sortedNames.begin(), it));
+        }
+    }
+    return slots;
+}
+
+GffView::Struct GffView::structAt(uint32_t idx) const {
+    if (idx >= _structCount) {
+        throw ValidationException("GFF struct index out of range: " + std::to_string(idx));
+    }
+    int64_t offset = _structOffset + 12ll * idx;
+    Struct strct;
+    strct.type = readAt<uint32_t>(offset);
+    strct.dataOrDataOffset = readAt<uint32_t>(offset + 4);
+    strct.fieldCount = readAt<uint32_t>(offset + 8);
+    return strct;
+}
+
+GffView::Field GffView::field(uint32_t idx) const {
+    if (idx >= _fieldCount) {
+        throw ValidationException("GFF field index out of range: " + std::to_string(idx));
+    }
+    int64_t offset = _fieldOffset + 12ll * idx;
+    Field field;
+    field.type = static_cast<Gff::FieldType>(readAt<uint32_t>(offset));
+    field.labelIndex = readAt<uint32_t>(offset + 4);
+    field.dataOrDataOffset = readAt<uint32_t>(offset + 8);
+    if (field.labelIndex >= _labelCount) {
+        throw ValidationException("GFF label index out of range: " + std::to_string(field.labelIndex));
+    }
+    return field;
+}
+
+std::string_view GffView::label(uint32_t idx) const {
+    auto data = reinterpret_cast<const char *>(&_bytes[_labelOffset + kLabelSize * idx]);
+    auto end = static_cast<const char *>(std::memchr(data, '\0', kLabelSize));
+    return std::string_view(data, end ? end - data : kLabelSize);
+}
+
+int GffView::getInt(const Field &field) const {
+    switch (field.type) {
+    case Gff::FieldType::CExoLocString:
+    case Gff::FieldType::StrRef:
+        // Both start with a total size, followed by a string reference
+        return readAt<int32_t>(_fieldDataOffset + field.dataOrDataOffset + 4ll);
+    default:
+        return static_cast<int32_t>(getUint(field));
+    }
+}
+
+int64_t GffView::readInt64(const Field &field) const {
+    return static_cast<int64_t>(readUint64(field));
+}
+
+uint32_t GffView::getUint(const Field &field) const {
+    switch (field.type) {
+    case Gff::FieldType::Byte:
+    case Gff::FieldType::Char:
+    case Gff::FieldType::Word:
+    case Gff::FieldType::Short:
+    case Gff::FieldType::Dword:
+    case Gff::FieldType::Int:
+    case Gff::FieldType::Float:
+        return field.dataOrDataOffset;
+    default:
+        return 0;
+    }
+}
+
+uint64_t GffView::readUint64(const Field &field) const {
+    switch (field.type) {
+    case Gff::FieldType::Dword64:
+    case Gff::FieldType::Int64:
+    case Gff::FieldType::Double:
+        return readAt<uint64_t>(_fieldDataOffset + field.dataOrDataOffset);
+    default:
+        return getUint(field);
+    }
+}
+
+float GffView::getFloat(const Field &field) const {
+    if (field.type != Gff::FieldType::Float) {
+        return 0.0f;
+    }
+    float value;
+    std::memcpy(&value, &field.dataOrDataOffset, sizeof(float));
+    return value;
+}
+
+double GffView::getDouble(const Field &field) const {
+    if (field.type != Gff::FieldType::Double) {
+        return 0.0;
+    }
+    uint64_t bits = readUint64(field);
+    double value;
+    std::memcpy(&value, &bits, sizeof(double));
+    return value;
+}
+
+std::string GffView::getString(const Field &field) const {
+    int64_t offset = _fieldDataOffset + field.dataOrDataOffset;
+    switch (field.type) {
+    case Gff::FieldType::CExoString: {
+        auto size = readAt<uint32_t>(offset);
+        checkRange(offset + 4, size);
+        return std::string(&_bytes[offset + 4], size);
+    }
+    case Gff::FieldType::ResRef: {
+        auto size = readAt<uint8_t>(offset);
+        checkRange(offset + 1, size);
+        return std::string(&_bytes[offset + 1], size);
+    }
+    case Gff::FieldType::CExoLocString: {
+        auto count = readAt<uint32_t>(offset + 8);
+        if (count == 0) {
+            return "";
+        }
+        if (count > 1) {
+            warn("GFF: more than one substring in CExoLocString, ignoring");
+            return "";
+        }
+        auto size = readAt<uint32_t>(offset + 16);
+        checkRange(offset + 20, size);
+        return std::string(&_bytes[offset + 20], size);
+    }
+    default:
+        return "";
+    }
+}
+
+glm::vec3 GffView::getVector(const Field &field) const {
+    if (field.type != Gff::FieldType::Vector) {
+        return glm::vec3(0.0f);
+    }
+    int64_t offset = _fieldDataOffset + field.dataOrDataOffset;
+    return glm::vec3(
+        readAt<float>(offset),
+        readAt<float>(offset + 4),
+        readAt<float>(offset + 8));
+}
+
+glm::quat GffView::getOrientation(const Field &field) const {
+    if (field.type != Gff::FieldType::Orientation) {
+        return glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    }
+    int64_t offset = _fieldDataOffset + field.dataOrDataOffset;
+    return glm::quat(
+        readAt<float>(offset),
+        readAt<float>(offset + 4),
+        readAt<float>(offset + 8),
+        readAt<float>(offset + 12));
+}
+
+GffView::Struct GffView::getStruct(const Field &field) const {
+    if (field.type != Gff::FieldType::Struct) {
+        throw ValidationException("GFF field is not a struct: " + std::string(label(field.labelIndex)));
+    }
+    return structAt(field.dataOrDataOffset);
+}
+
+ByteBuffer GffView::getData(const Field &field) const {
+    if (field.type != Gff::FieldType::Void) {
+        return ByteBuffer();
+    }
+    int64_t offset = _fieldDataOffset + field.dataOrDataOffset;
+    auto size = readAt<uint32_t>(offset);
+    checkRange(offset + 4, size);
+    return ByteBuffer(_bytes.begin() + offset + 4, _bytes.begin() + offset + 4 + size);
+}
+
+void GffView::checkRange(int64_t offset, int64_t size) const {
+    if (offset < 0 || size < 0 || offset + size > static_cast<int64_t>(_bytes.size())) {
+        throw ValidationException(str(boost::format("GFF read out of bounds: offset=%d, size=%d") % offset % size));
+    }
+}
+
+} // namespace resource
+
+} // namespace reone
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/resource/format/resourcepayload.h"
+
+#include "reone/resource/format/archiveoutput.h"
+#include "reone/system/exception/validation.h"
+#include "reone/system/stream/output.h"
+
+namespace reone {
+
+namespace resource {
+
+static constexpr size_t kCopyChunkSize = 64 * 1024;
+
+static uint32_t checkPayloadSize(uintmax_t size) {
+    if (size > std::numeric_limits<uint32_t>::max()) {
+        throw ValidationException(str(boost::format("Resource payload too large: %d bytes") % size));
+    }
+    return static_cast<uint32_t>(size);
+}
+
+void ResourcePayload::writeTo(IOutputStream &out) const {
+    if (!path.empty()) {
+        auto fileOut = dynamic_cast<ArchiveFileOutput *>(&out);
+        if (fileOut) {
+            fileOut->copyFrom(path, size);
+            return;
+        }
+        auto in = std::ifstream(path, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("Failed to open resource file: " + path.string());
+        }
+        ByteBuffer chunk(std::min<size_t>(size, kCopyChunkSize));
+        uint64_t left = size;
+        while (left > 0) {
+            auto chunkSize = static_cast<std::streamsize>(std::min<uint64_t>(left, chunk.size()));
+            in.read(&chunk[0], chunkSize);
+            if (in.gcount() != chunkSize) {
+                throw std::runtime_error("Resource file is shorter than expected: " + path.string());
+            }
+            out.write(&chunk[0], static_cast<int>(chunkSize));
+            left -= chunkSize;
+        }
+        return;
+    }
+    if (writeFunc) {
+        auto start = out.position();
+        writeFunc(out);
+        if (out.position() - start != size) {
+            throw std::runtime_error(str(boost::format("Resource callback wrote %d bytes, expected %d") % (out.position() - start) % size));
+        }
+        return;
+    }
+    for (size_t offset = 0; offset < bytes.size(); offset += kCopyChunkSize) {
+        auto chunkSize = std::min(bytes.size() - offset, kCopyChunkSize);
+        out.write(&bytes[offset], static_cast<int>(chunkSize));
+    }
+}
+
+ResourcePayload ResourcePayload::fromBytes(ByteBuffer bytes) {
+    ResourcePayload payload;
+    payload.size = checkPayloadSize(bytes.size());
+    payload.bytes = std::move(bytes);
+    return payload;
+}
+
+ResourcePayload ResourcePayload::fromFile(std::filesystem::path path) {
+    ResourcePayload payload;
+    payload.size = checkPayloadSize(std::filesystem::file_size(path));
+    payload.path = std::move(path);
+    return payload;
+}
+
+ResourcePayload ResourcePayload::fromCallback(uint32_t size, WriteFunc func) {
+    ResourcePayload payload;
+    payload.size = size;
+    payload.writeFunc = std::move(func);
+    return payload;
+}
+
+} // namespace resource
+
+} // namespace reone
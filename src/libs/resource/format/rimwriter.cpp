@@ -17,25 +17,30 @@
 
 #include "reone/resource/format/rimwriter.h"
 
+#include "reone/resource/format/archiveoutput.h"
 #include "reone/system/binarywriter.h"
-#include "reone/system/stream/fileoutput.h"
 
 namespace reone {
 
 namespace resource {
 
 void RimWriter::add(Resource &&res) {
-    _resources.push_back(res);
+    add(std::move(res.resRef), res.resType, ResourcePayload::fromBytes(std::move(res.data)));
+}
+
+void RimWriter::add(std::string resRef, ResType resType, ResourcePayload payload) {
+    _entries.push_back(Entry {std::move(resRef), resType, std::move(payload)});
 }
 
 void RimWriter::save(const std::filesystem::path &path) {
-    auto rim = FileOutputStream(path);
+    auto rim = ArchiveFileOutput(path);
     save(rim);
+    rim.close();
 }
 
 void RimWriter::save(IOutputStream &out) {
     BinaryWriter writer(out);
-    uint32_t numResources = static_cast<uint32_t>(_resources.size());
+    uint32_t numResources = static_cast<uint32_t>(_entries.size());
 
     writer.writeString("RIM V1.0");
     writer.writeUint32(0); // reserved
@@ -44,11 +49,14 @@ void RimWriter::save(IOutputStream &out) {
     writer.write(100, 0); // reserved
 
     uint32_t id = 0;
-    uint32_t offset = 0x78 + numResources * 32;
+    uint64_t offset = 0x78 + numResources * 32;
 
     // Write resource headers
-    for (auto &res : _resources) {
-        auto size = static_cast<uint32_t>(res.data.size());
+    for (auto &res : _entries) {
+        auto size = res.payload.size;
+        if (offset + size > std::numeric_limits<uint32_t>::max()) {
+            throw std::runtime_error("RIM size exceeds 4 GiB");
+        }
 
         std::string resRef(res.resRef);
         resRef.resize(16);
@@ -56,15 +64,15 @@ void RimWriter::save(IOutputStream &out) {
 
         writer.writeUint32(static_cast<uint32_t>(res.resType));
         writer.writeUint32(id++);
-        writer.writeUint32(offset);
+        writer.writeUint32(static_cast<uint32_t>(offset));
         writer.writeUint32(size);
 
         offset += size;
     }
 
     // Write resources data
-    for (auto &res : _resources) {
-        writer.write(res.data);
+    for (auto &res : _entries) {
+        res.payload.writeTo(out);
     }
 }
 
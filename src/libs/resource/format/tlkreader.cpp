@@ -41,7 +41,14 @@ void TlkReader::load() {
 }
 
 void TlkReader::loadStrings() {
-    auto strings = std::vector<TalkTable::String>();
+    // String data block is read as is, sound ResRefs are appended to it
+    size_t length = _tlk.length();
+    size_t dataSize = length > _stringsOffset ? length - _stringsOffset : 0;
+    auto data = dataSize > 0 ? _tlk.readBytesAt(_stringsOffset, static_cast<int>(dataSize)) : ByteBuffer();
+    auto soundResRefs = std::string();
+
+    auto entries = std::vector<TalkTable::Entry>();
+    entries.reserve(_stringCount);
 
     for (uint32_t i = 0; i < _stringCount; ++i) {
         uint32_t flags = _tlk.readUint32();
@@ -55,15 +62,21 @@ void TlkReader::loadStrings() {
         uint32_t stringSize = _tlk.readUint32();
         float soundLength = _tlk.readFloat();
 
-        std::string text;
-        if (flags & StringFlags::textPresent) {
-            text = _tlk.readStringAt(_stringsOffset + stringOffset, stringSize);
+        auto entry = TalkTable::Entry();
+        if ((flags & StringFlags::textPresent) && stringOffset < dataSize) {
+            entry.textOffset = stringOffset;
+            entry.textSize = static_cast<uint32_t>(std::min<size_t>(stringSize, dataSize - stringOffset));
         }
-
-        strings.push_back(TalkTable::String {std::move(text), std::move(soundResRef)});
+        if (!soundResRef.empty()) {
+            entry.soundResRefOffset = static_cast<uint32_t>(dataSize + soundResRefs.size());
+            entry.soundResRefSize = static_cast<uint32_t>(soundResRef.size());
+            soundResRefs += soundResRef;
+        }
+        entries.push_back(std::move(entry));
     }
 
-    _table = std::make_unique<TalkTable>(std::move(strings));
+    data.insert(data.end(), soundResRefs.begin(), soundResRefs.end());
+    _table = std::make_shared<TalkTable>(std::move(data), std::move(entries));
 }
 
 } // namespace resource
@@ -42,11 +42,11 @@ void TlkWriter::save(IOutputStream &out) {
 
     uint32_t offString = 0;
     for (int i = 0; i < _talkTable.getStringCount(); ++i) {
-        auto &str = _talkTable.getString(i);
-        auto strSize = static_cast<uint32_t>(str.text.length());
+        auto text = _talkTable.getText(i);
+        auto strSize = static_cast<uint32_t>(text.length());
 
         StringDataElement strDataElem;
-        strDataElem.soundResRef = str.soundResRef;
+        strDataElem.soundResRef = std::string(_talkTable.getSoundResRef(i));
         strDataElem.offString = offString;
         strDataElem.stringSize = strSize;
         strData.push_back(std::move(strDataElem));
@@ -76,7 +76,7 @@ void TlkWriter::save(IOutputStream &out) {
     }
 
     for (int i = 0; i < _talkTable.getStringCount(); ++i) {
-        writer.writeString(_talkTable.getString(i).text);
+        writer.writeString(std::string(_talkTable.getText(i)));
     }
 }
 
@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/resource/indexcache.h"
+
+#include "reone/system/binaryreader.h"
+#include "reone/system/binarywriter.h"
+#include "reone/system/exception/endofstream.h"
+#include "reone/system/exception/validation.h"
+#include "reone/system/logutil.h"
+#include "reone/system/stream/fileinput.h"
+#include "reone/system/stream/fileoutput.h"
+#include "reone/system/stream/memoryinput.h"
+
+namespace reone {
+
+namespace resource {
+
+static constexpr char kSignature[] = "RIDXV1.0";
+static constexpr int kHeaderSize = 40;
+static constexpr int kContainerStructSize = 24;
+static constexpr int kFileStructSize = 24;
+static constexpr int kEntryStructSize = 40;
+
+void ResourceIndexCache::load() {
+    _pathToIndex.clear();
+    _dirty = false;
+
+    if (!std::filesystem::exists(_path)) {
+        return;
+    }
+    auto file = FileInputStream(_path);
+    auto buffer = ByteBuffer(file.length());
+    if (buffer.empty()) {
+        return;
+    }
+    file.read(&buffer[0], static_cast<int>(buffer.size()));
+
+    auto stream = MemoryInputStream(buffer);
+    auto reader = BinaryReader(stream);
+    try {
+        if (reader.readString(8) != std::string(kSignature)) {
+            throw ValidationException("Invalid resource index cache signature");
+        }
+        uint32_t numContainers = reader.readUint32();
+        uint32_t numFiles = reader.readUint32();
+        uint32_t numEntries = reader.readUint32();
+        uint32_t offContainers = reader.readUint32();
+        uint32_t offFiles = reader.readUint32();
+        uint32_t offEntries = reader.readUint32();
+        uint32_t offStrings = reader.readUint32();
+        uint32_t stringsSize = reader.readUint32();
+        if (offStrings + static_cast<uint64_t>(stringsSize) > buffer.size()) {
+            throw ValidationException("Resource index cache string table out of bounds");
+        }
+        auto stringAt = [&buffer, &offStrings, &stringsSize](uint32_t off, uint32_t len) {
+            if (off + static_cast<uint64_t>(len) > stringsSize) {
+                throw ValidationException("Resource index cache string out of bounds");
+            }
+            return std::string(&buffer[offStrings + off], len);
+        };
+
+        std::vector<std::filesystem::path> filePaths;
+        std::vector<FileStamp> fileStamps;
+        filePaths.reserve(numFiles);
+        fileStamps.reserve(numFiles);
+        reader.seek(offFiles);
+        for (uint32_t i = 0; i < numFiles; ++i) {
+            uint32_t pathOff = reader.readUint32();
+            uint32_t pathLen = reader.readUint32();
+            auto stamp = FileStamp();
+            stamp.size = reader.readUint64();
+            stamp.modifiedAt = reader.readInt64();
+            filePaths.push_back(stringAt(pathOff, pathLen));
+            fileStamps.push_back(stamp);
+        }
+
+        std::vector<ResourceIndex::Entry> entries;
+        entries.reserve(numEntries);
+        reader.seek(offEntries);
+        for (uint32_t i = 0; i < numEntries; ++i) {
+            auto resRef = reader.readString(kMaxResRefLength);
+            resRef.erase(std::find(resRef.begin(), resRef.end(), '\0'), resRef.end());
+            auto resType = static_cast<ResType>(reader.readUint16());
+            reader.skipBytes(2); // unused
+            auto entry = ResourceIndex::Entry();
+            entry.id = ResourceId(std::move(resRef), resType);
+            entry.fileIdx = reader.readUint32();
+            entry.offset = reader.readUint32();
+            entry.size = reader.readUint32();
+            uint32_t nameOff = reader.readUint32();
+            uint32_t nameLen = reader.readUint32();
+            if (nameLen > 0) {
+                entry.name = stringAt(nameOff, nameLen);
+            }
+            entries.push_back(std::move(entry));
+        }
+
+        reader.seek(offContainers);
+        for (uint32_t i = 0; i < numContainers; ++i) {
+            uint32_t pathOff = reader.readUint32();
+            uint32_t pathLen = reader.readUint32();
+            uint32_t firstFile = reader.readUint32();
+            uint32_t containerNumFiles = reader.readUint32();
+            uint32_t firstEntry = reader.readUint32();
+            uint32_t containerNumEntries = reader.readUint32();
+            if (firstFile + static_cast<uint64_t>(containerNumFiles) > numFiles ||
+                firstEntry + static_cast<uint64_t>(containerNumEntries) > numEntries) {
+                throw ValidationException("Resource index cache container out of bounds");
+            }
+            auto cached = CachedIndex();
+            cached.index.files.assign(filePaths.begin() + firstFile, filePaths.begin() + firstFile + containerNumFiles);
+            cached.stamps.assign(fileStamps.begin() + firstFile, fileStamps.begin() + firstFile + containerNumFiles);
+            cached.index.entries.assign(
+                std::make_move_iterator(entries.begin() + firstEntry),
+                std::make_move_iterator(entries.begin() + firstEntry + containerNumEntries));
+            _pathToIndex[stringAt(pathOff, pathLen)] = std::move(cached);
+        }
+    } catch (const std::exception &e) {
+        warn("Ignoring resource index cache: " + std::string(e.what()), LogChannel::Resources);
+        _pathToIndex.clear();
+    }
+}
+
+void ResourceIndexCache::save() {
+    if (!_dirty) {
+        return;
+    }
+
+    std::string strings;
+    auto addString = [&strings](const std::string &str) {
+        auto off = static_cast<uint32_t>(strings.size());
+        strings.append(str);
+        return std::make_pair(off, static_cast<uint32_t>(str.size()));
+    };
+    uint32_t numFiles = 0;
+    uint32_t numEntries = 0;
+    for (auto &[_, cached] : _pathToIndex) {
+        numFiles += static_cast<uint32_t>(cached.index.files.size());
+        numEntries += static_cast<uint32_t>(cached.index.entries.size());
+    }
+    auto numContainers = static_cast<uint32_t>(_pathToIndex.size());
+    uint32_t offContainers = kHeaderSize;
+    uint32_t offFiles = offContainers + kContainerStructSize * numContainers;
+    uint32_t offEntries = offFiles + kFileStructSize * numFiles;
+    uint32_t offStrings = offEntries + kEntryStructSize * numEntries;
+
+    auto tmpPath = _path;
+    tmpPath += ".tmp";
+    {
+        auto out = FileOutputStream(tmpPath);
+        auto writer = BinaryWriter(out);
+
+        // Containers, files and entries are written in the same order,
+        // so that string offsets can be assigned in one pass per table
+        std::vector<std::pair<uint32_t, uint32_t>> containerPaths;
+        std::vector<std::pair<uint32_t, uint32_t>> filePaths;
+        std::vector<std::pair<uint32_t, uint32_t>> entryNames;
+        for (auto &[path, cached] : _pathToIndex) {
+            containerPaths.push_back(addString(path));
+            for (auto &filePath : cached.index.files) {
+                filePaths.push_back(addString(filePath.string()));
+            }
+            for (auto &entry : cached.index.entries) {
+                entryNames.push_back(entry.name.empty() ? std::make_pair(0u, 0u) : addString(entry.name));
+            }
+        }
+
+        writer.writeString(kSignature);
+        writer.writeUint32(numContainers);
+        writer.writeUint32(numFiles);
+        writer.writeUint32(numEntries);
+        writer.writeUint32(offContainers);
+        writer.writeUint32(offFiles);
+        writer.writeUint32(offEntries);
+        writer.writeUint32(offStrings);
+        writer.writeUint32(static_cast<uint32_t>(strings.size()));
+
+        uint32_t firstFile = 0;
+        uint32_t firstEntry = 0;
+        int containerIdx = 0;
+        for (auto &[_, cached] : _pathToIndex) {
+            auto containerNumFiles = static_cast<uint32_t>(cached.index.files.size());
+            auto containerNumEntries = static_cast<uint32_t>(cached.index.entries.size());
+            writer.writeUint32(containerPaths[containerIdx].first);
+            writer.writeUint32(containerPaths[containerIdx].second);
+            writer.writeUint32(firstFile);
+            writer.writeUint32(containerNumFiles);
+            writer.writeUint32(firstEntry);
+            writer.writeUint32(containerNumEntries);
+            firstFile += containerNumFiles;
+            firstEntry += containerNumEntries;
+            ++containerIdx;
+        }
+
+        int fileIdx = 0;
+        for (auto &[_, cached] : _pathToIndex) {
+            for (auto &stamp : cached.stamps) {
+                writer.writeUint32(filePaths[fileIdx].first);
+                writer.writeUint32(filePaths[fileIdx].second);
+                writer.writeInt64(static_cast<int64_t>(stamp.size));
+                writer.writeInt64(stamp.modifiedAt);
+                ++fileIdx;
+            }
+        }
+
+        int entryIdx = 0;
+        for (auto &[_, cached] : _pathToIndex) {
+            for (auto &entry : cached.index.entries) {
+                std::string resRef(entry.id.resRef.value());
+                resRef.resize(kMaxResRefLength);
+                writer.writeString(resRef);
+                writer.writeUint16(static_cast<uint16_t>(entry.id.type));
+                writer.writeUint16(0); // unused
+                writer.writeUint32(entry.fileIdx);
+                writer.writeUint32(entry.offset);
+                writer.writeUint32(entry.size);
+                writer.writeUint32(entryNames[entryIdx].first);
+                writer.writeUint32(entryNames[entryIdx].second);
+                ++entryIdx;
+            }
+        }
+
+        writer.writeString(strings);
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, _path, ec);
+    if (ec) {
+        warn("Unable to save resource index cache: " + ec.message(), LogChannel::Resources);
+        std::filesystem::remove(tmpPath, ec);
+        return;
+    }
+    _dirty = false;
+}
+
+const ResourceIndex *ResourceIndexCache::find(const std::filesystem::path &containerPath) const {
+    auto it = _pathToIndex.find(containerPath.string());
+    if (it == _pathToIndex.end()) {
+        return nullptr;
+    }
+    auto &cached = it->second;
+    for (size_t i = 0; i < cached.index.files.size(); ++i) {
+        auto stamp = stampFile(cached.index.files[i]);
+        if (!stamp || !(*stamp == cached.stamps[i])) {
+            return nullptr;
+        }
+    }
+    return &cached.index;
+}
+
+void ResourceIndexCache::put(const std::filesystem::path &containerPath, ResourceIndex index) {
+    auto cached = CachedIndex();
+    for (auto &file : index.files) {
+        auto stamp = stampFile(file);
+        if (!stamp) {
+            return;
+        }
+        cached.stamps.push_back(*stamp);
+    }
+    cached.index = std::move(index);
+    _pathToIndex[containerPath.string()] = std::move(cached);
+    _dirty = true;
+}
+
+std::optional<ResourceIndexCache::FileStamp> ResourceIndexCache::stampFile(const std::filesystem::path &path) const {
+    std::error_code ec;
+    auto status = std::filesystem::status(path, ec);
+    if (ec || !std::filesystem::exists(status)) {
+        return std::nullopt;
+    }
+    auto stamp = FileStamp();
+    if (std::filesystem::is_regular_file(status)) {
+        stamp.size = std::filesystem::file_size(path, ec);
+        if (ec) {
+            return std::nullopt;
+        }
+    }
+    auto modifiedAt = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    stamp.modifiedAt = static_cast<int64_t>(modifiedAt.time_since_epoch().count());
+    return stamp;
+}
+
+} // namespace resource
+
+} // namespace reone
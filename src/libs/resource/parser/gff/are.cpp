@@ -17,6 +17,7 @@
 
 #include "reone/resource/parser/gff/are.h"
 
+#include "reone/resource/format/gffview.h"
 #include "reone/resource/gff.h"
 
 namespace reone {
@@ -384,6 +385,948 @@ ARE parseARE(const Gff &gff) {
     return strct;
 }
 
+struct ARELabelSlots {
+    std::vector<int> ARE_MiniGame_Player_Gun_Banks_Bullet;
+    std::vector<int> ARE_MiniGame_Enemies_Gun_Banks_Bullet;
+    std::vector<int> ARE_MiniGame_Player_Sounds;
+    std::vector<int> ARE_MiniGame_Player_Scripts;
+    std::vector<int> ARE_MiniGame_Player_Models;
+    std::vector<int> ARE_MiniGame_Player_Gun_Banks;
+    std::vector<int> ARE_MiniGame_Obstacles_Scripts;
+    std::vector<int> ARE_MiniGame_Enemies_Sounds;
+    std::vector<int> ARE_MiniGame_Enemies_Scripts;
+    std::vector<int> ARE_MiniGame_Enemies_Models;
+    std::vector<int> ARE_MiniGame_Enemies_Gun_Banks;
+    std::vector<int> ARE_MiniGame_Player;
+    std::vector<int> ARE_MiniGame_Obstacles;
+    std::vector<int> ARE_MiniGame_Mouse;
+    std::vector<int> ARE_MiniGame_Enemies;
+    std::vector<int> ARE_Rooms;
+    std::vector<int> ARE_MiniGame;
+    std::vector<int> ARE_Map;
+    std::vector<int> ARE;
+};
+
+static ARE_MiniGame_Player_Gun_Banks_Bullet decodeARE_MiniGame_Player_Gun_Banks_Bullet(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame_Player_Gun_Banks_Bullet strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame_Player_Gun_Banks_Bullet[field.labelIndex]) {
+        case 0:
+            strct.Bullet_Model = gff.getString(field);
+            break;
+        case 1:
+            strct.Collision_Sound = gff.getString(field);
+            break;
+        case 2:
+            strct.Damage = gff.getUint(field);
+            break;
+        case 3:
+            strct.Lifespan = gff.getFloat(field);
+            break;
+        case 4:
+            strct.Rate_Of_Fire = gff.getFloat(field);
+            break;
+        case 5:
+            strct.Speed = gff.getFloat(field);
+            break;
+        case 6:
+            strct.Target_Type = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Enemies_Gun_Banks_Bullet decodeARE_MiniGame_Enemies_Gun_Banks_Bullet(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame_Enemies_Gun_Banks_Bullet strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame_Enemies_Gun_Banks_Bullet[field.labelIndex]) {
+        case 0:
+            strct.Bullet_Model = gff.getString(field);
+            break;
+        case 1:
+            strct.Collision_Sound = gff.getString(field);
+            break;
+        case 2:
+            strct.Damage = gff.getUint(field);
+            break;
+        case 3:
+            strct.Lifespan = gff.getFloat(field);
+            break;
+        case 4:
+            strct.Rate_Of_Fire = gff.getFloat(field);
+            break;
+        case 5:
+            strct.Speed = gff.getFloat(field);
+            break;
+        case 6:
+            strct.Target_Type = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Player_Sounds decodeARE_MiniGame_Player_Sounds(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame_Player_Sounds strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame_Player_Sounds[field.labelIndex]) {
+        case 0:
+            strct.Death = gff.getString(field);
+            break;
+        case 1:
+            strct.Engine = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Player_Scripts decodeARE_MiniGame_Player_Scripts(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame_Player_Scripts strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame_Player_Scripts[field.labelIndex]) {
+        case 0:
+            strct.OnAccelerate = gff.getString(field);
+            break;
+        case 1:
+            strct.OnAnimEvent = gff.getString(field);
+            break;
+        case 2:
+            strct.OnBrake = gff.getString(field);
+            break;
+        case 3:
+            strct.OnCreate = gff.getString(field);
+            break;
+        case 4:
+            strct.OnDamage = gff.getString(field);
+            break;
+        case 5:
+            strct.OnDeath = gff.getString(field);
+            break;
+        case 6:
+            strct.OnFire = gff.getString(field);
+            break;
+        case 7:
+            strct.OnHeartbeat = gff.getString(field);
+            break;
+        case 8:
+            strct.OnHitBullet = gff.getString(field);
+            break;
+        case 9:
+            strct.OnHitFollower = gff.getString(field);
+            break;
+        case 10:
+            strct.OnHitObstacle = gff.getString(field);
+            break;
+        case 11:
+            strct.OnHitWorld = gff.getString(field);
+            break;
+        case 12:
+            strct.OnTrackLoop = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Player_Models decodeARE_MiniGame_Player_Models(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame_Player_Models strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame_Player_Models[field.labelIndex]) {
+        case 0:
+            strct.Model = gff.getString(field);
+            break;
+        case 1:
+            strct.RotatingModel = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Player_Gun_Banks decodeARE_MiniGame_Player_Gun_Banks(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame_Player_Gun_Banks strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame_Player_Gun_Banks[field.labelIndex]) {
+        case 0:
+            strct.BankID = gff.getUint(field);
+            break;
+        case 1:
+            if (field.type == Gff::FieldType::Struct) {
+                strct.Bullet = decodeARE_MiniGame_Player_Gun_Banks_Bullet(gff, gff.getStruct(field), slots);
+            }
+            break;
+        case 2:
+            strct.Fire_Sound = gff.getString(field);
+            break;
+        case 3:
+            strct.Gun_Model = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Obstacles_Scripts decodeARE_MiniGame_Obstacles_Scripts(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame_Obstacles_Scripts strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame_Obstacles_Scripts[field.labelIndex]) {
+        case 0:
+            strct.OnAnimEvent = gff.getString(field);
+            break;
+        case 1:
+            strct.OnCreate = gff.getString(field);
+            break;
+        case 2:
+            strct.OnHeartbeat = gff.getString(field);
+            break;
+        case 3:
+            strct.OnHitBullet = gff.getString(field);
+            break;
+        case 4:
+            strct.OnHitFollower = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Enemies_Sounds decodeARE_MiniGame_Enemies_Sounds(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame_Enemies_Sounds strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame_Enemies_Sounds[field.labelIndex]) {
+        case 0:
+            strct.Death = gff.getString(field);
+            break;
+        case 1:
+            strct.Engine = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Enemies_Scripts decodeARE_MiniGame_Enemies_Scripts(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame_Enemies_Scripts strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame_Enemies_Scripts[field.labelIndex]) {
+        case 0:
+            strct.OnAccelerate = gff.getString(field);
+            break;
+        case 1:
+            strct.OnAnimEvent = gff.getString(field);
+            break;
+        case 2:
+            strct.OnBrake = gff.getString(field);
+            break;
+        case 3:
+            strct.OnCreate = gff.getString(field);
+            break;
+        case 4:
+            strct.OnDamage = gff.getString(field);
+            break;
+        case 5:
+            strct.OnDeath = gff.getString(field);
+            break;
+        case 6:
+            strct.OnFire = gff.getString(field);
+            break;
+        case 7:
+            strct.OnHeartbeat = gff.getString(field);
+            break;
+        case 8:
+            strct.OnHitBullet = gff.getString(field);
+            break;
+        case 9:
+            strct.OnHitFollower = gff.getString(field);
+            break;
+        case 10:
+            strct.OnHitObstacle = gff.getString(field);
+            break;
+        case 11:
+            strct.OnHitWorld = gff.getString(field);
+            break;
+        case 12:
+            strct.OnTrackLoop = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Enemies_Models decodeARE_MiniGame_Enemies_Models(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame_Enemies_Models strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame_Enemies_Models[field.labelIndex]) {
+        case 0:
+            strct.Model = gff.getString(field);
+            break;
+        case 1:
+            strct.RotatingModel = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Enemies_Gun_Banks decodeARE_MiniGame_Enemies_Gun_Banks(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame_Enemies_Gun_Banks strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame_Enemies_Gun_Banks[field.labelIndex]) {
+        case 0:
+            strct.BankID = gff.getUint(field);
+            break;
+        case 1:
+            if (field.type == Gff::FieldType::Struct) {
+                strct.Bullet = decodeARE_MiniGame_Enemies_Gun_Banks_Bullet(gff, gff.getStruct(field), slots);
+            }
+            break;
+        case 2:
+            strct.Fire_Sound = gff.getString(field);
+            break;
+        case 3:
+            strct.Gun_Model = gff.getString(field);
+            break;
+        case 4:
+            strct.Horiz_Spread = gff.getFloat(field);
+            break;
+        case 5:
+            strct.Inaccuracy = gff.getFloat(field);
+            break;
+        case 6:
+            strct.Sensing_Radius = gff.getFloat(field);
+            break;
+        case 7:
+            strct.Vert_Spread = gff.getFloat(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Player decodeARE_MiniGame_Player(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame_Player strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame_Player[field.labelIndex]) {
+        case 0:
+            strct.Accel_Secs = gff.getFloat(field);
+            break;
+        case 1:
+            strct.Bump_Damage = gff.getInt(field);
+            break;
+        case 2:
+            strct.Camera = gff.getString(field);
+            break;
+        case 3:
+            strct.CameraRotate = gff.getUint(field);
+            break;
+        case 4:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Gun_Banks.push_back(decodeARE_MiniGame_Player_Gun_Banks(gff, item, slots));
+            });
+            break;
+        case 5:
+            strct.Hit_Points = gff.getUint(field);
+            break;
+        case 6:
+            strct.Invince_Period = gff.getFloat(field);
+            break;
+        case 7:
+            strct.Max_HPs = gff.getUint(field);
+            break;
+        case 8:
+            strct.Maximum_Speed = gff.getFloat(field);
+            break;
+        case 9:
+            strct.Minimum_Speed = gff.getFloat(field);
+            break;
+        case 10:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Models.push_back(decodeARE_MiniGame_Player_Models(gff, item, slots));
+            });
+            break;
+        case 11:
+            strct.Num_Loops = gff.getInt(field);
+            break;
+        case 12:
+            if (field.type == Gff::FieldType::Struct) {
+                strct.Scripts = decodeARE_MiniGame_Player_Scripts(gff, gff.getStruct(field), slots);
+            }
+            break;
+        case 13:
+            if (field.type == Gff::FieldType::Struct) {
+                strct.Sounds = decodeARE_MiniGame_Player_Sounds(gff, gff.getStruct(field), slots);
+            }
+            break;
+        case 14:
+            strct.Sphere_Radius = gff.getFloat(field);
+            break;
+        case 15:
+            strct.Start_Offset_X = gff.getFloat(field);
+            break;
+        case 16:
+            strct.Start_Offset_Y = gff.getFloat(field);
+            break;
+        case 17:
+            strct.Start_Offset_Z = gff.getFloat(field);
+            break;
+        case 18:
+            strct.Target_Offset_X = gff.getFloat(field);
+            break;
+        case 19:
+            strct.Target_Offset_Y = gff.getFloat(field);
+            break;
+        case 20:
+            strct.Target_Offset_Z = gff.getFloat(field);
+            break;
+        case 21:
+            strct.Track = gff.getString(field);
+            break;
+        case 22:
+            strct.TunnelInfinite = gff.getVector(field);
+            break;
+        case 23:
+            strct.TunnelXNeg = gff.getFloat(field);
+            break;
+        case 24:
+            strct.TunnelXPos = gff.getFloat(field);
+            break;
+        case 25:
+            strct.TunnelYNeg = gff.getFloat(field);
+            break;
+        case 26:
+            strct.TunnelYPos = gff.getFloat(field);
+            break;
+        case 27:
+            strct.TunnelZNeg = gff.getFloat(field);
+            break;
+        case 28:
+            strct.TunnelZPos = gff.getFloat(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Obstacles decodeARE_MiniGame_Obstacles(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame_Obstacles strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame_Obstacles[field.labelIndex]) {
+        case 0:
+            strct.Name = gff.getString(field);
+            break;
+        case 1:
+            if (field.type == Gff::FieldType::Struct) {
+                strct.Scripts = decodeARE_MiniGame_Obstacles_Scripts(gff, gff.getStruct(field), slots);
+            }
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Mouse decodeARE_MiniGame_Mouse(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame_Mouse strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame_Mouse[field.labelIndex]) {
+        case 0:
+            strct.AxisX = gff.getUint(field);
+            break;
+        case 1:
+            strct.AxisY = gff.getUint(field);
+            break;
+        case 2:
+            strct.FlipAxisX = gff.getUint(field);
+            break;
+        case 3:
+            strct.FlipAxisY = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame_Enemies decodeARE_MiniGame_Enemies(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame_Enemies strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame_Enemies[field.labelIndex]) {
+        case 0:
+            strct.Bump_Damage = gff.getInt(field);
+            break;
+        case 1:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Gun_Banks.push_back(decodeARE_MiniGame_Enemies_Gun_Banks(gff, item, slots));
+            });
+            break;
+        case 2:
+            strct.Hit_Points = gff.getUint(field);
+            break;
+        case 3:
+            strct.Invince_Period = gff.getFloat(field);
+            break;
+        case 4:
+            strct.Max_HPs = gff.getUint(field);
+            break;
+        case 5:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Models.push_back(decodeARE_MiniGame_Enemies_Models(gff, item, slots));
+            });
+            break;
+        case 6:
+            strct.Num_Loops = gff.getInt(field);
+            break;
+        case 7:
+            if (field.type == Gff::FieldType::Struct) {
+                strct.Scripts = decodeARE_MiniGame_Enemies_Scripts(gff, gff.getStruct(field), slots);
+            }
+            break;
+        case 8:
+            if (field.type == Gff::FieldType::Struct) {
+                strct.Sounds = decodeARE_MiniGame_Enemies_Sounds(gff, gff.getStruct(field), slots);
+            }
+            break;
+        case 9:
+            strct.Sphere_Radius = gff.getFloat(field);
+            break;
+        case 10:
+            strct.Track = gff.getString(field);
+            break;
+        case 11:
+            strct.Trigger = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_Rooms decodeARE_Rooms(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_Rooms strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_Rooms[field.labelIndex]) {
+        case 0:
+            strct.AmbientScale = gff.getFloat(field);
+            break;
+        case 1:
+            strct.DisableWeather = gff.getUint(field);
+            break;
+        case 2:
+            strct.EnvAudio = gff.getInt(field);
+            break;
+        case 3:
+            strct.ForceRating = gff.getInt(field);
+            break;
+        case 4:
+            strct.RoomName = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_MiniGame decodeARE_MiniGame(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_MiniGame strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_MiniGame[field.labelIndex]) {
+        case 0:
+            strct.Bump_Plane = gff.getUint(field);
+            break;
+        case 1:
+            strct.CameraViewAngle = gff.getFloat(field);
+            break;
+        case 2:
+            strct.DOF = gff.getUint(field);
+            break;
+        case 3:
+            strct.DoBumping = gff.getUint(field);
+            break;
+        case 4:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Enemies.push_back(decodeARE_MiniGame_Enemies(gff, item, slots));
+            });
+            break;
+        case 5:
+            strct.Far_Clip = gff.getFloat(field);
+            break;
+        case 6:
+            strct.LateralAccel = gff.getFloat(field);
+            break;
+        case 7:
+            if (field.type == Gff::FieldType::Struct) {
+                strct.Mouse = decodeARE_MiniGame_Mouse(gff, gff.getStruct(field), slots);
+            }
+            break;
+        case 8:
+            strct.MovementPerSec = gff.getFloat(field);
+            break;
+        case 9:
+            strct.Music = gff.getString(field);
+            break;
+        case 10:
+            strct.Near_Clip = gff.getFloat(field);
+            break;
+        case 11:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Obstacles.push_back(decodeARE_MiniGame_Obstacles(gff, item, slots));
+            });
+            break;
+        case 12:
+            if (field.type == Gff::FieldType::Struct) {
+                strct.Player = decodeARE_MiniGame_Player(gff, gff.getStruct(field), slots);
+            }
+            break;
+        case 13:
+            strct.Type = gff.getUint(field);
+            break;
+        case 14:
+            strct.UseInertia = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE_Map decodeARE_Map(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE_Map strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE_Map[field.labelIndex]) {
+        case 0:
+            strct.MapPt1X = gff.getFloat(field);
+            break;
+        case 1:
+            strct.MapPt1Y = gff.getFloat(field);
+            break;
+        case 2:
+            strct.MapPt2X = gff.getFloat(field);
+            break;
+        case 3:
+            strct.MapPt2Y = gff.getFloat(field);
+            break;
+        case 4:
+            strct.MapResX = gff.getInt(field);
+            break;
+        case 5:
+            strct.MapZoom = gff.getInt(field);
+            break;
+        case 6:
+            strct.NorthAxis = gff.getInt(field);
+            break;
+        case 7:
+            strct.WorldPt1X = gff.getFloat(field);
+            break;
+        case 8:
+            strct.WorldPt1Y = gff.getFloat(field);
+            break;
+        case 9:
+            strct.WorldPt2X = gff.getFloat(field);
+            break;
+        case 10:
+            strct.WorldPt2Y = gff.getFloat(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static ARE decodeARE(const GffView &gff, const GffView::Struct &gffStruct, const ARELabelSlots &slots) {
+    ARE strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.ARE[field.labelIndex]) {
+        case 0:
+            strct.AlphaTest = gff.getFloat(field);
+            break;
+        case 1:
+            strct.CameraStyle = gff.getInt(field);
+            break;
+        case 2:
+            strct.ChanceLightning = gff.getInt(field);
+            break;
+        case 3:
+            strct.ChanceRain = gff.getInt(field);
+            break;
+        case 4:
+            strct.ChanceSnow = gff.getInt(field);
+            break;
+        case 5:
+            strct.Comments = gff.getString(field);
+            break;
+        case 6:
+            strct.Creator_ID = gff.getInt(field);
+            break;
+        case 7:
+            strct.DayNightCycle = gff.getUint(field);
+            break;
+        case 8:
+            strct.DefaultEnvMap = gff.getString(field);
+            break;
+        case 9:
+            strct.DirtyARGBOne = gff.getInt(field);
+            break;
+        case 10:
+            strct.DirtyARGBThree = gff.getInt(field);
+            break;
+        case 11:
+            strct.DirtyARGBTwo = gff.getInt(field);
+            break;
+        case 12:
+            strct.DirtyFormulaOne = gff.getInt(field);
+            break;
+        case 13:
+            strct.DirtyFormulaThre = gff.getInt(field);
+            break;
+        case 14:
+            strct.DirtyFormulaTwo = gff.getInt(field);
+            break;
+        case 15:
+            strct.DirtyFuncOne = gff.getInt(field);
+            break;
+        case 16:
+            strct.DirtyFuncThree = gff.getInt(field);
+            break;
+        case 17:
+            strct.DirtyFuncTwo = gff.getInt(field);
+            break;
+        case 18:
+            strct.DirtySizeOne = gff.getInt(field);
+            break;
+        case 19:
+            strct.DirtySizeThree = gff.getInt(field);
+            break;
+        case 20:
+            strct.DirtySizeTwo = gff.getInt(field);
+            break;
+        case 21:
+            strct.DisableTransit = gff.getUint(field);
+            break;
+        case 22:
+            strct.DynAmbientColor = gff.getUint(field);
+            break;
+        case 24:
+            strct.Flags = gff.getUint(field);
+            break;
+        case 25:
+            strct.Grass_Ambient = gff.getUint(field);
+            break;
+        case 26:
+            strct.Grass_Density = gff.getFloat(field);
+            break;
+        case 27:
+            strct.Grass_Diffuse = gff.getUint(field);
+            break;
+        case 28:
+            strct.Grass_Emissive = gff.getUint(field);
+            break;
+        case 29:
+            strct.Grass_Prob_LL = gff.getFloat(field);
+            break;
+        case 30:
+            strct.Grass_Prob_LR = gff.getFloat(field);
+            break;
+        case 31:
+            strct.Grass_Prob_UL = gff.getFloat(field);
+            break;
+        case 32:
+            strct.Grass_Prob_UR = gff.getFloat(field);
+            break;
+        case 33:
+            strct.Grass_QuadSize = gff.getFloat(field);
+            break;
+        case 34:
+            strct.Grass_TexName = gff.getString(field);
+            break;
+        case 35:
+            strct.ID = gff.getInt(field);
+            break;
+        case 36:
+            strct.IsNight = gff.getUint(field);
+            break;
+        case 37:
+            strct.LightingScheme = gff.getUint(field);
+            break;
+        case 38:
+            strct.LoadScreenID = gff.getUint(field);
+            break;
+        case 39:
+            if (field.type == Gff::FieldType::Struct) {
+                strct.Map = decodeARE_Map(gff, gff.getStruct(field), slots);
+            }
+            break;
+        case 40:
+            if (field.type == Gff::FieldType::Struct) {
+                strct.MiniGame = decodeARE_MiniGame(gff, gff.getStruct(field), slots);
+            }
+            break;
+        case 41:
+            strct.ModListenCheck = gff.getInt(field);
+            break;
+        case 42:
+            strct.ModSpotCheck = gff.getInt(field);
+            break;
+        case 43:
+            strct.MoonAmbientColor = gff.getUint(field);
+            break;
+        case 44:
+            strct.MoonDiffuseColor = gff.getUint(field);
+            break;
+        case 45:
+            strct.MoonFogColor = gff.getUint(field);
+            break;
+        case 46:
+            strct.MoonFogFar = gff.getFloat(field);
+            break;
+        case 47:
+            strct.MoonFogNear = gff.getFloat(field);
+            break;
+        case 48:
+            strct.MoonFogOn = gff.getUint(field);
+            break;
+        case 49:
+            strct.MoonShadows = gff.getUint(field);
+            break;
+        case 50:
+            strct.Name = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 51:
+            strct.NoHangBack = gff.getUint(field);
+            break;
+        case 52:
+            strct.NoRest = gff.getUint(field);
+            break;
+        case 53:
+            strct.OnEnter = gff.getString(field);
+            break;
+        case 54:
+            strct.OnExit = gff.getString(field);
+            break;
+        case 55:
+            strct.OnHeartbeat = gff.getString(field);
+            break;
+        case 56:
+            strct.OnUserDefined = gff.getString(field);
+            break;
+        case 57:
+            strct.PlayerOnly = gff.getUint(field);
+            break;
+        case 58:
+            strct.PlayerVsPlayer = gff.getUint(field);
+            break;
+        case 59:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Rooms.push_back(decodeARE_Rooms(gff, item, slots));
+            });
+            break;
+        case 60:
+            strct.ShadowOpacity = gff.getUint(field);
+            break;
+        case 61:
+            strct.StealthXPEnabled = gff.getUint(field);
+            break;
+        case 62:
+            strct.StealthXPLoss = gff.getUint(field);
+            break;
+        case 63:
+            strct.StealthXPMax = gff.getUint(field);
+            break;
+        case 64:
+            strct.SunAmbientColor = gff.getUint(field);
+            break;
+        case 65:
+            strct.SunDiffuseColor = gff.getUint(field);
+            break;
+        case 66:
+            strct.SunFogColor = gff.getUint(field);
+            break;
+        case 67:
+            strct.SunFogFar = gff.getFloat(field);
+            break;
+        case 68:
+            strct.SunFogNear = gff.getFloat(field);
+            break;
+        case 69:
+            strct.SunFogOn = gff.getUint(field);
+            break;
+        case 70:
+            strct.SunShadows = gff.getUint(field);
+            break;
+        case 71:
+            strct.Tag = gff.getString(field);
+            break;
+        case 72:
+            strct.Unescapable = gff.getUint(field);
+            break;
+        case 73:
+            strct.Version = gff.getUint(field);
+            break;
+        case 74:
+            strct.WindPower = gff.getInt(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+ARE decodeARE(const GffView &gff) {
+    ARELabelSlots slots;
+    slots.ARE_MiniGame_Player_Gun_Banks_Bullet = gff.mapLabels({"Bullet_Model", "Collision_Sound", "Damage", "Lifespan", "Rate_Of_Fire", "Speed", "Target_Type"});
+    slots.ARE_MiniGame_Enemies_Gun_Banks_Bullet = gff.mapLabels({"Bullet_Model", "Collision_Sound", "Damage", "Lifespan", "Rate_Of_Fire", "Speed", "Target_Type"});
+    slots.ARE_MiniGame_Player_Sounds = gff.mapLabels({"Death", "Engine"});
+    slots.ARE_MiniGame_Player_Scripts = gff.mapLabels({"OnAccelerate", "OnAnimEvent", "OnBrake", "OnCreate", "OnDamage", "OnDeath", "OnFire", "OnHeartbeat", "OnHitBullet", "OnHitFollower", "OnHitObstacle", "OnHitWorld", "OnTrackLoop"});
+    slots.ARE_MiniGame_Player_Models = gff.mapLabels({"Model", "RotatingModel"});
+    slots.ARE_MiniGame_Player_Gun_Banks = gff.mapLabels({"BankID", "Bullet", "Fire_Sound", "Gun_Model"});
+    slots.ARE_MiniGame_Obstacles_Scripts = gff.mapLabels({"OnAnimEvent", "OnCreate", "OnHeartbeat", "OnHitBullet", "OnHitFollower"});
+    slots.ARE_MiniGame_Enemies_Sounds = gff.mapLabels({"Death", "Engine"});
+    slots.ARE_MiniGame_Enemies_Scripts = gff.mapLabels({"OnAccelerate", "OnAnimEvent", "OnBrake", "OnCreate", "OnDamage", "OnDeath", "OnFire", "OnHeartbeat", "OnHitBullet", "OnHitFollower", "OnHitObstacle", "OnHitWorld", "OnTrackLoop"});
+    slots.ARE_MiniGame_Enemies_Models = gff.mapLabels({"Model", "RotatingModel"});
+    slots.ARE_MiniGame_Enemies_Gun_Banks = gff.mapLabels({"BankID", "Bullet", "Fire_Sound", "Gun_Model", "Horiz_Spread", "Inaccuracy", "Sensing_Radius", "Vert_Spread"});
+    slots.ARE_MiniGame_Player = gff.mapLabels({"Accel_Secs", "Bump_Damage", "Camera", "CameraRotate", "Gun_Banks", "Hit_Points", "Invince_Period", "Max_HPs", "Maximum_Speed", "Minimum_Speed", "Models", "Num_Loops", "Scripts", "Sounds", "Sphere_Radius", "Start_Offset_X", "Start_Offset_Y", "Start_Offset_Z", "Target_Offset_X", "Target_Offset_Y", "Target_Offset_Z", "Track", "TunnelInfinite", "TunnelXNeg", "TunnelXPos", "TunnelYNeg", "TunnelYPos", "TunnelZNeg", "TunnelZPos"});
+    slots.ARE_MiniGame_Obstacles = gff.mapLabels({"Name", "Scripts"});
+    slots.ARE_MiniGame_Mouse = gff.mapLabels({"AxisX", "AxisY", "FlipAxisX", "FlipAxisY"});
+    slots.ARE_MiniGame_Enemies = gff.mapLabels({"Bump_Damage", "Gun_Banks", "Hit_Points", "Invince_Period", "Max_HPs", "Models", "Num_Loops", "Scripts", "Sounds", "Sphere_Radius", "Track", "Trigger"});
+    slots.ARE_Rooms = gff.mapLabels({"AmbientScale", "DisableWeather", "EnvAudio", "ForceRating", "RoomName"});
+    slots.ARE_MiniGame = gff.mapLabels({"Bump_Plane", "CameraViewAngle", "DOF", "DoBumping", "Enemies", "Far_Clip", "LateralAccel", "Mouse", "MovementPerSec", "Music", "Near_Clip", "Obstacles", "Player", "Type", "UseInertia"});
+    slots.ARE_Map = gff.mapLabels({"MapPt1X", "MapPt1Y", "MapPt2X", "MapPt2Y", "MapResX", "MapZoom", "NorthAxis", "WorldPt1X", "WorldPt1Y", "WorldPt2X", "WorldPt2Y"});
+    slots.ARE = gff.mapLabels({"AlphaTest", "CameraStyle", "ChanceLightning", "ChanceRain", "ChanceSnow", "Comments", "Creator_ID", "DayNightCycle", "DefaultEnvMap", "DirtyARGBOne", "DirtyARGBThree", "DirtyARGBTwo", "DirtyFormulaOne", "DirtyFormulaThre", "DirtyFormulaTwo", "DirtyFuncOne", "DirtyFuncThree", "DirtyFuncTwo", "DirtySizeOne", "DirtySizeThree", "DirtySizeTwo", "DisableTransit", "DynAmbientColor", "Expansion_List", "Flags", "Grass_Ambient", "Grass_Density", "Grass_Diffuse", "Grass_Emissive", "Grass_Prob_LL", "Grass_Prob_LR", "Grass_Prob_UL", "Grass_Prob_UR", "Grass_QuadSize", "Grass_TexName", "ID", "IsNight", "LightingScheme", "LoadScreenID", "Map", "MiniGame", "ModListenCheck", "ModSpotCheck", "MoonAmbientColor", "MoonDiffuseColor", "MoonFogColor", "MoonFogFar", "MoonFogNear", "MoonFogOn", "MoonShadows", "Name", "NoHangBack", "NoRest", "OnEnter", "OnExit", "OnHeartbeat", "OnUserDefined", "PlayerOnly", "PlayerVsPlayer", "Rooms", "ShadowOpacity", "StealthXPEnabled", "StealthXPLoss", "StealthXPMax", "SunAmbientColor", "SunDiffuseColor", "SunFogColor", "SunFogFar", "SunFogNear", "SunFogOn", "SunShadows", "Tag", "Unescapable", "Version", "WindPower"});
+    return decodeARE(gff, gff.root(), slots);
+}
+
 } // namespace generated
 
 } // namespace resource
@@ -17,6 +17,7 @@
 
 #include "reone/resource/parser/gff/dlg.h"
 
+#include "reone/resource/format/gffview.h"
 #include "reone/resource/gff.h"
 
 namespace reone {
@@ -164,6 +165,393 @@ DLG parseDLG(const Gff &gff) {
     return strct;
 }
 
+struct DLGLabelSlots {
+    std::vector<int> DLG_EntryReplyList_EntriesRepliesList;
+    std::vector<int> DLG_EntryReplyList_AnimList;
+    std::vector<int> DLG_StuntList;
+    std::vector<int> DLG_EntryReplyList;
+    std::vector<int> DLG;
+};
+
+static DLG_EntryReplyList_EntriesRepliesList decodeDLG_EntryReplyList_EntriesRepliesList(const GffView &gff, const GffView::Struct &gffStruct, const DLGLabelSlots &slots) {
+    DLG_EntryReplyList_EntriesRepliesList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.DLG_EntryReplyList_EntriesRepliesList[field.labelIndex]) {
+        case 0:
+            strct.Active = gff.getString(field);
+            break;
+        case 1:
+            strct.Active2 = gff.getString(field);
+            break;
+        case 2:
+            strct.Index = gff.getUint(field);
+            break;
+        case 3:
+            strct.IsChild = gff.getUint(field);
+            break;
+        case 4:
+            strct.LinkComment = gff.getString(field);
+            break;
+        case 5:
+            strct.Logic = gff.getInt(field);
+            break;
+        case 6:
+            strct.Not = gff.getUint(field);
+            break;
+        case 7:
+            strct.Not2 = gff.getUint(field);
+            break;
+        case 8:
+            strct.Param1 = gff.getInt(field);
+            break;
+        case 9:
+            strct.Param1b = gff.getInt(field);
+            break;
+        case 10:
+            strct.Param2 = gff.getInt(field);
+            break;
+        case 11:
+            strct.Param2b = gff.getInt(field);
+            break;
+        case 12:
+            strct.Param3 = gff.getInt(field);
+            break;
+        case 13:
+            strct.Param3b = gff.getInt(field);
+            break;
+        case 14:
+            strct.Param4 = gff.getInt(field);
+            break;
+        case 15:
+            strct.Param4b = gff.getInt(field);
+            break;
+        case 16:
+            strct.Param5 = gff.getInt(field);
+            break;
+        case 17:
+            strct.Param5b = gff.getInt(field);
+            break;
+        case 18:
+            strct.ParamStrA = gff.getString(field);
+            break;
+        case 19:
+            strct.ParamStrB = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static DLG_EntryReplyList_AnimList decodeDLG_EntryReplyList_AnimList(const GffView &gff, const GffView::Struct &gffStruct, const DLGLabelSlots &slots) {
+    DLG_EntryReplyList_AnimList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.DLG_EntryReplyList_AnimList[field.labelIndex]) {
+        case 0:
+            strct.Animation = gff.getUint(field);
+            break;
+        case 1:
+            strct.Participant = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static DLG_StuntList decodeDLG_StuntList(const GffView &gff, const GffView::Struct &gffStruct, const DLGLabelSlots &slots) {
+    DLG_StuntList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.DLG_StuntList[field.labelIndex]) {
+        case 0:
+            strct.Participant = gff.getString(field);
+            break;
+        case 1:
+            strct.StuntModel = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static DLG_EntryReplyList decodeDLG_EntryReplyList(const GffView &gff, const GffView::Struct &gffStruct, const DLGLabelSlots &slots) {
+    DLG_EntryReplyList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.DLG_EntryReplyList[field.labelIndex]) {
+        case 0:
+            strct.ActionParam1 = gff.getInt(field);
+            break;
+        case 1:
+            strct.ActionParam1b = gff.getInt(field);
+            break;
+        case 2:
+            strct.ActionParam2 = gff.getInt(field);
+            break;
+        case 3:
+            strct.ActionParam2b = gff.getInt(field);
+            break;
+        case 4:
+            strct.ActionParam3 = gff.getInt(field);
+            break;
+        case 5:
+            strct.ActionParam3b = gff.getInt(field);
+            break;
+        case 6:
+            strct.ActionParam4 = gff.getInt(field);
+            break;
+        case 7:
+            strct.ActionParam4b = gff.getInt(field);
+            break;
+        case 8:
+            strct.ActionParam5 = gff.getInt(field);
+            break;
+        case 9:
+            strct.ActionParam5b = gff.getInt(field);
+            break;
+        case 10:
+            strct.ActionParamStrA = gff.getString(field);
+            break;
+        case 11:
+            strct.ActionParamStrB = gff.getString(field);
+            break;
+        case 12:
+            strct.AlienRaceNode = gff.getInt(field);
+            break;
+        case 13:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.AnimList.push_back(decodeDLG_EntryReplyList_AnimList(gff, item, slots));
+            });
+            break;
+        case 14:
+            strct.CamFieldOfView = gff.getFloat(field);
+            break;
+        case 15:
+            strct.CamHeightOffset = gff.getFloat(field);
+            break;
+        case 16:
+            strct.CamVidEffect = gff.getInt(field);
+            break;
+        case 17:
+            strct.CameraAngle = gff.getUint(field);
+            break;
+        case 18:
+            strct.CameraAnimation = gff.getUint(field);
+            break;
+        case 19:
+            strct.CameraID = gff.getInt(field);
+            break;
+        case 20:
+            strct.Changed = gff.getUint(field);
+            break;
+        case 21:
+            strct.Comment = gff.getString(field);
+            break;
+        case 22:
+            strct.Delay = gff.getUint(field);
+            break;
+        case 23:
+            strct.Emotion = gff.getInt(field);
+            break;
+        case 24:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.EntriesList.push_back(decodeDLG_EntryReplyList_EntriesRepliesList(gff, item, slots));
+            });
+            break;
+        case 25:
+            strct.FacialAnim = gff.getInt(field);
+            break;
+        case 26:
+            strct.FadeColor = gff.getVector(field);
+            break;
+        case 27:
+            strct.FadeDelay = gff.getFloat(field);
+            break;
+        case 28:
+            strct.FadeLength = gff.getFloat(field);
+            break;
+        case 29:
+            strct.FadeType = gff.getUint(field);
+            break;
+        case 30:
+            strct.Listener = gff.getString(field);
+            break;
+        case 31:
+            strct.NodeID = gff.getInt(field);
+            break;
+        case 32:
+            strct.NodeUnskippable = gff.getInt(field);
+            break;
+        case 33:
+            strct.PlotIndex = gff.getInt(field);
+            break;
+        case 34:
+            strct.PlotXPPercentage = gff.getFloat(field);
+            break;
+        case 35:
+            strct.PostProcNode = gff.getInt(field);
+            break;
+        case 36:
+            strct.Quest = gff.getString(field);
+            break;
+        case 37:
+            strct.QuestEntry = gff.getUint(field);
+            break;
+        case 38:
+            strct.RecordNoVOOverri = gff.getInt(field);
+            break;
+        case 39:
+            strct.RecordVO = gff.getInt(field);
+            break;
+        case 40:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.RepliesList.push_back(decodeDLG_EntryReplyList_EntriesRepliesList(gff, item, slots));
+            });
+            break;
+        case 41:
+            strct.Script = gff.getString(field);
+            break;
+        case 42:
+            strct.Script2 = gff.getString(field);
+            break;
+        case 43:
+            strct.Sound = gff.getString(field);
+            break;
+        case 44:
+            strct.SoundExists = gff.getUint(field);
+            break;
+        case 45:
+            strct.Speaker = gff.getString(field);
+            break;
+        case 46:
+            strct.TarHeightOffset = gff.getFloat(field);
+            break;
+        case 47:
+            strct.Text = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 48:
+            strct.VOTextChanged = gff.getUint(field);
+            break;
+        case 49:
+            strct.VO_ResRef = gff.getString(field);
+            break;
+        case 50:
+            strct.WaitFlags = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static DLG decodeDLG(const GffView &gff, const GffView::Struct &gffStruct, const DLGLabelSlots &slots) {
+    DLG strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.DLG[field.labelIndex]) {
+        case 0:
+            strct.AlienRaceOwner = gff.getInt(field);
+            break;
+        case 1:
+            strct.AmbientTrack = gff.getString(field);
+            break;
+        case 2:
+            strct.AnimatedCut = gff.getUint(field);
+            break;
+        case 3:
+            strct.CameraModel = gff.getString(field);
+            break;
+        case 4:
+            strct.ComputerType = gff.getUint(field);
+            break;
+        case 5:
+            strct.ConversationType = gff.getInt(field);
+            break;
+        case 6:
+            strct.DelayEntry = gff.getUint(field);
+            break;
+        case 7:
+            strct.DelayReply = gff.getUint(field);
+            break;
+        case 8:
+            strct.DeletedVOFiles = gff.getString(field);
+            break;
+        case 9:
+            strct.EditorInfo = gff.getString(field);
+            break;
+        case 10:
+            strct.EndConverAbort = gff.getString(field);
+            break;
+        case 11:
+            strct.EndConversation = gff.getString(field);
+            break;
+        case 12:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.EntryList.push_back(decodeDLG_EntryReplyList(gff, item, slots));
+            });
+            break;
+        case 13:
+            strct.NextNodeID = gff.getInt(field);
+            break;
+        case 14:
+            strct.NumWords = gff.getUint(field);
+            break;
+        case 15:
+            strct.OldHitCheck = gff.getUint(field);
+            break;
+        case 16:
+            strct.PostProcOwner = gff.getInt(field);
+            break;
+        case 17:
+            strct.RecordNoVO = gff.getInt(field);
+            break;
+        case 18:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.ReplyList.push_back(decodeDLG_EntryReplyList(gff, item, slots));
+            });
+            break;
+        case 19:
+            strct.Skippable = gff.getUint(field);
+            break;
+        case 20:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.StartingList.push_back(decodeDLG_EntryReplyList_EntriesRepliesList(gff, item, slots));
+            });
+            break;
+        case 21:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.StuntList.push_back(decodeDLG_StuntList(gff, item, slots));
+            });
+            break;
+        case 22:
+            strct.UnequipHItem = gff.getUint(field);
+            break;
+        case 23:
+            strct.UnequipItems = gff.getUint(field);
+            break;
+        case 24:
+            strct.VO_ID = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+DLG decodeDLG(const GffView &gff) {
+    DLGLabelSlots slots;
+    slots.DLG_EntryReplyList_EntriesRepliesList = gff.mapLabels({"Active", "Active2", "Index", "IsChild", "LinkComment", "Logic", "Not", "Not2", "Param1", "Param1b", "Param2", "Param2b", "Param3", "Param3b", "Param4", "Param4b", "Param5", "Param5b", "ParamStrA", "ParamStrB"});
+    slots.DLG_EntryReplyList_AnimList = gff.mapLabels({"Animation", "Participant"});
+    slots.DLG_StuntList = gff.mapLabels({"Participant", "StuntModel"});
+    slots.DLG_EntryReplyList = gff.mapLabels({"ActionParam1", "ActionParam1b", "ActionParam2", "ActionParam2b", "ActionParam3", "ActionParam3b", "ActionParam4", "ActionParam4b", "ActionParam5", "ActionParam5b", "ActionParamStrA", "ActionParamStrB", "AlienRaceNode", "AnimList", "CamFieldOfView", "CamHeightOffset", "CamVidEffect", "CameraAngle", "CameraAnimation", "CameraID", "Changed", "Comment", "Delay", "Emotion", "EntriesList", "FacialAnim", "FadeColor", "FadeDelay", "FadeLength", "FadeType", "Listener", "NodeID", "NodeUnskippable", "PlotIndex", "PlotXPPercentage", "PostProcNode", "Quest", "QuestEntry", "RecordNoVOOverri", "RecordVO", "RepliesList", "Script", "Script2", "Sound", "SoundExists", "Speaker", "TarHeightOffset", "Text", "VOTextChanged", "VO_ResRef", "WaitFlags"});
+    slots.DLG = gff.mapLabels({"AlienRaceOwner", "AmbientTrack", "AnimatedCut", "CameraModel", "ComputerType", "ConversationType", "DelayEntry", "DelayReply", "DeletedVOFiles", "EditorInfo", "EndConverAbort", "EndConversation", "EntryList", "NextNodeID", "NumWords", "OldHitCheck", "PostProcOwner", "RecordNoVO", "ReplyList", "Skippable", "StartingList", "StuntList", "UnequipHItem", "UnequipItems", "VO_ID"});
+    return decodeDLG(gff, gff.root(), slots);
+}
+
 } // namespace generated
 
 } // namespace resource
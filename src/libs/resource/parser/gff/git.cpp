@@ -17,6 +17,7 @@
 
 #include "reone/resource/parser/gff/git.h"
 
+#include "reone/resource/format/gffview.h"
 #include "reone/resource/gff.h"
 
 namespace reone {
@@ -228,6 +229,540 @@ GIT parseGIT(const Gff &gff) {
     return strct;
 }
 
+struct GITLabelSlots {
+    std::vector<int> GIT_TriggerList_Geometry;
+    std::vector<int> GIT_Encounter_List_SpawnPointList;
+    std::vector<int> GIT_Encounter_List_Geometry;
+    std::vector<int> GIT_WaypointList;
+    std::vector<int> GIT_TriggerList;
+    std::vector<int> GIT_StoreList;
+    std::vector<int> GIT_SoundList;
+    std::vector<int> GIT_Placeable_List;
+    std::vector<int> GIT_Encounter_List;
+    std::vector<int> GIT_Door_List;
+    std::vector<int> GIT_Creature_List;
+    std::vector<int> GIT_CameraList;
+    std::vector<int> GIT_AreaProperties;
+    std::vector<int> GIT;
+};
+
+static GIT_TriggerList_Geometry decodeGIT_TriggerList_Geometry(const GffView &gff, const GffView::Struct &gffStruct, const GITLabelSlots &slots) {
+    GIT_TriggerList_Geometry strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.GIT_TriggerList_Geometry[field.labelIndex]) {
+        case 0:
+            strct.PointX = gff.getFloat(field);
+            break;
+        case 1:
+            strct.PointY = gff.getFloat(field);
+            break;
+        case 2:
+            strct.PointZ = gff.getFloat(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_Encounter_List_SpawnPointList decodeGIT_Encounter_List_SpawnPointList(const GffView &gff, const GffView::Struct &gffStruct, const GITLabelSlots &slots) {
+    GIT_Encounter_List_SpawnPointList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.GIT_Encounter_List_SpawnPointList[field.labelIndex]) {
+        case 0:
+            strct.Orientation = gff.getFloat(field);
+            break;
+        case 1:
+            strct.X = gff.getFloat(field);
+            break;
+        case 2:
+            strct.Y = gff.getFloat(field);
+            break;
+        case 3:
+            strct.Z = gff.getFloat(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_Encounter_List_Geometry decodeGIT_Encounter_List_Geometry(const GffView &gff, const GffView::Struct &gffStruct, const GITLabelSlots &slots) {
+    GIT_Encounter_List_Geometry strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.GIT_Encounter_List_Geometry[field.labelIndex]) {
+        case 0:
+            strct.X = gff.getFloat(field);
+            break;
+        case 1:
+            strct.Y = gff.getFloat(field);
+            break;
+        case 2:
+            strct.Z = gff.getFloat(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_WaypointList decodeGIT_WaypointList(const GffView &gff, const GffView::Struct &gffStruct, const GITLabelSlots &slots) {
+    GIT_WaypointList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.GIT_WaypointList[field.labelIndex]) {
+        case 0:
+            strct.Appearance = gff.getUint(field);
+            break;
+        case 1:
+            strct.Description = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 2:
+            strct.HasMapNote = gff.getUint(field);
+            break;
+        case 3:
+            strct.LinkedTo = gff.getString(field);
+            break;
+        case 4:
+            strct.LocalizedName = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 5:
+            strct.MapNote = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 6:
+            strct.MapNoteEnabled = gff.getUint(field);
+            break;
+        case 7:
+            strct.Tag = gff.getString(field);
+            break;
+        case 8:
+            strct.TemplateResRef = gff.getString(field);
+            break;
+        case 9:
+            strct.XOrientation = gff.getFloat(field);
+            break;
+        case 10:
+            strct.XPosition = gff.getFloat(field);
+            break;
+        case 11:
+            strct.YOrientation = gff.getFloat(field);
+            break;
+        case 12:
+            strct.YPosition = gff.getFloat(field);
+            break;
+        case 13:
+            strct.ZPosition = gff.getFloat(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_TriggerList decodeGIT_TriggerList(const GffView &gff, const GffView::Struct &gffStruct, const GITLabelSlots &slots) {
+    GIT_TriggerList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.GIT_TriggerList[field.labelIndex]) {
+        case 0:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Geometry.push_back(decodeGIT_TriggerList_Geometry(gff, item, slots));
+            });
+            break;
+        case 1:
+            strct.LinkedTo = gff.getString(field);
+            break;
+        case 2:
+            strct.LinkedToFlags = gff.getUint(field);
+            break;
+        case 3:
+            strct.LinkedToModule = gff.getString(field);
+            break;
+        case 4:
+            strct.Tag = gff.getString(field);
+            break;
+        case 5:
+            strct.TemplateResRef = gff.getString(field);
+            break;
+        case 6:
+            strct.TransitionDestin = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 7:
+            strct.XOrientation = gff.getFloat(field);
+            break;
+        case 8:
+            strct.XPosition = gff.getFloat(field);
+            break;
+        case 9:
+            strct.YOrientation = gff.getFloat(field);
+            break;
+        case 10:
+            strct.YPosition = gff.getFloat(field);
+            break;
+        case 11:
+            strct.ZOrientation = gff.getFloat(field);
+            break;
+        case 12:
+            strct.ZPosition = gff.getFloat(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_StoreList decodeGIT_StoreList(const GffView &gff, const GffView::Struct &gffStruct, const GITLabelSlots &slots) {
+    GIT_StoreList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.GIT_StoreList[field.labelIndex]) {
+        case 0:
+            strct.ResRef = gff.getString(field);
+            break;
+        case 1:
+            strct.XOrientation = gff.getFloat(field);
+            break;
+        case 2:
+            strct.XPosition = gff.getFloat(field);
+            break;
+        case 3:
+            strct.YOrientation = gff.getFloat(field);
+            break;
+        case 4:
+            strct.YPosition = gff.getFloat(field);
+            break;
+        case 5:
+            strct.ZPosition = gff.getFloat(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_SoundList decodeGIT_SoundList(const GffView &gff, const GffView::Struct &gffStruct, const GITLabelSlots &slots) {
+    GIT_SoundList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.GIT_SoundList[field.labelIndex]) {
+        case 0:
+            strct.GeneratedType = gff.getUint(field);
+            break;
+        case 1:
+            strct.TemplateResRef = gff.getString(field);
+            break;
+        case 2:
+            strct.XPosition = gff.getFloat(field);
+            break;
+        case 3:
+            strct.YPosition = gff.getFloat(field);
+            break;
+        case 4:
+            strct.ZPosition = gff.getFloat(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_Placeable_List decodeGIT_Placeable_List(const GffView &gff, const GffView::Struct &gffStruct, const GITLabelSlots &slots) {
+    GIT_Placeable_List strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.GIT_Placeable_List[field.labelIndex]) {
+        case 0:
+            strct.Bearing = gff.getFloat(field);
+            break;
+        case 1:
+            strct.TemplateResRef = gff.getString(field);
+            break;
+        case 2:
+            strct.TweakColor = gff.getUint(field);
+            break;
+        case 3:
+            strct.UseTweakColor = gff.getUint(field);
+            break;
+        case 4:
+            strct.X = gff.getFloat(field);
+            break;
+        case 5:
+            strct.Y = gff.getFloat(field);
+            break;
+        case 6:
+            strct.Z = gff.getFloat(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_Encounter_List decodeGIT_Encounter_List(const GffView &gff, const GffView::Struct &gffStruct, const GITLabelSlots &slots) {
+    GIT_Encounter_List strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.GIT_Encounter_List[field.labelIndex]) {
+        case 0:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Geometry.push_back(decodeGIT_Encounter_List_Geometry(gff, item, slots));
+            });
+            break;
+        case 1:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.SpawnPointList.push_back(decodeGIT_Encounter_List_SpawnPointList(gff, item, slots));
+            });
+            break;
+        case 2:
+            strct.TemplateResRef = gff.getString(field);
+            break;
+        case 3:
+            strct.XPosition = gff.getFloat(field);
+            break;
+        case 4:
+            strct.YPosition = gff.getFloat(field);
+            break;
+        case 5:
+            strct.ZPosition = gff.getFloat(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_Door_List decodeGIT_Door_List(const GffView &gff, const GffView::Struct &gffStruct, const GITLabelSlots &slots) {
+    GIT_Door_List strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.GIT_Door_List[field.labelIndex]) {
+        case 0:
+            strct.Bearing = gff.getFloat(field);
+            break;
+        case 1:
+            strct.LinkedTo = gff.getString(field);
+            break;
+        case 2:
+            strct.LinkedToFlags = gff.getUint(field);
+            break;
+        case 3:
+            strct.LinkedToModule = gff.getString(field);
+            break;
+        case 4:
+            strct.Tag = gff.getString(field);
+            break;
+        case 5:
+            strct.TemplateResRef = gff.getString(field);
+            break;
+        case 6:
+            strct.TransitionDestin = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 7:
+            strct.TweakColor = gff.getUint(field);
+            break;
+        case 8:
+            strct.UseTweakColor = gff.getUint(field);
+            break;
+        case 9:
+            strct.X = gff.getFloat(field);
+            break;
+        case 10:
+            strct.Y = gff.getFloat(field);
+            break;
+        case 11:
+            strct.Z = gff.getFloat(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_Creature_List decodeGIT_Creature_List(const GffView &gff, const GffView::Struct &gffStruct, const GITLabelSlots &slots) {
+    GIT_Creature_List strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.GIT_Creature_List[field.labelIndex]) {
+        case 0:
+            strct.TemplateResRef = gff.getString(field);
+            break;
+        case 1:
+            strct.XOrientation = gff.getFloat(field);
+            break;
+        case 2:
+            strct.XPosition = gff.getFloat(field);
+            break;
+        case 3:
+            strct.YOrientation = gff.getFloat(field);
+            break;
+        case 4:
+            strct.YPosition = gff.getFloat(field);
+            break;
+        case 5:
+            strct.ZPosition = gff.getFloat(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_CameraList decodeGIT_CameraList(const GffView &gff, const GffView::Struct &gffStruct, const GITLabelSlots &slots) {
+    GIT_CameraList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.GIT_CameraList[field.labelIndex]) {
+        case 0:
+            strct.CameraID = gff.getInt(field);
+            break;
+        case 1:
+            strct.FieldOfView = gff.getFloat(field);
+            break;
+        case 2:
+            strct.Height = gff.getFloat(field);
+            break;
+        case 3:
+            strct.MicRange = gff.getFloat(field);
+            break;
+        case 4:
+            strct.Orientation = gff.getOrientation(field);
+            break;
+        case 5:
+            strct.Pitch = gff.getFloat(field);
+            break;
+        case 6:
+            strct.Position = gff.getVector(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT_AreaProperties decodeGIT_AreaProperties(const GffView &gff, const GffView::Struct &gffStruct, const GITLabelSlots &slots) {
+    GIT_AreaProperties strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.GIT_AreaProperties[field.labelIndex]) {
+        case 0:
+            strct.AmbientSndDay = gff.getInt(field);
+            break;
+        case 1:
+            strct.AmbientSndDayVol = gff.getInt(field);
+            break;
+        case 2:
+            strct.AmbientSndNight = gff.getInt(field);
+            break;
+        case 3:
+            strct.AmbientSndNitVol = gff.getInt(field);
+            break;
+        case 4:
+            strct.EnvAudio = gff.getInt(field);
+            break;
+        case 5:
+            strct.MusicBattle = gff.getInt(field);
+            break;
+        case 6:
+            strct.MusicDay = gff.getInt(field);
+            break;
+        case 7:
+            strct.MusicDelay = gff.getInt(field);
+            break;
+        case 8:
+            strct.MusicNight = gff.getInt(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static GIT decodeGIT(const GffView &gff, const GffView::Struct &gffStruct, const GITLabelSlots &slots) {
+    GIT strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.GIT[field.labelIndex]) {
+        case 0:
+            if (field.type == Gff::FieldType::Struct) {
+                strct.AreaProperties = decodeGIT_AreaProperties(gff, gff.getStruct(field), slots);
+            }
+            break;
+        case 1:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.CameraList.push_back(decodeGIT_CameraList(gff, item, slots));
+            });
+            break;
+        case 2:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Creature_List.push_back(decodeGIT_Creature_List(gff, item, slots));
+            });
+            break;
+        case 3:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Door_List.push_back(decodeGIT_Door_List(gff, item, slots));
+            });
+            break;
+        case 4:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Encounter_List.push_back(decodeGIT_Encounter_List(gff, item, slots));
+            });
+            break;
+        case 6:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Placeable_List.push_back(decodeGIT_Placeable_List(gff, item, slots));
+            });
+            break;
+        case 7:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.SoundList.push_back(decodeGIT_SoundList(gff, item, slots));
+            });
+            break;
+        case 8:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.StoreList.push_back(decodeGIT_StoreList(gff, item, slots));
+            });
+            break;
+        case 9:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.TriggerList.push_back(decodeGIT_TriggerList(gff, item, slots));
+            });
+            break;
+        case 10:
+            strct.UseTemplates = gff.getUint(field);
+            break;
+        case 11:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.WaypointList.push_back(decodeGIT_WaypointList(gff, item, slots));
+            });
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+GIT decodeGIT(const GffView &gff) {
+    GITLabelSlots slots;
+    slots.GIT_TriggerList_Geometry = gff.mapLabels({"PointX", "PointY", "PointZ"});
+    slots.GIT_Encounter_List_SpawnPointList = gff.mapLabels({"Orientation", "X", "Y", "Z"});
+    slots.GIT_Encounter_List_Geometry = gff.mapLabels({"X", "Y", "Z"});
+    slots.GIT_WaypointList = gff.mapLabels({"Appearance", "Description", "HasMapNote", "LinkedTo", "LocalizedName", "MapNote", "MapNoteEnabled", "Tag", "TemplateResRef", "XOrientation", "XPosition", "YOrientation", "YPosition", "ZPosition"});
+    slots.GIT_TriggerList = gff.mapLabels({"Geometry", "LinkedTo", "LinkedToFlags", "LinkedToModule", "Tag", "TemplateResRef", "TransitionDestin", "XOrientation", "XPosition", "YOrientation", "YPosition", "ZOrientation", "ZPosition"});
+    slots.GIT_StoreList = gff.mapLabels({"ResRef", "XOrientation", "XPosition", "YOrientation", "YPosition", "ZPosition"});
+    slots.GIT_SoundList = gff.mapLabels({"GeneratedType", "TemplateResRef", "XPosition", "YPosition", "ZPosition"});
+    slots.GIT_Placeable_List = gff.mapLabels({"Bearing", "TemplateResRef", "TweakColor", "UseTweakColor", "X", "Y", "Z"});
+    slots.GIT_Encounter_List = gff.mapLabels({"Geometry", "SpawnPointList", "TemplateResRef", "XPosition", "YPosition", "ZPosition"});
+    slots.GIT_Door_List = gff.mapLabels({"Bearing", "LinkedTo", "LinkedToFlags", "LinkedToModule", "Tag", "TemplateResRef", "TransitionDestin", "TweakColor", "UseTweakColor", "X", "Y", "Z"});
+    slots.GIT_Creature_List = gff.mapLabels({"TemplateResRef", "XOrientation", "XPosition", "YOrientation", "YPosition", "ZPosition"});
+    slots.GIT_CameraList = gff.mapLabels({"CameraID", "FieldOfView", "Height", "MicRange", "Orientation", "Pitch", "Position"});
+    slots.GIT_AreaProperties = gff.mapLabels({"AmbientSndDay", "AmbientSndDayVol", "AmbientSndNight", "AmbientSndNitVol", "EnvAudio", "MusicBattle", "MusicDay", "MusicDelay", "MusicNight"});
+    slots.GIT = gff.mapLabels({"AreaProperties", "CameraList", "Creature List", "Door List", "Encounter List", "List", "Placeable List", "SoundList", "StoreList", "TriggerList", "UseTemplates", "WaypointList"});
+    return decodeGIT(gff, gff.root(), slots);
+}
+
 } // namespace generated
 
 } // namespace resource
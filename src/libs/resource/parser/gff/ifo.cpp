@@ -17,6 +17,7 @@
 
 #include "reone/resource/parser/gff/ifo.h"
 
+#include "reone/resource/format/gffview.h"
 #include "reone/resource/gff.h"
 
 namespace reone {
@@ -78,6 +79,165 @@ IFO parseIFO(const Gff &gff) {
     return strct;
 }
 
+struct IFOLabelSlots {
+    std::vector<int> IFO_Mod_Area_list;
+    std::vector<int> IFO;
+};
+
+static IFO_Mod_Area_list decodeIFO_Mod_Area_list(const GffView &gff, const GffView::Struct &gffStruct, const IFOLabelSlots &slots) {
+    IFO_Mod_Area_list strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.IFO_Mod_Area_list[field.labelIndex]) {
+        case 0:
+            strct.Area_Name = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static IFO decodeIFO(const GffView &gff, const GffView::Struct &gffStruct, const IFOLabelSlots &slots) {
+    IFO strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.IFO[field.labelIndex]) {
+        case 0:
+            strct.Expansion_Pack = gff.getUint(field);
+            break;
+        case 1:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Mod_Area_list.push_back(decodeIFO_Mod_Area_list(gff, item, slots));
+            });
+            break;
+        case 2:
+            strct.Mod_Creator_ID = gff.getInt(field);
+            break;
+        case 4:
+            strct.Mod_DawnHour = gff.getUint(field);
+            break;
+        case 5:
+            strct.Mod_Description = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 6:
+            strct.Mod_DuskHour = gff.getUint(field);
+            break;
+        case 7:
+            strct.Mod_Entry_Area = gff.getString(field);
+            break;
+        case 8:
+            strct.Mod_Entry_Dir_X = gff.getFloat(field);
+            break;
+        case 9:
+            strct.Mod_Entry_Dir_Y = gff.getFloat(field);
+            break;
+        case 10:
+            strct.Mod_Entry_X = gff.getFloat(field);
+            break;
+        case 11:
+            strct.Mod_Entry_Y = gff.getFloat(field);
+            break;
+        case 12:
+            strct.Mod_Entry_Z = gff.getFloat(field);
+            break;
+        case 15:
+            strct.Mod_Hak = gff.getString(field);
+            break;
+        case 16:
+            strct.Mod_ID = gff.getData(field);
+            break;
+        case 17:
+            strct.Mod_IsSaveGame = gff.getUint(field);
+            break;
+        case 18:
+            strct.Mod_MinPerHour = gff.getUint(field);
+            break;
+        case 19:
+            strct.Mod_Name = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 20:
+            strct.Mod_OnAcquirItem = gff.getString(field);
+            break;
+        case 21:
+            strct.Mod_OnActvtItem = gff.getString(field);
+            break;
+        case 22:
+            strct.Mod_OnClientEntr = gff.getString(field);
+            break;
+        case 23:
+            strct.Mod_OnClientLeav = gff.getString(field);
+            break;
+        case 24:
+            strct.Mod_OnHeartbeat = gff.getString(field);
+            break;
+        case 25:
+            strct.Mod_OnModLoad = gff.getString(field);
+            break;
+        case 26:
+            strct.Mod_OnModStart = gff.getString(field);
+            break;
+        case 27:
+            strct.Mod_OnPlrDeath = gff.getString(field);
+            break;
+        case 28:
+            strct.Mod_OnPlrDying = gff.getString(field);
+            break;
+        case 29:
+            strct.Mod_OnPlrLvlUp = gff.getString(field);
+            break;
+        case 30:
+            strct.Mod_OnPlrRest = gff.getString(field);
+            break;
+        case 31:
+            strct.Mod_OnSpawnBtnDn = gff.getString(field);
+            break;
+        case 32:
+            strct.Mod_OnUnAqreItem = gff.getString(field);
+            break;
+        case 33:
+            strct.Mod_OnUsrDefined = gff.getString(field);
+            break;
+        case 34:
+            strct.Mod_StartDay = gff.getUint(field);
+            break;
+        case 35:
+            strct.Mod_StartHour = gff.getUint(field);
+            break;
+        case 36:
+            strct.Mod_StartMonth = gff.getUint(field);
+            break;
+        case 37:
+            strct.Mod_StartMovie = gff.getString(field);
+            break;
+        case 38:
+            strct.Mod_StartYear = gff.getUint(field);
+            break;
+        case 39:
+            strct.Mod_Tag = gff.getString(field);
+            break;
+        case 40:
+            strct.Mod_VO_ID = gff.getString(field);
+            break;
+        case 41:
+            strct.Mod_Version = gff.getUint(field);
+            break;
+        case 42:
+            strct.Mod_XPScale = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+IFO decodeIFO(const GffView &gff) {
+    IFOLabelSlots slots;
+    slots.IFO_Mod_Area_list = gff.mapLabels({"Area_Name"});
+    slots.IFO = gff.mapLabels({"Expansion_Pack", "Mod_Area_list", "Mod_Creator_ID", "Mod_CutSceneList", "Mod_DawnHour", "Mod_Description", "Mod_DuskHour", "Mod_Entry_Area", "Mod_Entry_Dir_X", "Mod_Entry_Dir_Y", "Mod_Entry_X", "Mod_Entry_Y", "Mod_Entry_Z", "Mod_Expan_List", "Mod_GVar_List", "Mod_Hak", "Mod_ID", "Mod_IsSaveGame", "Mod_MinPerHour", "Mod_Name", "Mod_OnAcquirItem", "Mod_OnActvtItem", "Mod_OnClientEntr", "Mod_OnClientLeav", "Mod_OnHeartbeat", "Mod_OnModLoad", "Mod_OnModStart", "Mod_OnPlrDeath", "Mod_OnPlrDying", "Mod_OnPlrLvlUp", "Mod_OnPlrRest", "Mod_OnSpawnBtnDn", "Mod_OnUnAqreItem", "Mod_OnUsrDefined", "Mod_StartDay", "Mod_StartHour", "Mod_StartMonth", "Mod_StartMovie", "Mod_StartYear", "Mod_Tag", "Mod_VO_ID", "Mod_Version", "Mod_XPScale"});
+    return decodeIFO(gff, gff.root(), slots);
+}
+
 } // namespace generated
 
 } // namespace resource
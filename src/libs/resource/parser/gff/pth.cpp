@@ -17,6 +17,7 @@
 
 #include "reone/resource/parser/gff/pth.h"
 
+#include "reone/resource/format/gffview.h"
 #include "reone/resource/gff.h"
 
 namespace reone {
@@ -51,6 +52,78 @@ PTH parsePTH(const Gff &gff) {
     return strct;
 }
 
+struct PTHLabelSlots {
+    std::vector<int> PTH_Path_Points;
+    std::vector<int> PTH_Path_Conections;
+    std::vector<int> PTH;
+};
+
+static PTH_Path_Points decodePTH_Path_Points(const GffView &gff, const GffView::Struct &gffStruct, const PTHLabelSlots &slots) {
+    PTH_Path_Points strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.PTH_Path_Points[field.labelIndex]) {
+        case 0:
+            strct.Conections = gff.getUint(field);
+            break;
+        case 1:
+            strct.First_Conection = gff.getUint(field);
+            break;
+        case 2:
+            strct.X = gff.getFloat(field);
+            break;
+        case 3:
+            strct.Y = gff.getFloat(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static PTH_Path_Conections decodePTH_Path_Conections(const GffView &gff, const GffView::Struct &gffStruct, const PTHLabelSlots &slots) {
+    PTH_Path_Conections strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.PTH_Path_Conections[field.labelIndex]) {
+        case 0:
+            strct.Destination = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static PTH decodePTH(const GffView &gff, const GffView::Struct &gffStruct, const PTHLabelSlots &slots) {
+    PTH strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.PTH[field.labelIndex]) {
+        case 0:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Path_Conections.push_back(decodePTH_Path_Conections(gff, item, slots));
+            });
+            break;
+        case 1:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Path_Points.push_back(decodePTH_Path_Points(gff, item, slots));
+            });
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+PTH decodePTH(const GffView &gff) {
+    PTHLabelSlots slots;
+    slots.PTH_Path_Points = gff.mapLabels({"Conections", "First_Conection", "X", "Y"});
+    slots.PTH_Path_Conections = gff.mapLabels({"Destination"});
+    slots.PTH = gff.mapLabels({"Path_Conections", "Path_Points"});
+    return decodePTH(gff, gff.root(), slots);
+}
+
 } // namespace generated
 
 } // namespace resource
@@ -17,6 +17,7 @@
 
 #include "reone/resource/parser/gff/utc.h"
 
+#include "reone/resource/format/gffview.h"
 #include "reone/resource/gff.h"
 
 namespace reone {
@@ -170,6 +171,405 @@ UTC parseUTC(const Gff &gff) {
     return strct;
 }
 
+struct UTCLabelSlots {
+    std::vector<int> UTC_ClassList_KnownList0;
+    std::vector<int> UTC_SpecAbilityList;
+    std::vector<int> UTC_SkillList;
+    std::vector<int> UTC_ItemList;
+    std::vector<int> UTC_FeatList;
+    std::vector<int> UTC_Equip_ItemList;
+    std::vector<int> UTC_ClassList;
+    std::vector<int> UTC;
+};
+
+static UTC_ClassList_KnownList0 decodeUTC_ClassList_KnownList0(const GffView &gff, const GffView::Struct &gffStruct, const UTCLabelSlots &slots) {
+    UTC_ClassList_KnownList0 strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTC_ClassList_KnownList0[field.labelIndex]) {
+        case 0:
+            strct.Spell = gff.getUint(field);
+            break;
+        case 1:
+            strct.SpellFlags = gff.getUint(field);
+            break;
+        case 2:
+            strct.SpellMetaMagic = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTC_SpecAbilityList decodeUTC_SpecAbilityList(const GffView &gff, const GffView::Struct &gffStruct, const UTCLabelSlots &slots) {
+    UTC_SpecAbilityList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTC_SpecAbilityList[field.labelIndex]) {
+        case 0:
+            strct.Spell = gff.getUint(field);
+            break;
+        case 1:
+            strct.SpellCasterLevel = gff.getUint(field);
+            break;
+        case 2:
+            strct.SpellFlags = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTC_SkillList decodeUTC_SkillList(const GffView &gff, const GffView::Struct &gffStruct, const UTCLabelSlots &slots) {
+    UTC_SkillList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTC_SkillList[field.labelIndex]) {
+        case 0:
+            strct.Rank = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTC_ItemList decodeUTC_ItemList(const GffView &gff, const GffView::Struct &gffStruct, const UTCLabelSlots &slots) {
+    UTC_ItemList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTC_ItemList[field.labelIndex]) {
+        case 0:
+            strct.Dropable = gff.getUint(field);
+            break;
+        case 1:
+            strct.InventoryRes = gff.getString(field);
+            break;
+        case 2:
+            strct.Repos_PosX = gff.getUint(field);
+            break;
+        case 3:
+            strct.Repos_Posy = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTC_FeatList decodeUTC_FeatList(const GffView &gff, const GffView::Struct &gffStruct, const UTCLabelSlots &slots) {
+    UTC_FeatList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTC_FeatList[field.labelIndex]) {
+        case 0:
+            strct.Feat = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTC_Equip_ItemList decodeUTC_Equip_ItemList(const GffView &gff, const GffView::Struct &gffStruct, const UTCLabelSlots &slots) {
+    UTC_Equip_ItemList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTC_Equip_ItemList[field.labelIndex]) {
+        case 0:
+            strct.Dropable = gff.getUint(field);
+            break;
+        case 1:
+            strct.EquippedRes = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTC_ClassList decodeUTC_ClassList(const GffView &gff, const GffView::Struct &gffStruct, const UTCLabelSlots &slots) {
+    UTC_ClassList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTC_ClassList[field.labelIndex]) {
+        case 0:
+            strct.Class = gff.getInt(field);
+            break;
+        case 1:
+            strct.ClassLevel = gff.getInt(field);
+            break;
+        case 2:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.KnownList0.push_back(decodeUTC_ClassList_KnownList0(gff, item, slots));
+            });
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTC decodeUTC(const GffView &gff, const GffView::Struct &gffStruct, const UTCLabelSlots &slots) {
+    UTC strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTC[field.labelIndex]) {
+        case 0:
+            strct.Appearance_Type = gff.getUint(field);
+            break;
+        case 1:
+            strct.BlindSpot = gff.getFloat(field);
+            break;
+        case 2:
+            strct.BodyBag = gff.getUint(field);
+            break;
+        case 3:
+            strct.BodyVariation = gff.getUint(field);
+            break;
+        case 4:
+            strct.Cha = gff.getUint(field);
+            break;
+        case 5:
+            strct.ChallengeRating = gff.getFloat(field);
+            break;
+        case 6:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.ClassList.push_back(decodeUTC_ClassList(gff, item, slots));
+            });
+            break;
+        case 7:
+            strct.Comment = gff.getString(field);
+            break;
+        case 8:
+            strct.Con = gff.getUint(field);
+            break;
+        case 9:
+            strct.Conversation = gff.getString(field);
+            break;
+        case 10:
+            strct.CurrentForce = gff.getInt(field);
+            break;
+        case 11:
+            strct.CurrentHitPoints = gff.getInt(field);
+            break;
+        case 12:
+            strct.Deity = gff.getString(field);
+            break;
+        case 13:
+            strct.Description = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 14:
+            strct.Dex = gff.getUint(field);
+            break;
+        case 15:
+            strct.Disarmable = gff.getUint(field);
+            break;
+        case 16:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Equip_ItemList.push_back(decodeUTC_Equip_ItemList(gff, item, slots));
+            });
+            break;
+        case 17:
+            strct.FactionID = gff.getUint(field);
+            break;
+        case 18:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.FeatList.push_back(decodeUTC_FeatList(gff, item, slots));
+            });
+            break;
+        case 19:
+            strct.FirstName = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 20:
+            strct.ForcePoints = gff.getInt(field);
+            break;
+        case 21:
+            strct.Gender = gff.getUint(field);
+            break;
+        case 22:
+            strct.GoodEvil = gff.getUint(field);
+            break;
+        case 23:
+            strct.HitPoints = gff.getInt(field);
+            break;
+        case 24:
+            strct.Hologram = gff.getUint(field);
+            break;
+        case 25:
+            strct.IgnoreCrePath = gff.getUint(field);
+            break;
+        case 26:
+            strct.Int = gff.getUint(field);
+            break;
+        case 27:
+            strct.Interruptable = gff.getUint(field);
+            break;
+        case 28:
+            strct.IsPC = gff.getUint(field);
+            break;
+        case 29:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.ItemList.push_back(decodeUTC_ItemList(gff, item, slots));
+            });
+            break;
+        case 30:
+            strct.LastName = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 31:
+            strct.LawfulChaotic = gff.getUint(field);
+            break;
+        case 32:
+            strct.MaxHitPoints = gff.getInt(field);
+            break;
+        case 33:
+            strct.Min1HP = gff.getUint(field);
+            break;
+        case 34:
+            strct.MultiplierSet = gff.getUint(field);
+            break;
+        case 35:
+            strct.NaturalAC = gff.getUint(field);
+            break;
+        case 36:
+            strct.NoPermDeath = gff.getUint(field);
+            break;
+        case 37:
+            strct.NotReorienting = gff.getUint(field);
+            break;
+        case 38:
+            strct.PaletteID = gff.getUint(field);
+            break;
+        case 39:
+            strct.PartyInteract = gff.getUint(field);
+            break;
+        case 40:
+            strct.PerceptionRange = gff.getUint(field);
+            break;
+        case 41:
+            strct.Phenotype = gff.getInt(field);
+            break;
+        case 42:
+            strct.Plot = gff.getUint(field);
+            break;
+        case 43:
+            strct.PortraitId = gff.getUint(field);
+            break;
+        case 44:
+            strct.Race = gff.getUint(field);
+            break;
+        case 45:
+            strct.ScriptAttacked = gff.getString(field);
+            break;
+        case 46:
+            strct.ScriptDamaged = gff.getString(field);
+            break;
+        case 47:
+            strct.ScriptDeath = gff.getString(field);
+            break;
+        case 48:
+            strct.ScriptDialogue = gff.getString(field);
+            break;
+        case 49:
+            strct.ScriptDisturbed = gff.getString(field);
+            break;
+        case 50:
+            strct.ScriptEndDialogu = gff.getString(field);
+            break;
+        case 51:
+            strct.ScriptEndRound = gff.getString(field);
+            break;
+        case 52:
+            strct.ScriptHeartbeat = gff.getString(field);
+            break;
+        case 53:
+            strct.ScriptOnBlocked = gff.getString(field);
+            break;
+        case 54:
+            strct.ScriptOnNotice = gff.getString(field);
+            break;
+        case 55:
+            strct.ScriptRested = gff.getString(field);
+            break;
+        case 56:
+            strct.ScriptSpawn = gff.getString(field);
+            break;
+        case 57:
+            strct.ScriptSpellAt = gff.getString(field);
+            break;
+        case 58:
+            strct.ScriptUserDefine = gff.getString(field);
+            break;
+        case 59:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.SkillList.push_back(decodeUTC_SkillList(gff, item, slots));
+            });
+            break;
+        case 60:
+            strct.SoundSetFile = gff.getUint(field);
+            break;
+        case 61:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.SpecAbilityList.push_back(decodeUTC_SpecAbilityList(gff, item, slots));
+            });
+            break;
+        case 62:
+            strct.Str = gff.getUint(field);
+            break;
+        case 63:
+            strct.Subrace = gff.getString(field);
+            break;
+        case 64:
+            strct.SubraceIndex = gff.getUint(field);
+            break;
+        case 65:
+            strct.Tag = gff.getString(field);
+            break;
+        case 67:
+            strct.TemplateResRef = gff.getString(field);
+            break;
+        case 68:
+            strct.TextureVar = gff.getUint(field);
+            break;
+        case 69:
+            strct.WalkRate = gff.getInt(field);
+            break;
+        case 70:
+            strct.WillNotRender = gff.getUint(field);
+            break;
+        case 71:
+            strct.Wis = gff.getUint(field);
+            break;
+        case 72:
+            strct.fortbonus = gff.getInt(field);
+            break;
+        case 73:
+            strct.refbonus = gff.getInt(field);
+            break;
+        case 74:
+            strct.willbonus = gff.getInt(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+UTC decodeUTC(const GffView &gff) {
+    UTCLabelSlots slots;
+    slots.UTC_ClassList_KnownList0 = gff.mapLabels({"Spell", "SpellFlags", "SpellMetaMagic"});
+    slots.UTC_SpecAbilityList = gff.mapLabels({"Spell", "SpellCasterLevel", "SpellFlags"});
+    slots.UTC_SkillList = gff.mapLabels({"Rank"});
+    slots.UTC_ItemList = gff.mapLabels({"Dropable", "InventoryRes", "Repos_PosX", "Repos_Posy"});
+    slots.UTC_FeatList = gff.mapLabels({"Feat"});
+    slots.UTC_Equip_ItemList = gff.mapLabels({"Dropable", "EquippedRes"});
+    slots.UTC_ClassList = gff.mapLabels({"Class", "ClassLevel", "KnownList0"});
+    slots.UTC = gff.mapLabels({"Appearance_Type", "BlindSpot", "BodyBag", "BodyVariation", "Cha", "ChallengeRating", "ClassList", "Comment", "Con", "Conversation", "CurrentForce", "CurrentHitPoints", "Deity", "Description", "Dex", "Disarmable", "Equip_ItemList", "FactionID", "FeatList", "FirstName", "ForcePoints", "Gender", "GoodEvil", "HitPoints", "Hologram", "IgnoreCrePath", "Int", "Interruptable", "IsPC", "ItemList", "LastName", "LawfulChaotic", "MaxHitPoints", "Min1HP", "MultiplierSet", "NaturalAC", "NoPermDeath", "NotReorienting", "PaletteID", "PartyInteract", "PerceptionRange", "Phenotype", "Plot", "PortraitId", "Race", "ScriptAttacked", "ScriptDamaged", "ScriptDeath", "ScriptDialogue", "ScriptDisturbed", "ScriptEndDialogu", "ScriptEndRound", "ScriptHeartbeat", "ScriptOnBlocked", "ScriptOnNotice", "ScriptRested", "ScriptSpawn", "ScriptSpellAt", "ScriptUserDefine", "SkillList", "SoundSetFile", "SpecAbilityList", "Str", "Subrace", "SubraceIndex", "Tag", "TemplateList", "TemplateResRef", "TextureVar", "WalkRate", "WillNotRender", "Wis", "fortbonus", "refbonus", "willbonus"});
+    return decodeUTC(gff, gff.root(), slots);
+}
+
 } // namespace generated
 
 } // namespace resource
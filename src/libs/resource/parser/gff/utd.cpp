@@ -17,6 +17,7 @@
 
 #include "reone/resource/parser/gff/utd.h"
 
+#include "reone/resource/format/gffview.h"
 #include "reone/resource/gff.h"
 
 namespace reone {
@@ -88,6 +89,201 @@ UTD parseUTD(const Gff &gff) {
     return strct;
 }
 
+struct UTDLabelSlots {
+    std::vector<int> UTD;
+};
+
+static UTD decodeUTD(const GffView &gff, const GffView::Struct &gffStruct, const UTDLabelSlots &slots) {
+    UTD strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTD[field.labelIndex]) {
+        case 0:
+            strct.AnimationState = gff.getUint(field);
+            break;
+        case 1:
+            strct.Appearance = gff.getUint(field);
+            break;
+        case 2:
+            strct.AutoRemoveKey = gff.getUint(field);
+            break;
+        case 3:
+            strct.CloseLockDC = gff.getUint(field);
+            break;
+        case 4:
+            strct.Comment = gff.getString(field);
+            break;
+        case 5:
+            strct.Conversation = gff.getString(field);
+            break;
+        case 6:
+            strct.CurrentHP = gff.getInt(field);
+            break;
+        case 7:
+            strct.Description = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 8:
+            strct.DisarmDC = gff.getUint(field);
+            break;
+        case 9:
+            strct.Faction = gff.getUint(field);
+            break;
+        case 10:
+            strct.Fort = gff.getUint(field);
+            break;
+        case 11:
+            strct.GenericType = gff.getUint(field);
+            break;
+        case 12:
+            strct.HP = gff.getInt(field);
+            break;
+        case 13:
+            strct.Hardness = gff.getUint(field);
+            break;
+        case 14:
+            strct.Interruptable = gff.getUint(field);
+            break;
+        case 15:
+            strct.KeyName = gff.getString(field);
+            break;
+        case 16:
+            strct.KeyRequired = gff.getUint(field);
+            break;
+        case 17:
+            strct.LinkedTo = gff.getString(field);
+            break;
+        case 18:
+            strct.LinkedToFlags = gff.getUint(field);
+            break;
+        case 19:
+            strct.LoadScreenID = gff.getUint(field);
+            break;
+        case 20:
+            strct.LocName = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 21:
+            strct.Lockable = gff.getUint(field);
+            break;
+        case 22:
+            strct.Locked = gff.getUint(field);
+            break;
+        case 23:
+            strct.Min1HP = gff.getUint(field);
+            break;
+        case 24:
+            strct.NotBlastable = gff.getUint(field);
+            break;
+        case 25:
+            strct.OnClick = gff.getString(field);
+            break;
+        case 26:
+            strct.OnClosed = gff.getString(field);
+            break;
+        case 27:
+            strct.OnDamaged = gff.getString(field);
+            break;
+        case 28:
+            strct.OnDeath = gff.getString(field);
+            break;
+        case 29:
+            strct.OnDisarm = gff.getString(field);
+            break;
+        case 30:
+            strct.OnFailToOpen = gff.getString(field);
+            break;
+        case 31:
+            strct.OnHeartbeat = gff.getString(field);
+            break;
+        case 32:
+            strct.OnLock = gff.getString(field);
+            break;
+        case 33:
+            strct.OnMeleeAttacked = gff.getString(field);
+            break;
+        case 34:
+            strct.OnOpen = gff.getString(field);
+            break;
+        case 35:
+            strct.OnSpellCastAt = gff.getString(field);
+            break;
+        case 36:
+            strct.OnTrapTriggered = gff.getString(field);
+            break;
+        case 37:
+            strct.OnUnlock = gff.getString(field);
+            break;
+        case 38:
+            strct.OnUserDefined = gff.getString(field);
+            break;
+        case 39:
+            strct.OpenLockDC = gff.getUint(field);
+            break;
+        case 40:
+            strct.OpenLockDiff = gff.getUint(field);
+            break;
+        case 41:
+            strct.OpenLockDiffMod = gff.getInt(field);
+            break;
+        case 42:
+            strct.OpenState = gff.getUint(field);
+            break;
+        case 43:
+            strct.PaletteID = gff.getUint(field);
+            break;
+        case 44:
+            strct.Plot = gff.getUint(field);
+            break;
+        case 45:
+            strct.Portrait = gff.getString(field);
+            break;
+        case 46:
+            strct.PortraitId = gff.getUint(field);
+            break;
+        case 47:
+            strct.Ref = gff.getUint(field);
+            break;
+        case 48:
+            strct.Static = gff.getUint(field);
+            break;
+        case 49:
+            strct.Tag = gff.getString(field);
+            break;
+        case 50:
+            strct.TemplateResRef = gff.getString(field);
+            break;
+        case 51:
+            strct.TrapDetectDC = gff.getUint(field);
+            break;
+        case 52:
+            strct.TrapDetectable = gff.getUint(field);
+            break;
+        case 53:
+            strct.TrapDisarmable = gff.getUint(field);
+            break;
+        case 54:
+            strct.TrapFlag = gff.getUint(field);
+            break;
+        case 55:
+            strct.TrapOneShot = gff.getUint(field);
+            break;
+        case 56:
+            strct.TrapType = gff.getUint(field);
+            break;
+        case 57:
+            strct.Will = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+UTD decodeUTD(const GffView &gff) {
+    UTDLabelSlots slots;
+    slots.UTD = gff.mapLabels({"AnimationState", "Appearance", "AutoRemoveKey", "CloseLockDC", "Comment", "Conversation", "CurrentHP", "Description", "DisarmDC", "Faction", "Fort", "GenericType", "HP", "Hardness", "Interruptable", "KeyName", "KeyRequired", "LinkedTo", "LinkedToFlags", "LoadScreenID", "LocName", "Lockable", "Locked", "Min1HP", "NotBlastable", "OnClick", "OnClosed", "OnDamaged", "OnDeath", "OnDisarm", "OnFailToOpen", "OnHeartbeat", "OnLock", "OnMeleeAttacked", "OnOpen", "OnSpellCastAt", "OnTrapTriggered", "OnUnlock", "OnUserDefined", "OpenLockDC", "OpenLockDiff", "OpenLockDiffMod", "OpenState", "PaletteID", "Plot", "Portrait", "PortraitId", "Ref", "Static", "Tag", "TemplateResRef", "TrapDetectDC", "TrapDetectable", "TrapDisarmable", "TrapFlag", "TrapOneShot", "TrapType", "Will"});
+    return decodeUTD(gff, gff.root(), slots);
+}
+
 } // namespace generated
 
 } // namespace resource
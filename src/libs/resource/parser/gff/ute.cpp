@@ -17,6 +17,7 @@
 
 #include "reone/resource/parser/gff/ute.h"
 
+#include "reone/resource/format/gffview.h"
 #include "reone/resource/gff.h"
 
 namespace reone {
@@ -64,6 +65,123 @@ UTE parseUTE(const Gff &gff) {
     return strct;
 }
 
+struct UTELabelSlots {
+    std::vector<int> UTE_CreatureList;
+    std::vector<int> UTE;
+};
+
+static UTE_CreatureList decodeUTE_CreatureList(const GffView &gff, const GffView::Struct &gffStruct, const UTELabelSlots &slots) {
+    UTE_CreatureList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTE_CreatureList[field.labelIndex]) {
+        case 0:
+            strct.Appearance = gff.getInt(field);
+            break;
+        case 1:
+            strct.CR = gff.getFloat(field);
+            break;
+        case 2:
+            strct.GuaranteedCount = gff.getInt(field);
+            break;
+        case 3:
+            strct.ResRef = gff.getString(field);
+            break;
+        case 4:
+            strct.SingleSpawn = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTE decodeUTE(const GffView &gff, const GffView::Struct &gffStruct, const UTELabelSlots &slots) {
+    UTE strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTE[field.labelIndex]) {
+        case 0:
+            strct.Active = gff.getUint(field);
+            break;
+        case 1:
+            strct.Comment = gff.getString(field);
+            break;
+        case 2:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.CreatureList.push_back(decodeUTE_CreatureList(gff, item, slots));
+            });
+            break;
+        case 3:
+            strct.Difficulty = gff.getInt(field);
+            break;
+        case 4:
+            strct.DifficultyIndex = gff.getInt(field);
+            break;
+        case 5:
+            strct.Faction = gff.getUint(field);
+            break;
+        case 6:
+            strct.LocalizedName = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 7:
+            strct.MaxCreatures = gff.getInt(field);
+            break;
+        case 8:
+            strct.OnEntered = gff.getString(field);
+            break;
+        case 9:
+            strct.OnExhausted = gff.getString(field);
+            break;
+        case 10:
+            strct.OnExit = gff.getString(field);
+            break;
+        case 11:
+            strct.OnHeartbeat = gff.getString(field);
+            break;
+        case 12:
+            strct.OnUserDefined = gff.getString(field);
+            break;
+        case 13:
+            strct.PaletteID = gff.getUint(field);
+            break;
+        case 14:
+            strct.PlayerOnly = gff.getUint(field);
+            break;
+        case 15:
+            strct.RecCreatures = gff.getInt(field);
+            break;
+        case 16:
+            strct.Reset = gff.getUint(field);
+            break;
+        case 17:
+            strct.ResetTime = gff.getInt(field);
+            break;
+        case 18:
+            strct.Respawns = gff.getInt(field);
+            break;
+        case 19:
+            strct.SpawnOption = gff.getInt(field);
+            break;
+        case 20:
+            strct.Tag = gff.getString(field);
+            break;
+        case 21:
+            strct.TemplateResRef = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+UTE decodeUTE(const GffView &gff) {
+    UTELabelSlots slots;
+    slots.UTE_CreatureList = gff.mapLabels({"Appearance", "CR", "GuaranteedCount", "ResRef", "SingleSpawn"});
+    slots.UTE = gff.mapLabels({"Active", "Comment", "CreatureList", "Difficulty", "DifficultyIndex", "Faction", "LocalizedName", "MaxCreatures", "OnEntered", "OnExhausted", "OnExit", "OnHeartbeat", "OnUserDefined", "PaletteID", "PlayerOnly", "RecCreatures", "Reset", "ResetTime", "Respawns", "SpawnOption", "Tag", "TemplateResRef"});
+    return decodeUTE(gff, gff.root(), slots);
+}
+
 } // namespace generated
 
 } // namespace resource
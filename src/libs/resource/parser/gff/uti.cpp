@@ -17,6 +17,7 @@
 
 #include "reone/resource/parser/gff/uti.h"
 
+#include "reone/resource/format/gffview.h"
 #include "reone/resource/gff.h"
 
 namespace reone {
@@ -65,6 +66,126 @@ UTI parseUTI(const Gff &gff) {
     return strct;
 }
 
+struct UTILabelSlots {
+    std::vector<int> UTI_PropertiesList;
+    std::vector<int> UTI;
+};
+
+static UTI_PropertiesList decodeUTI_PropertiesList(const GffView &gff, const GffView::Struct &gffStruct, const UTILabelSlots &slots) {
+    UTI_PropertiesList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTI_PropertiesList[field.labelIndex]) {
+        case 0:
+            strct.ChanceAppear = gff.getUint(field);
+            break;
+        case 1:
+            strct.CostTable = gff.getUint(field);
+            break;
+        case 2:
+            strct.CostValue = gff.getUint(field);
+            break;
+        case 3:
+            strct.Param1 = gff.getUint(field);
+            break;
+        case 4:
+            strct.Param1Value = gff.getUint(field);
+            break;
+        case 5:
+            strct.PropertyName = gff.getUint(field);
+            break;
+        case 6:
+            strct.Subtype = gff.getUint(field);
+            break;
+        case 7:
+            strct.UpgradeType = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTI decodeUTI(const GffView &gff, const GffView::Struct &gffStruct, const UTILabelSlots &slots) {
+    UTI strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTI[field.labelIndex]) {
+        case 0:
+            strct.AddCost = gff.getUint(field);
+            break;
+        case 1:
+            strct.BaseItem = gff.getInt(field);
+            break;
+        case 2:
+            strct.BodyVariation = gff.getUint(field);
+            break;
+        case 3:
+            strct.Charges = gff.getUint(field);
+            break;
+        case 4:
+            strct.Comment = gff.getString(field);
+            break;
+        case 5:
+            strct.Cost = gff.getUint(field);
+            break;
+        case 6:
+            strct.DescIdentified = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 7:
+            strct.Description = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 8:
+            strct.Identified = gff.getUint(field);
+            break;
+        case 9:
+            strct.LocalizedName = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 10:
+            strct.ModelVariation = gff.getUint(field);
+            break;
+        case 11:
+            strct.PaletteID = gff.getUint(field);
+            break;
+        case 12:
+            strct.Plot = gff.getUint(field);
+            break;
+        case 13:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.PropertiesList.push_back(decodeUTI_PropertiesList(gff, item, slots));
+            });
+            break;
+        case 14:
+            strct.StackSize = gff.getUint(field);
+            break;
+        case 15:
+            strct.Stolen = gff.getUint(field);
+            break;
+        case 16:
+            strct.Tag = gff.getString(field);
+            break;
+        case 17:
+            strct.TemplateResRef = gff.getString(field);
+            break;
+        case 18:
+            strct.TextureVar = gff.getUint(field);
+            break;
+        case 19:
+            strct.UpgradeLevel = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+UTI decodeUTI(const GffView &gff) {
+    UTILabelSlots slots;
+    slots.UTI_PropertiesList = gff.mapLabels({"ChanceAppear", "CostTable", "CostValue", "Param1", "Param1Value", "PropertyName", "Subtype", "UpgradeType"});
+    slots.UTI = gff.mapLabels({"AddCost", "BaseItem", "BodyVariation", "Charges", "Comment", "Cost", "DescIdentified", "Description", "Identified", "LocalizedName", "ModelVariation", "PaletteID", "Plot", "PropertiesList", "StackSize", "Stolen", "Tag", "TemplateResRef", "TextureVar", "UpgradeLevel"});
+    return decodeUTI(gff, gff.root(), slots);
+}
+
 } // namespace generated
 
 } // namespace resource
@@ -17,6 +17,7 @@
 
 #include "reone/resource/parser/gff/utm.h"
 
+#include "reone/resource/format/gffview.h"
 #include "reone/resource/gff.h"
 
 namespace reone {
@@ -51,6 +52,84 @@ UTM parseUTM(const Gff &gff) {
     return strct;
 }
 
+struct UTMLabelSlots {
+    std::vector<int> UTM_ItemList;
+    std::vector<int> UTM;
+};
+
+static UTM_ItemList decodeUTM_ItemList(const GffView &gff, const GffView::Struct &gffStruct, const UTMLabelSlots &slots) {
+    UTM_ItemList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTM_ItemList[field.labelIndex]) {
+        case 0:
+            strct.Infinite = gff.getUint(field);
+            break;
+        case 1:
+            strct.InventoryRes = gff.getString(field);
+            break;
+        case 2:
+            strct.Repos_PosX = gff.getUint(field);
+            break;
+        case 3:
+            strct.Repos_Posy = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTM decodeUTM(const GffView &gff, const GffView::Struct &gffStruct, const UTMLabelSlots &slots) {
+    UTM strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTM[field.labelIndex]) {
+        case 0:
+            strct.BuySellFlag = gff.getUint(field);
+            break;
+        case 1:
+            strct.Comment = gff.getString(field);
+            break;
+        case 2:
+            strct.ID = gff.getUint(field);
+            break;
+        case 3:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.ItemList.push_back(decodeUTM_ItemList(gff, item, slots));
+            });
+            break;
+        case 4:
+            strct.LocName = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 5:
+            strct.MarkDown = gff.getInt(field);
+            break;
+        case 6:
+            strct.MarkUp = gff.getInt(field);
+            break;
+        case 7:
+            strct.OnOpenStore = gff.getString(field);
+            break;
+        case 8:
+            strct.ResRef = gff.getString(field);
+            break;
+        case 9:
+            strct.Tag = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+UTM decodeUTM(const GffView &gff) {
+    UTMLabelSlots slots;
+    slots.UTM_ItemList = gff.mapLabels({"Infinite", "InventoryRes", "Repos_PosX", "Repos_Posy"});
+    slots.UTM = gff.mapLabels({"BuySellFlag", "Comment", "ID", "ItemList", "LocName", "MarkDown", "MarkUp", "OnOpenStore", "ResRef", "Tag"});
+    return decodeUTM(gff, gff.root(), slots);
+}
+
 } // namespace generated
 
 } // namespace resource
@@ -17,6 +17,7 @@
 
 #include "reone/resource/parser/gff/utp.h"
 
+#include "reone/resource/format/gffview.h"
 #include "reone/resource/gff.h"
 
 namespace reone {
@@ -102,6 +103,237 @@ UTP parseUTP(const Gff &gff) {
     return strct;
 }
 
+struct UTPLabelSlots {
+    std::vector<int> UTP_ItemList;
+    std::vector<int> UTP;
+};
+
+static UTP_ItemList decodeUTP_ItemList(const GffView &gff, const GffView::Struct &gffStruct, const UTPLabelSlots &slots) {
+    UTP_ItemList strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTP_ItemList[field.labelIndex]) {
+        case 0:
+            strct.InventoryRes = gff.getString(field);
+            break;
+        case 1:
+            strct.Repos_PosX = gff.getUint(field);
+            break;
+        case 2:
+            strct.Repos_Posy = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTP decodeUTP(const GffView &gff, const GffView::Struct &gffStruct, const UTPLabelSlots &slots) {
+    UTP strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTP[field.labelIndex]) {
+        case 0:
+            strct.AnimationState = gff.getUint(field);
+            break;
+        case 1:
+            strct.Appearance = gff.getUint(field);
+            break;
+        case 2:
+            strct.AutoRemoveKey = gff.getUint(field);
+            break;
+        case 3:
+            strct.BodyBag = gff.getUint(field);
+            break;
+        case 4:
+            strct.CloseLockDC = gff.getUint(field);
+            break;
+        case 5:
+            strct.Comment = gff.getString(field);
+            break;
+        case 6:
+            strct.Conversation = gff.getString(field);
+            break;
+        case 7:
+            strct.CurrentHP = gff.getInt(field);
+            break;
+        case 8:
+            strct.Description = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 9:
+            strct.DisarmDC = gff.getUint(field);
+            break;
+        case 10:
+            strct.Faction = gff.getUint(field);
+            break;
+        case 11:
+            strct.Fort = gff.getUint(field);
+            break;
+        case 12:
+            strct.HP = gff.getInt(field);
+            break;
+        case 13:
+            strct.Hardness = gff.getUint(field);
+            break;
+        case 14:
+            strct.HasInventory = gff.getUint(field);
+            break;
+        case 15:
+            strct.Interruptable = gff.getUint(field);
+            break;
+        case 16:
+            strct.IsComputer = gff.getUint(field);
+            break;
+        case 17:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.ItemList.push_back(decodeUTP_ItemList(gff, item, slots));
+            });
+            break;
+        case 18:
+            strct.KeyName = gff.getString(field);
+            break;
+        case 19:
+            strct.KeyRequired = gff.getUint(field);
+            break;
+        case 20:
+            strct.LocName = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 21:
+            strct.Lockable = gff.getUint(field);
+            break;
+        case 22:
+            strct.Locked = gff.getUint(field);
+            break;
+        case 23:
+            strct.Min1HP = gff.getUint(field);
+            break;
+        case 24:
+            strct.NotBlastable = gff.getUint(field);
+            break;
+        case 25:
+            strct.OnClosed = gff.getString(field);
+            break;
+        case 26:
+            strct.OnDamaged = gff.getString(field);
+            break;
+        case 27:
+            strct.OnDeath = gff.getString(field);
+            break;
+        case 28:
+            strct.OnDisarm = gff.getString(field);
+            break;
+        case 29:
+            strct.OnEndDialogue = gff.getString(field);
+            break;
+        case 30:
+            strct.OnFailToOpen = gff.getString(field);
+            break;
+        case 31:
+            strct.OnHeartbeat = gff.getString(field);
+            break;
+        case 32:
+            strct.OnInvDisturbed = gff.getString(field);
+            break;
+        case 33:
+            strct.OnLock = gff.getString(field);
+            break;
+        case 34:
+            strct.OnMeleeAttacked = gff.getString(field);
+            break;
+        case 35:
+            strct.OnOpen = gff.getString(field);
+            break;
+        case 36:
+            strct.OnSpellCastAt = gff.getString(field);
+            break;
+        case 37:
+            strct.OnTrapTriggered = gff.getString(field);
+            break;
+        case 38:
+            strct.OnUnlock = gff.getString(field);
+            break;
+        case 39:
+            strct.OnUsed = gff.getString(field);
+            break;
+        case 40:
+            strct.OnUserDefined = gff.getString(field);
+            break;
+        case 41:
+            strct.OpenLockDC = gff.getUint(field);
+            break;
+        case 42:
+            strct.OpenLockDiff = gff.getUint(field);
+            break;
+        case 43:
+            strct.OpenLockDiffMod = gff.getInt(field);
+            break;
+        case 44:
+            strct.PaletteID = gff.getUint(field);
+            break;
+        case 45:
+            strct.PartyInteract = gff.getUint(field);
+            break;
+        case 46:
+            strct.Plot = gff.getUint(field);
+            break;
+        case 47:
+            strct.Portrait = gff.getString(field);
+            break;
+        case 48:
+            strct.PortraitId = gff.getUint(field);
+            break;
+        case 49:
+            strct.Ref = gff.getUint(field);
+            break;
+        case 50:
+            strct.Static = gff.getUint(field);
+            break;
+        case 51:
+            strct.Tag = gff.getString(field);
+            break;
+        case 52:
+            strct.TemplateResRef = gff.getString(field);
+            break;
+        case 53:
+            strct.TrapDetectDC = gff.getUint(field);
+            break;
+        case 54:
+            strct.TrapDetectable = gff.getUint(field);
+            break;
+        case 55:
+            strct.TrapDisarmable = gff.getUint(field);
+            break;
+        case 56:
+            strct.TrapFlag = gff.getUint(field);
+            break;
+        case 57:
+            strct.TrapOneShot = gff.getUint(field);
+            break;
+        case 58:
+            strct.TrapType = gff.getUint(field);
+            break;
+        case 59:
+            strct.Type = gff.getUint(field);
+            break;
+        case 60:
+            strct.Useable = gff.getUint(field);
+            break;
+        case 61:
+            strct.Will = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+UTP decodeUTP(const GffView &gff) {
+    UTPLabelSlots slots;
+    slots.UTP_ItemList = gff.mapLabels({"InventoryRes", "Repos_PosX", "Repos_Posy"});
+    slots.UTP = gff.mapLabels({"AnimationState", "Appearance", "AutoRemoveKey", "BodyBag", "CloseLockDC", "Comment", "Conversation", "CurrentHP", "Description", "DisarmDC", "Faction", "Fort", "HP", "Hardness", "HasInventory", "Interruptable", "IsComputer", "ItemList", "KeyName", "KeyRequired", "LocName", "Lockable", "Locked", "Min1HP", "NotBlastable", "OnClosed", "OnDamaged", "OnDeath", "OnDisarm", "OnEndDialogue", "OnFailToOpen", "OnHeartbeat", "OnInvDisturbed", "OnLock", "OnMeleeAttacked", "OnOpen", "OnSpellCastAt", "OnTrapTriggered", "OnUnlock", "OnUsed", "OnUserDefined", "OpenLockDC", "OpenLockDiff", "OpenLockDiffMod", "PaletteID", "PartyInteract", "Plot", "Portrait", "PortraitId", "Ref", "Static", "Tag", "TemplateResRef", "TrapDetectDC", "TrapDetectable", "TrapDisarmable", "TrapFlag", "TrapOneShot", "TrapType", "Type", "Useable", "Will"});
+    return decodeUTP(gff, gff.root(), slots);
+}
+
 } // namespace generated
 
 } // namespace resource
@@ -17,6 +17,7 @@
 
 #include "reone/resource/parser/gff/uts.h"
 
+#include "reone/resource/format/gffview.h"
 #include "reone/resource/gff.h"
 
 namespace reone {
@@ -63,6 +64,120 @@ UTS parseUTS(const Gff &gff) {
     return strct;
 }
 
+struct UTSLabelSlots {
+    std::vector<int> UTS_Sounds;
+    std::vector<int> UTS;
+};
+
+static UTS_Sounds decodeUTS_Sounds(const GffView &gff, const GffView::Struct &gffStruct, const UTSLabelSlots &slots) {
+    UTS_Sounds strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTS_Sounds[field.labelIndex]) {
+        case 0:
+            strct.Sound = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+static UTS decodeUTS(const GffView &gff, const GffView::Struct &gffStruct, const UTSLabelSlots &slots) {
+    UTS strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTS[field.labelIndex]) {
+        case 0:
+            strct.Active = gff.getUint(field);
+            break;
+        case 1:
+            strct.Comment = gff.getString(field);
+            break;
+        case 2:
+            strct.Continuous = gff.getUint(field);
+            break;
+        case 3:
+            strct.Elevation = gff.getFloat(field);
+            break;
+        case 4:
+            strct.Hours = gff.getUint(field);
+            break;
+        case 5:
+            strct.Interval = gff.getUint(field);
+            break;
+        case 6:
+            strct.IntervalVrtn = gff.getUint(field);
+            break;
+        case 7:
+            strct.LocName = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 8:
+            strct.Looping = gff.getUint(field);
+            break;
+        case 9:
+            strct.MaxDistance = gff.getFloat(field);
+            break;
+        case 10:
+            strct.MinDistance = gff.getFloat(field);
+            break;
+        case 11:
+            strct.PaletteID = gff.getUint(field);
+            break;
+        case 12:
+            strct.PitchVariation = gff.getFloat(field);
+            break;
+        case 13:
+            strct.Positional = gff.getUint(field);
+            break;
+        case 14:
+            strct.Priority = gff.getUint(field);
+            break;
+        case 15:
+            strct.Random = gff.getUint(field);
+            break;
+        case 16:
+            strct.RandomPosition = gff.getUint(field);
+            break;
+        case 17:
+            strct.RandomRangeX = gff.getFloat(field);
+            break;
+        case 18:
+            strct.RandomRangeY = gff.getFloat(field);
+            break;
+        case 19:
+            gff.forEachListItem(field, [&](const GffView::Struct &item) {
+                strct.Sounds.push_back(decodeUTS_Sounds(gff, item, slots));
+            });
+            break;
+        case 20:
+            strct.Tag = gff.getString(field);
+            break;
+        case 21:
+            strct.TemplateResRef = gff.getString(field);
+            break;
+        case 22:
+            strct.Times = gff.getUint(field);
+            break;
+        case 23:
+            strct.Volume = gff.getUint(field);
+            break;
+        case 24:
+            strct.VolumeVrtn = gff.getUint(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+UTS decodeUTS(const GffView &gff) {
+    UTSLabelSlots slots;
+    slots.UTS_Sounds = gff.mapLabels({"Sound"});
+    slots.UTS = gff.mapLabels({"Active", "Comment", "Continuous", "Elevation", "Hours", "Interval", "IntervalVrtn", "LocName", "Looping", "MaxDistance", "MinDistance", "PaletteID", "PitchVariation", "Positional", "Priority", "Random", "RandomPosition", "RandomRangeX", "RandomRangeY", "Sounds", "Tag", "TemplateResRef", "Times", "Volume", "VolumeVrtn"});
+    return decodeUTS(gff, gff.root(), slots);
+}
+
 } // namespace generated
 
 } // namespace resource
@@ -17,6 +17,7 @@
 
 #include "reone/resource/parser/gff/utt.h"
 
+#include "reone/resource/format/gffview.h"
 #include "reone/resource/gff.h"
 
 namespace reone {
@@ -61,6 +62,120 @@ UTT parseUTT(const Gff &gff) {
     return strct;
 }
 
+struct UTTLabelSlots {
+    std::vector<int> UTT;
+};
+
+static UTT decodeUTT(const GffView &gff, const GffView::Struct &gffStruct, const UTTLabelSlots &slots) {
+    UTT strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTT[field.labelIndex]) {
+        case 0:
+            strct.AutoRemoveKey = gff.getUint(field);
+            break;
+        case 1:
+            strct.Comment = gff.getString(field);
+            break;
+        case 2:
+            strct.Cursor = gff.getUint(field);
+            break;
+        case 3:
+            strct.DisarmDC = gff.getUint(field);
+            break;
+        case 4:
+            strct.Faction = gff.getUint(field);
+            break;
+        case 5:
+            strct.HighlightHeight = gff.getFloat(field);
+            break;
+        case 6:
+            strct.KeyName = gff.getString(field);
+            break;
+        case 7:
+            strct.LinkedTo = gff.getString(field);
+            break;
+        case 8:
+            strct.LinkedToFlags = gff.getUint(field);
+            break;
+        case 9:
+            strct.LoadScreenID = gff.getUint(field);
+            break;
+        case 10:
+            strct.LocalizedName = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 11:
+            strct.OnClick = gff.getString(field);
+            break;
+        case 12:
+            strct.OnDisarm = gff.getString(field);
+            break;
+        case 13:
+            strct.OnTrapTriggered = gff.getString(field);
+            break;
+        case 14:
+            strct.PaletteID = gff.getUint(field);
+            break;
+        case 15:
+            strct.PartyRequired = gff.getUint(field);
+            break;
+        case 16:
+            strct.Portrait = gff.getString(field);
+            break;
+        case 17:
+            strct.PortraitId = gff.getUint(field);
+            break;
+        case 18:
+            strct.ScriptHeartbeat = gff.getString(field);
+            break;
+        case 19:
+            strct.ScriptOnEnter = gff.getString(field);
+            break;
+        case 20:
+            strct.ScriptOnExit = gff.getString(field);
+            break;
+        case 21:
+            strct.ScriptUserDefine = gff.getString(field);
+            break;
+        case 22:
+            strct.Tag = gff.getString(field);
+            break;
+        case 23:
+            strct.TemplateResRef = gff.getString(field);
+            break;
+        case 24:
+            strct.TrapDetectDC = gff.getUint(field);
+            break;
+        case 25:
+            strct.TrapDetectable = gff.getUint(field);
+            break;
+        case 26:
+            strct.TrapDisarmable = gff.getUint(field);
+            break;
+        case 27:
+            strct.TrapFlag = gff.getUint(field);
+            break;
+        case 28:
+            strct.TrapOneShot = gff.getUint(field);
+            break;
+        case 29:
+            strct.TrapType = gff.getUint(field);
+            break;
+        case 30:
+            strct.Type = gff.getInt(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+UTT decodeUTT(const GffView &gff) {
+    UTTLabelSlots slots;
+    slots.UTT = gff.mapLabels({"AutoRemoveKey", "Comment", "Cursor", "DisarmDC", "Faction", "HighlightHeight", "KeyName", "LinkedTo", "LinkedToFlags", "LoadScreenID", "LocalizedName", "OnClick", "OnDisarm", "OnTrapTriggered", "PaletteID", "PartyRequired", "Portrait", "PortraitId", "ScriptHeartbeat", "ScriptOnEnter", "ScriptOnExit", "ScriptUserDefine", "Tag", "TemplateResRef", "TrapDetectDC", "TrapDetectable", "TrapDisarmable", "TrapFlag", "TrapOneShot", "TrapType", "Type"});
+    return decodeUTT(gff, gff.root(), slots);
+}
+
 } // namespace generated
 
 } // namespace resource
@@ -17,6 +17,7 @@
 
 #include "reone/resource/parser/gff/utw.h"
 
+#include "reone/resource/format/gffview.h"
 #include "reone/resource/gff.h"
 
 namespace reone {
@@ -41,6 +42,60 @@ UTW parseUTW(const Gff &gff) {
     return strct;
 }
 
+struct UTWLabelSlots {
+    std::vector<int> UTW;
+};
+
+static UTW decodeUTW(const GffView &gff, const GffView::Struct &gffStruct, const UTWLabelSlots &slots) {
+    UTW strct;
+    gff.forEachField(gffStruct, [&](const GffView::Field &field) {
+        switch (slots.UTW[field.labelIndex]) {
+        case 0:
+            strct.Appearance = gff.getUint(field);
+            break;
+        case 1:
+            strct.Comment = gff.getString(field);
+            break;
+        case 2:
+            strct.Description = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 3:
+            strct.HasMapNote = gff.getUint(field);
+            break;
+        case 4:
+            strct.LinkedTo = gff.getString(field);
+            break;
+        case 5:
+            strct.LocalizedName = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 6:
+            strct.MapNote = std::make_pair(gff.getInt(field), gff.getString(field));
+            break;
+        case 7:
+            strct.MapNoteEnabled = gff.getUint(field);
+            break;
+        case 8:
+            strct.PaletteID = gff.getUint(field);
+            break;
+        case 9:
+            strct.Tag = gff.getString(field);
+            break;
+        case 10:
+            strct.TemplateResRef = gff.getString(field);
+            break;
+        default:
+            break;
+        }
+    });
+    return strct;
+}
+
+UTW decodeUTW(const GffView &gff) {
+    UTWLabelSlots slots;
+    slots.UTW = gff.mapLabels({"Appearance", "Comment", "Description", "HasMapNote", "LinkedTo", "LocalizedName", "MapNote", "MapNoteEnabled", "PaletteID", "Tag", "TemplateResRef"});
+    return decodeUTW(gff, gff.root(), slots);
+}
+
 } // namespace generated
 
 } // namespace resource
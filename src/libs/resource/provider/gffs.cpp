@@ -19,7 +19,6 @@
 
 #include "reone/resource/format/gffreader.h"
 #include "reone/resource/resources.h"
-#include "reone/system/stream/memoryinput.h"
 
 namespace reone {
 
@@ -27,18 +26,31 @@ namespace resource {
 
 std::shared_ptr<Gff> Gffs::get(const std::string &resRef, ResType type) {
     ResourceId resId(resRef, type);
-    return _cache.getOrAdd(resId, [this, &resId]() {
-        auto res = _resources.find(resId);
-        if (!res) {
+    return _cache.getOrAdd(resId, [this, &resRef, &type]() {
+        // Build the tree from the cached view, so that file contents are only held once
+        auto view = getView(resRef, type);
+        if (!view) {
             return std::shared_ptr<Gff>();
         }
-        MemoryInputStream stream(res->data);
-        GffReader reader(stream);
+        GffReader reader(std::move(view));
         reader.load();
         return reader.root();
     });
 }
 
+std::shared_ptr<GffView> Gffs::getView(const std::string &resRef, ResType type) {
+    ResourceId resId(resRef, type);
+    return _viewCache.getOrAdd(resId, [this, &resId]() {
+        auto res = _resources.find(resId);
+        if (!res) {
+            return std::shared_ptr<GffView>();
+        }
+        auto view = std::make_shared<GffView>(std::move(res->data));
+        view->init();
+        return view;
+    });
+}
+
 } // namespace resource
 
 } // namespace reone
@@ -38,6 +38,7 @@ static const std::string kVertModel = "v_model";
 static const std::string kVertMVP = "v_mvp";
 static const std::string kVertMVPNormal = "v_mvpnormal";
 static const std::string kVertAABB = "v_aabb";
+static const std::string kVertGUIQuads = "v_guiquads";
 static const std::string kVertParticles = "v_particles";
 static const std::string kVertPassthrough = "v_passthrough";
 static const std::string kVertShadows = "v_shadows";
@@ -48,6 +49,7 @@ static const std::string kGeometryDirLightShadows = "g_dirlightshadow";
 static const std::string kGeometryPointLightShadows = "g_ptlightshadow";
 
 static const std::string kFragColor = "f_color";
+static const std::string kFragGUIQuads = "f_guiquads";
 static const std::string kFragRetroOpaqueModel = "f_rtr_opaqmodel";
 static const std::string kFragRetroGrass = "f_rtr_grass";
 static const std::string kFragRetroAABB = "f_rtr_aabb";
@@ -81,7 +83,7 @@ static const std::string kFragPBRPrefilter = "f_pbr_prefilter";
 static const std::string kFragProfiler = "f_profiler";
 
 void Shaders::init() {
-    if (_inited) {
+    if (_inited || _graphicsOpt.headless) {
         return;
     }
 
@@ -92,6 +94,7 @@ void Shaders::init() {
     auto vertMVP = initShader(ShaderType::Vertex, kVertMVP);
     auto vertMVPNormal = initShader(ShaderType::Vertex, kVertMVPNormal);
     auto vertAABB = initShader(ShaderType::Vertex, kVertAABB);
+    auto vertGUIQuads = initShader(ShaderType::Vertex, kVertGUIQuads);
     auto vertParticles = initShader(ShaderType::Vertex, kVertParticles);
     auto vertPassthrough = initShader(ShaderType::Vertex, kVertPassthrough);
     auto vertShadows = initShader(ShaderType::Vertex, kVertShadows);
@@ -102,6 +105,7 @@ void Shaders::init() {
     auto geomPointLightShadows = initShader(ShaderType::Geometry, kGeometryPointLightShadows);
 
     auto fragColor = initShader(ShaderType::Fragment, kFragColor);
+    auto fragGUIQuads = initShader(ShaderType::Fragment, kFragGUIQuads);
     auto fragRetroOpaqueModel = initShader(ShaderType::Fragment, kFragRetroOpaqueModel);
     auto fragRetroGrass = initShader(ShaderType::Fragment, kFragRetroGrass);
     auto fragRetroAABB = initShader(ShaderType::Fragment, kFragRetroAABB);
@@ -147,6 +151,7 @@ void Shaders::init() {
     _shaderRegistry.add(ShaderProgramId::pbrSSR, initShaderProgram({vertPassthrough, fragPBRSSR}));
     _shaderRegistry.add(ShaderProgramId::pbrWalkmesh, initShaderProgram({vertWalkmesh, fragPBRWalkmesh}));
     _shaderRegistry.add(ShaderProgramId::dirLightShadows, initShaderProgram({vertShadows, geomDirLightShadows, fragNull}));
+    _shaderRegistry.add(ShaderProgramId::guiQuads, initShaderProgram({vertGUIQuads, fragGUIQuads}));
     _shaderRegistry.add(ShaderProgramId::mvpColor, initShaderProgram({vertMVP, fragColor}));
     _shaderRegistry.add(ShaderProgramId::mvpTexture, initShaderProgram({vertMVP, fragTexture}));
     _shaderRegistry.add(ShaderProgramId::ndcTexture, initShaderProgram({vertPassthrough, fragTextureNoPerspective}));
@@ -178,9 +183,7 @@ void Shaders::deinit() {
 }
 
 std::shared_ptr<Shader> Shaders::initShader(ShaderType type, std::string resRef) {
-    debug(
-        str(boost::format("Initializing shader: type=%d resRef='%s'") % static_cast<int>(type) % resRef),
-        LogChannel::Graphics);
+    R_LOG_DEBUG(LogChannel::Graphics, str(boost::format("Initializing shader: type=%d resRef='%s'") % static_cast<int>(type) % resRef));
 
     std::list<std::string> sources;
 
@@ -222,13 +225,12 @@ std::shared_ptr<Shader> Shaders::initShader(ShaderType type, std::string resRef)
     }
     sources.push_front("#version 400 core\n\n");
 
-    auto shader = std::make_unique<Shader>(type, std::move(sources));
-    shader->init();
-    return shader;
+    // Compiled lazily, when a program using this shader is not in the binary cache
+    return std::make_unique<Shader>(type, std::move(sources));
 }
 
 std::shared_ptr<ShaderProgram> Shaders::initShaderProgram(std::vector<std::shared_ptr<Shader>> shaders) {
-    auto program = std::make_unique<ShaderProgram>(std::move(shaders));
+    auto program = std::make_unique<ShaderProgram>(std::move(shaders), _programBinaryCache);
     program->init();
     program->use();
 
@@ -264,6 +266,7 @@ std::shared_ptr<ShaderProgram> Shaders::initShaderProgram(std::vector<std::share
     program->bindUniformBlock("Walkmesh", UniformBlockBindingPoints::walkmesh);
     program->bindUniformBlock("Text", UniformBlockBindingPoints::text);
     program->bindUniformBlock("ScreenEffect", UniformBlockBindingPoints::screenEffect);
+    program->bindUniformBlock("GUIQuads", UniformBlockBindingPoints::guiQuads);
 
     return program;
 }
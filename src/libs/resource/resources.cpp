@@ -23,6 +23,7 @@
 #include "reone/resource/container/keybif.h"
 #include "reone/resource/container/rim.h"
 #include "reone/resource/exception/notfound.h"
+#include "reone/system/tracer.h"
 
 namespace reone {
 
@@ -30,19 +31,19 @@ namespace resource {
 
 void Resources::addKEY(const std::filesystem::path &path) {
     auto provider = std::make_unique<KeyBifResourceContainer>(path);
-    provider->init();
+    initContainer(*provider, path);
     _containers.push_front(ResourceContainerLocalPair {std::move(provider), false});
 }
 
 void Resources::addERF(const std::filesystem::path &path, bool local) {
     auto provider = std::make_unique<ErfResourceContainer>(path);
-    provider->init();
+    initContainer(*provider, path);
     _containers.push_front(ResourceContainerLocalPair {std::move(provider), local});
 }
 
 void Resources::addRIM(const std::filesystem::path &path, bool local) {
     auto provider = std::make_unique<RimResourceContainer>(path);
-    provider->init();
+    initContainer(*provider, path);
     _containers.push_front(ResourceContainerLocalPair {std::move(provider), local});
 }
 
@@ -54,7 +55,7 @@ void Resources::addEXE(const std::filesystem::path &path) {
 
 void Resources::addFolder(const std::filesystem::path &path) {
     auto provider = std::make_unique<FolderResourceContainer>(path);
-    provider->init();
+    initContainer(*provider, path);
     _containers.push_front(ResourceContainerLocalPair {std::move(provider), false});
 }
 
@@ -67,6 +68,8 @@ Resource Resources::get(const ResourceId &id) {
 }
 
 std::optional<Resource> Resources::find(const ResourceId &id) {
+    R_TRACE_ZONE("Resources::find");
+
     for (auto &[provider, local] : _containers) {
         auto data = provider->findResourceData(id);
         if (data) {
@@ -41,7 +41,7 @@ std::string Strings::getText(int strRef) {
     if (!_table || strRef < 0 || strRef >= _table->getStringCount())
         return "";
 
-    std::string text(_table->getString(strRef).text);
+    std::string text(_table->getText(strRef));
     process(text);
 
     return text;
@@ -51,7 +51,7 @@ std::string Strings::getSound(int strRef) {
     if (!_table || strRef < 0 || strRef >= _table->getStringCount())
         return "";
 
-    return _table->getString(strRef).soundResRef;
+    return std::string(_table->getSoundResRef(strRef));
 }
 
 void Strings::process(std::string &str) {
@@ -21,15 +21,55 @@ namespace reone {
 
 namespace resource {
 
+TalkTable::TalkTable(const std::vector<String> &strings) {
+    size_t dataSize = 0;
+    for (auto &str : strings) {
+        dataSize += str.text.size() + str.soundResRef.size();
+    }
+    _data.reserve(dataSize);
+    _entries.reserve(strings.size());
+    for (auto &str : strings) {
+        Entry entry;
+        entry.textOffset = static_cast<uint32_t>(_data.size());
+        entry.textSize = static_cast<uint32_t>(str.text.size());
+        _data.insert(_data.end(), str.text.begin(), str.text.end());
+        entry.soundResRefOffset = static_cast<uint32_t>(_data.size());
+        entry.soundResRefSize = static_cast<uint32_t>(str.soundResRef.size());
+        _data.insert(_data.end(), str.soundResRef.begin(), str.soundResRef.end());
+        _entries.push_back(std::move(entry));
+    }
+}
+
 int TalkTable::getStringCount() const {
-    return static_cast<int>(_strings.size());
+    return static_cast<int>(_entries.size());
+}
+
+std::string_view TalkTable::getText(int index) const {
+    auto &entry = getEntry(index);
+    if (entry.textSize == 0) {
+        return std::string_view();
+    }
+    auto text = std::string_view(&_data[entry.textOffset], entry.textSize);
+    auto nulIdx = text.find('\0');
+    if (nulIdx != std::string_view::npos) {
+        text = text.substr(0, nulIdx);
+    }
+    return text;
+}
+
+std::string_view TalkTable::getSoundResRef(int index) const {
+    auto &entry = getEntry(index);
+    if (entry.soundResRefSize == 0) {
+        return std::string_view();
+    }
+    return std::string_view(&_data[entry.soundResRefOffset], entry.soundResRefSize);
 }
 
-const TalkTable::String &TalkTable::getString(int index) const {
-    if (index < 0 || index >= static_cast<int>(_strings.size())) {
+const TalkTable::Entry &TalkTable::getEntry(int index) const {
+    if (index < 0 || index >= static_cast<int>(_entries.size())) {
         throw std::out_of_range("index is out of range");
     }
-    return _strings[index];
+    return _entries[index];
 }
 
 } // namespace resource
@@ -40,6 +40,7 @@
 #include "reone/scene/node/walkmesh.h"
 #include "reone/scene/render/pipeline.h"
 #include "reone/system/logutil.h"
+#include "reone/system/tracer.h"
 
 using namespace reone::graphics;
 
@@ -147,6 +148,8 @@ void SceneGraph::removeRoot(SoundSceneNode &node) {
 }
 
 void SceneGraph::update(float dt) {
+    R_TRACE_ZONE("SceneGraph::update");
+
     if (_updateRoots) {
         for (auto &root : _modelRoots) {
             root->update(dt);
@@ -163,6 +166,7 @@ void SceneGraph::update(float dt) {
     }
     cullRoots();
     refresh();
+    computeClosestLights();
     updateLighting();
     updateShadowLight(dt);
     updateFlareLights();
@@ -182,22 +186,64 @@ void SceneGraph::cullRoots() {
     }
 }
 
+static bool compareLightsByDistance(const std::pair<LightSceneNode *, float> &left, const std::pair<LightSceneNode *, float> &right) {
+    // Directional lights are prioritized
+    bool leftDirectional = left.first->isDirectional();
+    bool rightDirectional = right.first->isDirectional();
+    if (leftDirectional != rightDirectional) {
+        return leftDirectional;
+    }
+    return left.second < right.second;
+}
+
+static void keepClosestLights(std::vector<std::pair<LightSceneNode *, float>> &lights, int count) {
+    if (lights.size() > static_cast<size_t>(count)) {
+        std::nth_element(lights.begin(), lights.begin() + count, lights.end(), compareLightsByDistance);
+        lights.resize(count);
+    }
+    std::sort(lights.begin(), lights.end(), compareLightsByDistance);
+}
+
+void SceneGraph::computeClosestLights() {
+    // Compute distance from each light to the camera once, and test it against all criteria.
+    // Lights are collected by refresh every frame, so a spatial index would have to be
+    // rebuilt every frame too, at the same linear cost as this pass.
+    _closestLights.clear();
+    _closestShadowLights.clear();
+    _closestFlareLights.clear();
+    for (auto &light : _lights) {
+        float distance2 = light->getSquareDistanceTo(*_activeCamera);
+        float radius = light->radius();
+        float biasedRadius = radius + kLightRadiusBias;
+        if (distance2 < biasedRadius * biasedRadius) {
+            _closestLights.push_back(std::make_pair(light, distance2));
+        }
+        auto &modelLight = *light->modelNode().light();
+        if (modelLight.shadow && distance2 < radius * radius) {
+            _closestShadowLights.push_back(std::make_pair(light, distance2));
+        }
+        if (!modelLight.flares.empty() && distance2 < modelLight.flareRadius * modelLight.flareRadius) {
+            _closestFlareLights.push_back(std::make_pair(light, distance2));
+        }
+    }
+    keepClosestLights(_closestLights, kMaxLights);
+    keepClosestLights(_closestShadowLights, 1);
+    keepClosestLights(_closestFlareLights, kMaxFlareLights);
+}
+
 void SceneGraph::updateLighting() {
-    // Find closest lights and create a lookup
-    auto closestLights = computeClosestLights(kMaxLights, [](auto &light, float distance2) {
-        float radius = light.radius() + kLightRadiusBias;
-        return distance2 < radius * radius;
-    });
-    std::set<LightSceneNode *> lookup;
-    for (auto &light : closestLights) {
-        lookup.insert(light);
+    // Create a lookup of closest lights
+    std::vector<LightSceneNode *> lookup;
+    for (auto &light : _closestLights) {
+        lookup.push_back(light.first);
     }
     // De-activate active lights, unless found in a lookup. Active lights are removed from the lookup
     for (auto &light : _activeLights) {
-        if (lookup.count(light) == 0) {
+        auto maybeLight = std::find(lookup.begin(), lookup.end(), light);
+        if (maybeLight == lookup.end()) {
             light->setActive(false);
         } else {
-            lookup.erase(light);
+            lookup.erase(maybeLight);
         }
     }
     // Remove active lights that are inactive and completely faded
@@ -220,15 +266,9 @@ void SceneGraph::updateLighting() {
 }
 
 void SceneGraph::updateShadowLight(float dt) {
-    auto closestLights = computeClosestLights(1, [this](auto &light, float distance2) {
-        if (!light.modelNode().light()->shadow) {
-            return false;
-        }
-        float radius = light.radius();
-        return distance2 < radius * radius;
-    });
+    auto &closestLights = _closestShadowLights;
     if (_shadowLight) {
-        if (closestLights.empty() || _shadowLight != closestLights.front()) {
+        if (closestLights.empty() || _shadowLight != closestLights.front().first) {
             _shadowActive = false;
         }
         if (_shadowActive) {
@@ -241,19 +281,16 @@ void SceneGraph::updateShadowLight(float dt) {
         }
     }
     if (!_shadowLight && !closestLights.empty()) {
-        _shadowLight = closestLights.front();
+        _shadowLight = closestLights.front().first;
         _shadowActive = true;
     }
 }
 
 void SceneGraph::updateFlareLights() {
-    _flareLights = computeClosestLights(kMaxFlareLights, [](auto &light, float distance2) {
-        if (light.modelNode().light()->flares.empty()) {
-            return false;
-        }
-        float radius = light.modelNode().light()->flareRadius;
-        return distance2 < radius * radius;
-    });
+    _flareLights.clear();
+    for (auto &light : _closestFlareLights) {
+        _flareLights.push_back(light.first);
+    }
 }
 
 void SceneGraph::updateSounds() {
@@ -521,6 +558,8 @@ Texture &SceneGraph::render(const glm::ivec2 &dim) {
 }
 
 void SceneGraph::renderShadows(IRenderPass &pass) {
+    R_TRACE_ZONE("SceneGraph::renderShadows");
+
     if (!_activeCamera) {
         return;
     }
@@ -532,6 +571,8 @@ void SceneGraph::renderShadows(IRenderPass &pass) {
 }
 
 void SceneGraph::renderOpaque(IRenderPass &pass) {
+    R_TRACE_ZONE("SceneGraph::renderOpaque");
+
     if (!_activeCamera) {
         return;
     }
@@ -577,6 +618,8 @@ void SceneGraph::renderOpaque(IRenderPass &pass) {
 }
 
 void SceneGraph::renderTransparent(IRenderPass &pass) {
+    R_TRACE_ZONE("SceneGraph::renderTransparent");
+
     if (!_activeCamera || _renderWalkmeshes) {
         return;
     }
@@ -587,6 +630,8 @@ void SceneGraph::renderTransparent(IRenderPass &pass) {
 }
 
 void SceneGraph::renderLensFlares(IRenderPass &pass) {
+    R_TRACE_ZONE("SceneGraph::renderLensFlares");
+
     // Draw lens flares
     if (_flareLights.empty() || _renderWalkmeshes) {
         return;
@@ -716,44 +761,6 @@ void SceneGraph::computeLightSpaceMatrices() {
     }
 }
 
-std::vector<LightSceneNode *> SceneGraph::computeClosestLights(int count, const std::function<bool(const LightSceneNode &, float)> &pred) const {
-    // Compute distance from each light to the camera
-    std::vector<std::pair<LightSceneNode *, float>> distances;
-    for (auto &light : _lights) {
-        float distance2 = light->getSquareDistanceTo(*_activeCamera);
-        if (!pred(*light, distance2)) {
-            continue;
-        }
-        distances.push_back(std::make_pair(light, distance2));
-    }
-
-    // Sort lights by distance to the camera. Directional lights are prioritizied
-    sort(distances.begin(), distances.end(), [](auto &a, auto &b) {
-        auto aLight = a.first;
-        auto bLight = b.first;
-        if (aLight->isDirectional() && !bLight->isDirectional()) {
-            return true;
-        }
-        if (!aLight->isDirectional() && bLight->isDirectional()) {
-            return false;
-        }
-        float aDistance = a.second;
-        float bDistance = b.second;
-        return aDistance < bDistance;
-    });
-
-    // Keep up to maximum number of lights
-    if (distances.size() > count) {
-        distances.erase(distances.begin() + count, distances.end());
-    }
-
-    std::vector<LightSceneNode *> lights;
-    for (auto &light : distances) {
-        lights.push_back(light.first);
-    }
-    return lights;
-}
-
 bool SceneGraph::testElevation(const glm::vec2 &position, Collision &outCollision) const {
     static glm::vec3 down(0.0f, 0.0f, -1.0f);
 
@@ -27,13 +27,17 @@ void SceneNode::addChild(SceneNode &node) {
     _children.insert(&node);
 }
 
-void SceneNode::computeAbsoluteTransforms() {
+void SceneNode::computeAbsoluteTransform() {
     if (_parent) {
         _absTransform = _parent->_absTransform * _localTransform;
     } else {
         _absTransform = _localTransform;
     }
     _absTransformInv = glm::inverse(_absTransform);
+}
+
+void SceneNode::computeAbsoluteTransforms() {
+    computeAbsoluteTransform();
 
     for (auto &child : _children) {
         child->computeAbsoluteTransforms();
@@ -164,16 +164,19 @@ void EmitterSceneNode::doSpawnParticle() {
     auto particle = static_cast<ParticleSceneNode *>(_particlePool.front());
     particle->setLifetime(0.0f);
 
+    float rnd[5];
+    randomFloats(rnd, 5, -1.0f, 1.0f);
+
     float halfW = 0.005f * _size.x;
     float halfH = 0.005f * _size.y;
-    glm::vec3 position(randomFloat(-halfW, halfW), randomFloat(-halfH, halfH), 0.0f);
+    glm::vec3 position(rnd[0] * halfW, rnd[1] * halfH, 0.0f);
     particle->setLocalTransform(glm::translate(position));
 
     float halfSpread = 0.5f * _spread;
-    float angle1 = randomFloat(-halfSpread, halfSpread);
-    float angle2 = randomFloat(-halfSpread, halfSpread);
+    float angle1 = rnd[2] * halfSpread;
+    float angle2 = rnd[3] * halfSpread;
     glm::vec3 dir(glm::sin(angle1), glm::sin(angle2), glm::cos(angle1) * glm::cos(angle2));
-    glm::vec3 velocity((_velocity + randomFloat(0.0f, _randomVelocity)) * dir);
+    glm::vec3 velocity((_velocity + 0.5f * (rnd[4] + 1.0f) * _randomVelocity) * dir);
     particle->setVelocity(std::move(velocity));
 
     particle->setFrame(_frameStart);
@@ -202,15 +205,15 @@ void EmitterSceneNode::spawnLightningParticles() {
     float segmentLength = distance / static_cast<float>(_lightningSubDiv + 1);
     float halfRadius = 0.5f * _lightningRadius;
 
+    std::vector<float> offsets(2 * _lightningSubDiv);
+    randomFloats(offsets.data(), static_cast<int>(offsets.size()), -halfRadius, halfRadius);
+
     std::vector<std::pair<glm::vec3, glm::vec3>> segments;
     segments.resize(_lightningSubDiv + 1);
     segments[0].first = origin;
     for (int i = 1; i < _lightningSubDiv + 1; ++i) {
         glm::vec3 dir(glm::normalize(emitterSpaceRefPos - segments[i - 1].first));
-        glm::vec3 offset(
-            randomFloat(-halfRadius, halfRadius),
-            randomFloat(-halfRadius, halfRadius),
-            0.0f);
+        glm::vec3 offset(offsets[2 * (i - 1)], offsets[2 * (i - 1) + 1], 0.0f);
         segments[i - 1].second = segments[i - 1].first + segmentLength * dir + offset;
         segments[i].first = segments[i - 1].second;
     }
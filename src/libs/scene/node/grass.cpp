@@ -42,17 +42,50 @@ static constexpr int kNumClustersInPool = 2048;
 static constexpr float kGrassDensityFactor = 0.25f;
 
 static constexpr float kMaxClusterDistance = 32.0f;
-static constexpr float kMaxClusterDistance2 = kMaxClusterDistance * kMaxClusterDistance;
+
+static constexpr float kGridCellSize = 4.0f;
+// Conservative, accounts for extents of both camera and grass cells
+static constexpr float kMaxCellDistance = kMaxClusterDistance + 1.5f * kGridCellSize;
+static constexpr uint64_t kPlacementSeed = 0x67726173735f7631ull;
 
 void GrassSceneNode::init() {
-    // Compute grass faces
-    auto faces = _aabbNode.mesh()->mesh->faces();
+    auto mesh = _aabbNode.mesh()->mesh;
+    auto &faces = mesh->faces();
+
+    // Compute grass faces and grid bounds
+    std::vector<int> grassFaces;
+    glm::vec2 gridMin {std::numeric_limits<float>::max()};
+    glm::vec2 gridMax {std::numeric_limits<float>::lowest()};
     for (size_t faceIdx = 0; faceIdx < faces.size(); ++faceIdx) {
         auto &face = faces[faceIdx];
         if (_properties.materials.count(face.material) == 0) {
             continue;
         }
-        _grassFaces.push_back(static_cast<int>(faceIdx));
+        grassFaces.push_back(static_cast<int>(faceIdx));
+        gridMin = glm::min(gridMin, glm::vec2(face.centroid));
+        gridMax = glm::max(gridMax, glm::vec2(face.centroid));
+    }
+    if (!grassFaces.empty()) {
+        _gridOrigin = gridMin;
+        _gridSize = glm::ivec2(glm::floor((gridMax - gridMin) / kGridCellSize)) + 1;
+    }
+
+    // Assign grass faces to grid cells by centroid
+    std::vector<std::vector<int>> cellFaces(_gridSize.x * _gridSize.y);
+    for (auto &faceIdx : grassFaces) {
+        auto cell = getCellCoords(faces[faceIdx].centroid);
+        cellFaces[cell.y * _gridSize.x + cell.x].push_back(faceIdx);
+    }
+
+    // Place clusters, grouped by grid cell
+    _cells.resize(cellFaces.size());
+    for (size_t cellIdx = 0; cellIdx < cellFaces.size(); ++cellIdx) {
+        auto &cell = _cells[cellIdx];
+        cell.placementsStart = static_cast<int>(_placements.size());
+        for (auto &faceIdx : cellFaces[cellIdx]) {
+            placeClustersInFace(*mesh, faceIdx, _placements);
+        }
+        cell.numPlacements = static_cast<int>(_placements.size()) - cell.placementsStart;
     }
 
     // Pre-allocate grass clusters
@@ -62,83 +95,112 @@ void GrassSceneNode::init() {
 }
 
 void GrassSceneNode::update(float dt) {
-    if (!_enabled) {
+    if (!_enabled || _cells.empty()) {
         return;
     }
     auto camera = _sceneGraph.camera();
     if (!camera) {
         return;
     }
-    auto mesh = _aabbNode.mesh()->mesh;
-    auto &faces = mesh->faces();
     auto cameraPos = camera->get().origin();
     glm::vec3 meshSpaceCameraPos(_absTransformInv * glm::vec4(cameraPos, 1.0f));
 
-    // Return grass clusters in out-of-distance faces, to the pool
-    std::set<int> outOfDistance;
-    for (auto &pair : _materializedClusters) {
-        auto faceIdx = pair.first;
-        auto &face = faces[faceIdx];
-        float distance2 = glm::distance2(face.centroid, meshSpaceCameraPos);
-        if (distance2 <= kMaxClusterDistance2) {
-            continue;
-        }
-        outOfDistance.insert(faceIdx);
-    }
-    for (auto &faceIdx : outOfDistance) {
-        auto &clusters = _materializedClusters.find(faceIdx)->second;
-        for (auto &cluster : clusters) {
-            _children.erase(cluster);
-            _clusterPool.push(cluster);
-        }
-        _materializedClusters.erase(faceIdx);
-    }
-
-    // Cannot materialize any more grass clusters
-    if (_clusterPool.empty()) {
+    // Set of cells in view radius only changes when camera enters another cell.
+    // Pending cells are only worth another scan once clusters are back in the pool.
+    auto cameraCell = getCellCoords(meshSpaceCameraPos);
+    if (_cameraCell && *_cameraCell == cameraCell && (!_hasPendingCells || _clusterPool.empty())) {
         return;
     }
+    _cameraCell = cameraCell;
 
-    // Sort grass faces by distance to camera
-    std::multimap<float, int> closestFaces;
-    for (size_t faceIdx = 0; faceIdx < faces.size(); ++faceIdx) {
-        auto &face = faces[faceIdx];
-        if (_properties.materials.count(face.material) == 0) {
+    // Return grass clusters in cells that left view radius, to the pool
+    for (auto it = _materializedClusters.begin(); it != _materializedClusters.end();) {
+        glm::ivec2 cell(it->first % _gridSize.x, it->first / _gridSize.x);
+        if (isCellInRange(cell, cameraCell)) {
+            ++it;
             continue;
         }
-        float distance2 = glm::distance2(face.centroid, meshSpaceCameraPos);
-        if (distance2 > kMaxClusterDistance2) {
-            continue;
-        }
-        closestFaces.insert(std::make_pair(distance2, static_cast<int>(faceIdx)));
+        returnCellToPool(it->second);
+        it = _materializedClusters.erase(it);
     }
 
-    // Materialize grass clusters in closest faces, from the pool
-    for (auto &pair : closestFaces) {
-        auto faceIdx = pair.second;
-        if (_materializedClusters.count(faceIdx) > 0) {
-            continue;
+    // Collect cells that entered view radius, or were not fully materialized
+    int radius = static_cast<int>(glm::ceil(kMaxCellDistance / kGridCellSize));
+    glm::ivec2 minCell(glm::max(cameraCell - radius, glm::ivec2(0)));
+    glm::ivec2 maxCell(glm::min(cameraCell + radius, _gridSize - 1));
+    std::vector<std::pair<int, int>> enteringCells;
+    for (int y = minCell.y; y <= maxCell.y; ++y) {
+        for (int x = minCell.x; x <= maxCell.x; ++x) {
+            glm::ivec2 cell(x, y);
+            int cellIdx = y * _gridSize.x + x;
+            if (_cells[cellIdx].numPlacements == 0 || !isCellInRange(cell, cameraCell)) {
+                continue;
+            }
+            auto materialized = _materializedClusters.find(cellIdx);
+            if (materialized != _materializedClusters.end() &&
+                static_cast<int>(materialized->second.size()) == _cells[cellIdx].numPlacements) {
+                continue;
+            }
+            auto offset = cell - cameraCell;
+            enteringCells.push_back(std::make_pair(offset.x * offset.x + offset.y * offset.y, cellIdx));
         }
-        auto &face = faces[faceIdx];
-        auto verts = mesh->faceVertexCoords(face);
-        for (int i = 0; i < getNumClustersInFace(face.area); ++i) {
+    }
+    std::sort(enteringCells.begin(), enteringCells.end());
+
+    // Materialize grass clusters in closest cells, from the pool
+    _hasPendingCells = false;
+    for (auto &pair : enteringCells) {
+        auto cellIdx = pair.second;
+        auto &cell = _cells[cellIdx];
+        auto &clusters = _materializedClusters[cellIdx];
+        for (int i = static_cast<int>(clusters.size()); i < cell.numPlacements; ++i) {
             if (_clusterPool.empty()) {
+                _hasPendingCells = true;
                 return;
             }
-            glm::vec3 baryPosition(getRandomBarycentric());
-            glm::vec3 position(barycentricToCartesian(verts[0], verts[1], verts[2], baryPosition));
-            glm::vec2 lightmapUV(mesh->faceUV2(face, baryPosition));
+            auto &placement = _placements[cell.placementsStart + i];
             auto cluster = _clusterPool.top();
             _clusterPool.pop();
-            cluster->setLocalTransform(glm::translate(position));
-            cluster->setVariant(getRandomGrassVariant());
-            cluster->setLightmapUV(std::move(lightmapUV));
+            cluster->setLocalTransform(glm::translate(placement.position));
+            cluster->setVariant(placement.variant);
+            cluster->setLightmapUV(placement.lightmapUV);
             addChild(*cluster);
-            _materializedClusters[faceIdx].push_back(cluster);
+            clusters.push_back(cluster);
         }
     }
 }
 
+void GrassSceneNode::placeClustersInFace(const Mesh &mesh, int faceIdx, std::vector<ClusterPlacement> &placements) const {
+    auto &face = mesh.faces()[faceIdx];
+    auto verts = mesh.faceVertexCoords(face);
+    RandomGenerator rng(kPlacementSeed ^ static_cast<uint64_t>(faceIdx));
+    for (int i = 0; i < getNumClustersInFace(face.area); ++i) {
+        glm::vec3 baryPosition(getRandomBarycentric(rng));
+        ClusterPlacement placement;
+        placement.position = barycentricToCartesian(verts[0], verts[1], verts[2], baryPosition);
+        placement.lightmapUV = mesh.faceUV2(face, baryPosition);
+        placement.variant = getGrassVariant(rng);
+        placements.push_back(std::move(placement));
+    }
+}
+
+void GrassSceneNode::returnCellToPool(std::vector<GrassClusterSceneNode *> &clusters) {
+    for (auto &cluster : clusters) {
+        _children.erase(cluster);
+        _clusterPool.push(cluster);
+    }
+    clusters.clear();
+}
+
+glm::ivec2 GrassSceneNode::getCellCoords(const glm::vec3 &meshSpacePos) const {
+    return glm::ivec2(glm::floor((glm::vec2(meshSpacePos) - _gridOrigin) / kGridCellSize));
+}
+
+bool GrassSceneNode::isCellInRange(const glm::ivec2 &cell, const glm::ivec2 &cameraCell) const {
+    glm::vec2 offset(cell - cameraCell);
+    return glm::length2(offset * kGridCellSize) <= kMaxCellDistance * kMaxCellDistance;
+}
+
 void GrassSceneNode::renderLeafs(IRenderPass &pass, const std::vector<SceneNode *> &leafs) {
     if (leafs.empty()) {
         return;
@@ -165,9 +227,9 @@ int GrassSceneNode::getNumClustersInFace(float area) const {
     return static_cast<int>(glm::round(kGrassDensityFactor * _properties.density * area));
 }
 
-int GrassSceneNode::getRandomGrassVariant() const {
+int GrassSceneNode::getGrassVariant(RandomGenerator &rng) const {
     float sum = _properties.probabilities[0] + _properties.probabilities[1] + _properties.probabilities[2] + _properties.probabilities[3];
-    float val = randomFloat(0.0f, 1.0f) * sum;
+    float val = rng.nextFloat(0.0f, 1.0f) * sum;
     float upper = 0.0f;
     for (int i = 0; i < 3; ++i) {
         upper += _properties.probabilities[i];
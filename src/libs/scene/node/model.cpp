@@ -50,13 +50,14 @@ void ModelSceneNode::init() {
         return;
     }
     if (_model->rootNode()) {
-        buildNodeTree(*_model->rootNode(), *this);
+        buildNodeTree(*_model->rootNode(), -1);
     }
+    _animated = !_model->getAnimationNames().empty();
     computeAABB();
     _point = _aabb.isDegenerate();
 }
 
-void ModelSceneNode::buildNodeTree(ModelNode &node, SceneNode &parent) {
+void ModelSceneNode::buildNodeTree(ModelNode &node, int parentIdx) {
     // Convert model node to scene node
     std::shared_ptr<ModelNodeSceneNode> sceneNode;
     if (node.isMesh()) {
@@ -74,10 +75,17 @@ void ModelSceneNode::buildNodeTree(ModelNode &node, SceneNode &parent) {
         glm::mat4 transform(node.parent()->absoluteTransform() * node.localTransform());
         sceneNode->setLocalTransform(std::move(transform));
         addChild(*sceneNode);
+        parentIdx = -1;
     } else {
         sceneNode->setLocalTransform(node.localTransform());
+        SceneNode &parent = parentIdx != -1 ? static_cast<SceneNode &>(*_flatNodes[parentIdx]) : *this;
         parent.addChild(*sceneNode);
     }
+    int idx = static_cast<int>(_flatNodes.size());
+    _flatNodes.push_back(sceneNode.get());
+    _flatParents.push_back(parentIdx);
+    _flatDirty.push_back(0);
+    sceneNode->_flat = true;
     _nodeByNumber[node.number()] = sceneNode.get();
     _nodeByName[node.name()] = sceneNode.get();
 
@@ -93,17 +101,72 @@ void ModelSceneNode::buildNodeTree(ModelNode &node, SceneNode &parent) {
         }
     }
     for (auto &child : node.children()) {
-        buildNodeTree(*child, *sceneNode);
+        buildNodeTree(*child, idx);
     }
 }
 
+void ModelSceneNode::computeAbsoluteTransforms() {
+    computeAbsoluteTransform();
+
+    std::fill(_flatDirty.begin(), _flatDirty.end(), 1);
+    _flatTransformsDirty = true;
+    computeFlatTransforms();
+
+    for (auto &child : _children) {
+        if (!child->_flat) {
+            child->computeAbsoluteTransforms();
+        }
+    }
+
+    onAbsoluteTransformChanged();
+}
+
+void ModelSceneNode::setFlatLocalTransform(int idx, const glm::mat4 &transform) {
+    _flatNodes[idx]->_localTransform = transform;
+    _flatDirty[idx] = 1;
+    _flatTransformsDirty = true;
+}
+
+void ModelSceneNode::computeFlatTransforms() {
+    if (!_flatTransformsDirty) {
+        return;
+    }
+    // Parents precede children, so a single pass propagates both dirty flags and transforms
+    int numNodes = static_cast<int>(_flatNodes.size());
+    for (int i = 0; i < numNodes; ++i) {
+        int parentIdx = _flatParents[i];
+        if (parentIdx != -1 && _flatDirty[parentIdx]) {
+            _flatDirty[i] = 1;
+        }
+        if (!_flatDirty[i]) {
+            continue;
+        }
+        auto node = _flatNodes[i];
+        const glm::mat4 &parentTransform = parentIdx != -1 ? _flatNodes[parentIdx]->_absTransform : _absTransform;
+        node->_absTransform = parentTransform * node->_localTransform;
+        node->_absTransformInv = glm::inverse(node->_absTransform);
+        for (auto &child : node->_children) {
+            if (!child->_flat) {
+                child->computeAbsoluteTransforms();
+            }
+        }
+        node->onAbsoluteTransformChanged();
+    }
+    std::fill(_flatDirty.begin(), _flatDirty.end(), 0);
+    _flatTransformsDirty = false;
+}
+
 void ModelSceneNode::update(float dt) {
     // Optimization: skip invisible models
     if (!_enabled) {
         return;
     }
     SceneNode::update(dt);
-    updateAnimations(dt);
+
+    // Optimization: skip animation updates for static models, e.g. most rooms
+    if (_animated || !_animChannels.empty()) {
+        updateAnimations(dt);
+    }
 }
 
 void ModelSceneNode::renderLeafs(IRenderPass &pass, const std::vector<SceneNode *> &leafs) {
@@ -134,9 +197,9 @@ void ModelSceneNode::computeAABB() {
 
 void ModelSceneNode::signalEvent(const std::string &name) {
     if (name == "detonate") {
-        for (auto &node : _nodeByNumber) {
-            if (node.second->type() == SceneNodeType::Emitter) {
-                static_cast<EmitterSceneNode *>(node.second)->detonate();
+        for (auto &node : _flatNodes) {
+            if (node->type() == SceneNodeType::Emitter) {
+                static_cast<EmitterSceneNode *>(node)->detonate();
             }
         }
     } else if (_animEventListener) {
@@ -305,7 +368,7 @@ void ModelSceneNode::updateAnimations(float dt) {
 
     // Apply states and compute bone transforms only when this model is not culled
     if (!_culled) {
-        applyAnimationStates(*_model->rootNode());
+        applyAnimationStates();
     }
 }
 
@@ -426,24 +489,25 @@ void ModelSceneNode::computeAnimationStates(AnimationChannel &channel, float tim
     }
 }
 
-void ModelSceneNode::applyAnimationStates(const ModelNode &modelNode) {
-    auto maybeSceneNode = _nodeByNumber.find(modelNode.number());
-    if (maybeSceneNode != _nodeByNumber.end()) {
-        auto sceneNode = maybeSceneNode->second;
+void ModelSceneNode::applyAnimationStates() {
+    int numNodes = static_cast<int>(_flatNodes.size());
+    for (int i = 0; i < numNodes; ++i) {
+        auto sceneNode = _flatNodes[i];
+        uint16_t number = sceneNode->modelNode().number();
         AnimationState combined;
 
         switch (_animBlendMode) {
         case AnimationBlendMode::Single:
         case AnimationBlendMode::Blend: {
             AnimationState state1;
-            auto state1Iter = _animChannels[0].stateByNodeNumber.find(modelNode.number());
+            auto state1Iter = _animChannels[0].stateByNodeNumber.find(number);
             if (state1Iter != _animChannels[0].stateByNodeNumber.end()) {
                 state1 = state1Iter->second;
             }
             bool blend = _animBlendMode == AnimationBlendMode::Blend && _animChannels[0].transition && _animChannels.size() > 1ll;
             if (blend) {
                 AnimationState state2;
-                auto state2Iter = _animChannels[1].stateByNodeNumber.find(modelNode.number());
+                auto state2Iter = _animChannels[1].stateByNodeNumber.find(number);
                 if (state2Iter != _animChannels[1].stateByNodeNumber.end()) {
                     state2 = state2Iter->second;
                 }
@@ -485,7 +549,7 @@ void ModelSceneNode::applyAnimationStates(const ModelNode &modelNode) {
         }
         case AnimationBlendMode::Overlay:
             for (auto &channel : _animChannels) {
-                auto maybeState = channel.stateByNodeNumber.find(modelNode.number());
+                auto maybeState = channel.stateByNodeNumber.find(number);
                 if (maybeState == channel.stateByNodeNumber.end()) {
                     continue;
                 }
@@ -513,7 +577,7 @@ void ModelSceneNode::applyAnimationStates(const ModelNode &modelNode) {
         }
 
         if (combined.flags & AnimationStateFlags::transform) {
-            sceneNode->setLocalTransform(combined.transform);
+            setFlatLocalTransform(i, combined.transform);
         }
         if (combined.flags & AnimationStateFlags::alpha) {
             static_cast<MeshSceneNode *>(sceneNode)->setAlpha(combined.alpha);
@@ -526,9 +590,7 @@ void ModelSceneNode::applyAnimationStates(const ModelNode &modelNode) {
         }
     }
 
-    for (auto &child : modelNode.children()) {
-        applyAnimationStates(*child);
-    }
+    computeFlatTransforms();
 }
 
 void ModelSceneNode::pauseAnimation() {
@@ -585,10 +647,16 @@ void ModelSceneNode::setModel(Model &model) {
     _nodeByNumber.clear();
     _attachments.clear();
 
+    _flatNodes.clear();
+    _flatParents.clear();
+    _flatDirty.clear();
+    _flatTransformsDirty = false;
+
     _animChannels.clear();
     _animBlendMode = AnimationBlendMode::Single;
+    _animated = !_model->getAnimationNames().empty();
 
-    buildNodeTree(*_model->rootNode(), *this);
+    buildNodeTree(*_model->rootNode(), -1);
     computeAABB();
 }
 
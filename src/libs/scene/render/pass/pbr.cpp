@@ -22,6 +22,7 @@
 #include "reone/graphics/mesh.h"
 #include "reone/graphics/meshregistry.h"
 #include "reone/graphics/pbrtextures.h"
+#include "reone/graphics/shaderprogram.h"
 #include "reone/graphics/shaderregistry.h"
 #include "reone/graphics/texture.h"
 #include "reone/graphics/uniforms.h"
@@ -29,6 +30,10 @@
 
 using namespace reone::graphics;
 
+static const UniformHandle kCornersUniform("uCorners");
+static const UniformHandle kEnvMapDerivedLayerUniform("uEnvMapDerivedLayer");
+static const UniformHandle kSaberDisplacementUniform("uSaberDisplacement");
+
 namespace reone {
 
 namespace scene {
@@ -69,9 +74,9 @@ void PBRRenderPass::withMaterialAppliedToContext(const Material &material, std::
         if (_options.pbr) {
             auto layer = _pbrTextures.findEnvMapDerivedLayer(envMap.name());
             if (layer) {
-                program.setUniform("uEnvMapDerivedLayer", *layer);
+                program.setUniform(kEnvMapDerivedLayerUniform, *layer);
             } else {
-                program.setUniform("uEnvMapDerivedLayer", 0);
+                program.setUniform(kEnvMapDerivedLayerUniform, 0);
                 _pbrTextures.requestEnvMapDerived({envMap});
             }
         }
@@ -200,7 +205,7 @@ void PBRRenderPass::drawSaber(Mesh &mesh,
             locals.modelInv = transformInv;
             applyMaterialToLocals(material, locals);
         });
-        program.setUniform("uSaberDisplacement", displacement);
+        program.setUniform(kSaberDisplacementUniform, displacement);
         mesh.draw(_statistic);
     });
 }
@@ -314,7 +319,7 @@ void PBRRenderPass::applyMaterialToLocals(const Material &material,
 void PBRRenderPass::drawAABB(const std::vector<glm::vec4> &corners) {
     auto &program = _shaderRegistry.get(ShaderProgramId::pbrAABB);
     _context.useProgram(program);
-    program.setUniform("uCorners", corners);
+    program.setUniform(kCornersUniform, corners);
     _context.withDepthMask(false, [this]() {
         _context.withPolygonMode(PolygonMode::Line, [this]() {
             _meshRegistry.get(MeshName::aabb).draw(_statistic);
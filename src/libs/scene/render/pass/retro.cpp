@@ -21,6 +21,7 @@
 #include "reone/graphics/material.h"
 #include "reone/graphics/mesh.h"
 #include "reone/graphics/meshregistry.h"
+#include "reone/graphics/shaderprogram.h"
 #include "reone/graphics/shaderregistry.h"
 #include "reone/graphics/texture.h"
 #include "reone/graphics/uniforms.h"
@@ -28,6 +29,9 @@
 
 using namespace reone::graphics;
 
+static const UniformHandle kCornersUniform("uCorners");
+static const UniformHandle kSaberDisplacementUniform("uSaberDisplacement");
+
 namespace reone {
 
 namespace scene {
@@ -190,7 +194,7 @@ void RetroRenderPass::drawSaber(Mesh &mesh,
             locals.modelInv = transformInv;
             applyMaterialToLocals(material, locals);
         });
-        program.setUniform("uSaberDisplacement", displacement);
+        program.setUniform(kSaberDisplacementUniform, displacement);
         mesh.draw(_statistic);
     });
 }
@@ -283,7 +287,7 @@ void RetroRenderPass::drawGrass(float radius,
 void RetroRenderPass::drawAABB(const std::vector<glm::vec4> &corners) {
     auto &program = _shaderRegistry.get(ShaderProgramId::retroAABB);
     _context.useProgram(program);
-    program.setUniform("uCorners", corners);
+    program.setUniform(kCornersUniform, corners);
     _context.withDepthMask(false, [this]() {
         _context.withPolygonMode(PolygonMode::Line, [this]() {
             _meshRegistry.get(MeshName::aabb).draw(_statistic);
@@ -25,6 +25,7 @@
 #include "reone/script/variable.h"
 #include "reone/system/logger.h"
 #include "reone/system/logutil.h"
+#include "reone/system/tracer.h"
 
 namespace reone {
 
@@ -32,12 +33,46 @@ namespace script {
 
 static constexpr int kStartInstructionOffset = 13;
 static constexpr float kFloatTolerance = 1e-5;
+static constexpr int kInitialStackSize = 256;
+static constexpr int kInitialReturnOffsetCount = 16;
+
+VirtualMachine::VirtualMachine() {
+    _stack.reserve(kInitialStackSize);
+    _returnOffsets.reserve(kInitialReturnOffsetCount);
+}
 
 VirtualMachine::VirtualMachine(std::shared_ptr<ScriptProgram> program, std::unique_ptr<ExecutionContext> context) :
-    _context(std::move(context)),
-    _program(std::move(program)) {
+    VirtualMachine() {
+    reset(std::move(program), std::move(context));
+}
+
+VirtualMachine::~VirtualMachine() {
+}
 
-    static std::unordered_map<InstructionType, std::function<void(VirtualMachine *, const Instruction &)>> g_handlers {
+void VirtualMachine::reset(std::shared_ptr<ScriptProgram> program, std::unique_ptr<ExecutionContext> context) {
+    _program = std::move(program);
+    _context = std::move(context);
+    _stack.clear();
+    _returnOffsets.clear();
+    _nextInstruction = 0;
+    _globalCount = 0;
+    _savedState = ExecutionState();
+}
+
+int VirtualMachine::getHandlerSlot(InstructionType type) {
+    int value = static_cast<int>(type);
+    int byteCode = value & 0xff;
+    int qualifier = (value >> 8) & 0xff;
+    if (byteCode >= 0x40 || qualifier >= 0x40 || (value >> 16) != 0) {
+        return -1;
+    }
+    return byteCode | (qualifier << 6);
+}
+
+const VirtualMachine::HandlerTable &VirtualMachine::handlers() {
+    static const std::pair<InstructionType, Handler> kHandlers[] {
+        {InstructionType::NOP, &VirtualMachine::executeNOP},
+        {InstructionType::NOP2, &VirtualMachine::executeNOP},
         {InstructionType::CPDOWNSP, &VirtualMachine::executeCPDOWNSP},
         {InstructionType::RSADDI, &VirtualMachine::executeRSADDI},
         {InstructionType::RSADDF, &VirtualMachine::executeRSADDF},
@@ -130,14 +165,19 @@ VirtualMachine::VirtualMachine(std::shared_ptr<ScriptProgram> program, std::uniq
         {InstructionType::SAVEBP, &VirtualMachine::executeSAVEBP},
         {InstructionType::RESTOREBP, &VirtualMachine::executeRESTOREBP},
         {InstructionType::STORE_STATE, &VirtualMachine::executeSTORE_STATE}};
-    for (auto &pair : g_handlers) {
-        registerHandler(pair.first, pair.second);
-    }
-    _handlers.insert(std::make_pair(InstructionType::NOP, [](auto &) {}));
-    _handlers.insert(std::make_pair(InstructionType::NOP2, [](auto &) {}));
+    static const HandlerTable g_handlers = []() {
+        HandlerTable table {};
+        for (auto &[type, handler] : kHandlers) {
+            table[getHandlerSlot(type)] = handler;
+        }
+        return table;
+    }();
+    return g_handlers;
 }
 
 int VirtualMachine::run() {
+    R_TRACE_ZONE("VirtualMachine::run");
+
     uint32_t insOff = kStartInstructionOffset;
 
     if (_context->savedState) {
@@ -151,30 +191,29 @@ int VirtualMachine::run() {
         insOff = _context->savedState->insOffset;
     }
 
-    debug(str(boost::format("Run '%s': offset=%04x, caller=%u, triggerrer=%u") %
-              _program->name() %
-              insOff %
-              _context->callerId %
-              _context->triggererId),
-          LogChannel::Script);
+    R_LOG_DEBUG(LogChannel::Script, str(boost::format("Run '%s': offset=%04x, caller=%u, triggerrer=%u") %
+                                        _program->name() %
+                                        insOff %
+                                        _context->callerId %
+                                        _context->triggererId));
 
+    auto &handlers = VirtualMachine::handlers();
     while (insOff < _program->length()) {
         const Instruction &ins = _program->getInstruction(insOff);
-        auto handler = _handlers.find(ins.type);
-
-        if (handler == _handlers.end()) {
+        int slot = getHandlerSlot(ins.type);
+        auto handler = slot != -1 ? handlers[slot] : nullptr;
+        if (!handler) {
             error(str(boost::format("Instruction not implemented: %04x") % static_cast<int>(ins.type)), LogChannel::Script);
             return -1;
         }
         _nextInstruction = ins.nextOffset;
+        R_TRACE_COUNT(ScriptInstructions, 1);
 
-        if (Logger::instance.isChannelEnabled(LogChannel::Script3)) {
-            debug(str(boost::format("Instruction: %s") % describeInstruction(ins, *_context->routines)), LogChannel::Script3);
-        }
+        R_LOG_DEBUG(LogChannel::Script3, str(boost::format("Instruction: %s") % describeInstruction(ins, *_context->routines)));
         try {
-            handler->second(ins);
+            (this->*handler)(ins);
         } catch (const std::exception &ex) {
-            debug(str(boost::format("Halt '%s'") % _program->name()), LogChannel::Script);
+            R_LOG_DEBUG(LogChannel::Script, str(boost::format("Halt '%s'") % _program->name()));
             return -1;
         }
 
@@ -188,6 +227,9 @@ int VirtualMachine::run() {
     return -1;
 }
 
+void VirtualMachine::executeNOP(const Instruction &ins) {
+}
+
 void VirtualMachine::executeCPDOWNSP(const Instruction &ins) {
     int count = ins.size / 4;
     int srcIdx = static_cast<int>(_stack.size()) - count;
@@ -288,13 +330,13 @@ void VirtualMachine::executeACTION(const Instruction &ins) {
     }
 
     Variable retValue = routine.invoke(args, *_context);
-    if (Logger::instance.isChannelEnabled(LogChannel::Script2)) {
+    if (Logger::instance.isEnabled(LogSeverity::Debug, LogChannel::Script2)) {
         std::vector<std::string> argStrings;
         for (auto &arg : args) {
             argStrings.push_back(arg.toString());
         }
         std::string argsString(boost::join(argStrings, ", "));
-        debug(str(boost::format("Action: %04x %s(%s) -> %s") % ins.offset % routine.name() % argsString % retValue.toString()), LogChannel::Script2);
+        R_LOG_DEBUG(LogChannel::Script2, str(boost::format("Action: %04x %s(%s) -> %s") % ins.offset % routine.name() % argsString % retValue.toString()));
     }
     switch (routine.returnType()) {
     case VariableType::Void:
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/script/virtualmachinepool.h"
+
+#include "reone/script/executioncontext.h"
+#include "reone/script/program.h"
+#include "reone/script/virtualmachine.h"
+
+namespace reone {
+
+namespace script {
+
+static constexpr int kMaxIdleMachines = 8;
+
+VirtualMachinePool::VirtualMachinePool() {
+}
+
+VirtualMachinePool::~VirtualMachinePool() {
+}
+
+int VirtualMachinePool::run(std::shared_ptr<ScriptProgram> program, std::unique_ptr<ExecutionContext> context) {
+    auto machine = acquire();
+    machine->reset(std::move(program), std::move(context));
+    int result = machine->run();
+    release(std::move(machine));
+    return result;
+}
+
+std::unique_ptr<VirtualMachine> VirtualMachinePool::acquire() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_idle.empty()) {
+        return std::make_unique<VirtualMachine>();
+    }
+    auto machine = std::move(_idle.back());
+    _idle.pop_back();
+    return machine;
+}
+
+void VirtualMachinePool::release(std::unique_ptr<VirtualMachine> machine) {
+    machine->reset(nullptr, nullptr);
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_idle.size() < kMaxIdleMachines) {
+        _idle.push_back(std::move(machine));
+    }
+}
+
+} // namespace script
+
+} // namespace reone
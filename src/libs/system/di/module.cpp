@@ -24,13 +24,15 @@ static constexpr int kNumThreadPoolThreads = 2;
 void SystemModule::init() {
     _threadPool = std::make_unique<ThreadPool>(kNumThreadPoolThreads);
     _threadPool->init();
+    _random = std::make_unique<Random>(static_cast<uint32_t>(time(nullptr)));
 
-    _services = std::make_unique<SystemServices>(_clock, *_threadPool);
+    _services = std::make_unique<SystemServices>(_clock, *_threadPool, *_random);
 }
 
 void SystemModule::deinit() {
     _services.reset();
 
+    _random.reset();
     _threadPool.reset();
 }
 
@@ -20,42 +20,71 @@
 
 namespace reone {
 
-static const std::unordered_map<LogSeverity, std::string> kSeverityToName {
-    {LogSeverity::Error, "ERROR"},
-    {LogSeverity::Warn, "WARN"},
-    {LogSeverity::Info, "INFO"},
-    {LogSeverity::Debug, "DEBUG"}};
+static constexpr int kBufferSize = 512;
 
-static const std::unordered_map<LogChannel, std::string> kChannelToName {
-    {LogChannel::Global, "global"},
-    {LogChannel::Resources, "resources"},
-    {LogChannel::Resources2, "resources"},
-    {LogChannel::Graphics, "graphics"},
-    {LogChannel::Audio, "audio"},
-    {LogChannel::GUI, "gui"},
-    {LogChannel::Perception, "perception"},
-    {LogChannel::Conversation, "conversation"},
-    {LogChannel::Combat, "combat"},
-    {LogChannel::Script, "script"},
-    {LogChannel::Script2, "script"},
-    {LogChannel::Script3, "script"}};
+static const char *severityName(LogSeverity severity) {
+    switch (severity) {
+    case LogSeverity::Error:
+        return "ERROR";
+    case LogSeverity::Warn:
+        return " WARN";
+    case LogSeverity::Info:
+        return " INFO";
+    case LogSeverity::Debug:
+        return "DEBUG";
+    default:
+        return "?????";
+    }
+}
 
-static constexpr int kBufferSize = 512;
+static const char *channelName(LogChannel channel) {
+    switch (channel) {
+    case LogChannel::Global:
+        return "global";
+    case LogChannel::Resources:
+    case LogChannel::Resources2:
+        return "resources";
+    case LogChannel::Graphics:
+        return "graphics";
+    case LogChannel::Audio:
+        return "audio";
+    case LogChannel::GUI:
+        return "gui";
+    case LogChannel::Perception:
+        return "perception";
+    case LogChannel::Conversation:
+        return "conversation";
+    case LogChannel::Combat:
+        return "combat";
+    case LogChannel::Script:
+    case LogChannel::Script2:
+    case LogChannel::Script3:
+        return "script";
+    default:
+        return "unknown";
+    }
+}
 
 Logger Logger::instance;
-thread_local std::optional<std::reference_wrapper<std::ostringstream>> Logger::buffer;
+thread_local std::string *Logger::buffer {nullptr};
 
 void Logger::init(LogSeverity minSeverity,
                   std::set<LogChannel> enabledChannels,
                   std::optional<std::string> filename) {
     checkThat(!_inited, "Logger already initialized");
-    _minSeverity = minSeverity;
-    _enabledChannels = std::move(enabledChannels);
     if (filename) {
         _stream = std::make_unique<std::ofstream>(*filename);
     } else {
         _stream = std::make_unique<std::ostream>(std::clog.rdbuf());
     }
+    _writerStopped = false;
+    _writer = std::thread {std::bind(&Logger::write, this)};
+    int channelMask = 0;
+    for (auto &channel : enabledChannels) {
+        channelMask |= static_cast<int>(channel);
+    }
+    _channelMask.store(channelMask, std::memory_order_relaxed);
+    _minSeverity.store(static_cast<int>(minSeverity), std::memory_order_relaxed);
     _inited = true;
 }
 
@@ -63,51 +92,84 @@ void Logger::deinit() {
     if (!_inited) {
         return;
     }
-    std::lock_guard<std::mutex> lock {_buffersMutex};
-    for (auto &buffer : _buffers) {
-        flush(buffer);
+    _channelMask.store(0, std::memory_order_relaxed);
+    _minSeverity.store(std::numeric_limits<int>::max(), std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock {_buffersMutex};
+        for (auto &buffer : _buffers) {
+            flush(buffer);
+        }
     }
+    {
+        std::lock_guard<std::mutex> lock {_writeQueueMutex};
+        _writerStopped = true;
+    }
+    _writeQueueCondVar.notify_one();
+    _writer.join();
     _inited = false;
 }
 
-void Logger::append(std::string message,
+void Logger::append(const std::string &message,
                     LogChannel channel,
                     LogSeverity severity) {
-    if (!_inited) {
+    if (!isEnabled(severity, channel)) {
         return;
     }
-    if (static_cast<int>(severity) < static_cast<int>(_minSeverity)) {
-        return;
-    }
-    if (_enabledChannels.count(channel) == 0) {
-        return;
-    }
-    auto formatted = str(boost::format("%1$5s [%2%][%3%] %4%\n") %
-                         kSeverityToName.at(severity) %
-                         threadName() %
-                         kChannelToName.at(channel) %
-                         message);
     if (!buffer) {
         std::lock_guard<std::mutex> lock {_buffersMutex};
-        buffer = _buffers.emplace_back();
+        buffer = &_buffers.emplace_back();
+        buffer->reserve(2 * kBufferSize);
     }
-    auto &buf = buffer->get();
-    buf.write(&formatted[0], formatted.length());
-    if (buf.tellp() >= kBufferSize) {
+    auto &buf = *buffer;
+    buf.append(severityName(severity));
+    buf.append(" [");
+    buf.append(threadName());
+    buf.append("][");
+    buf.append(channelName(channel));
+    buf.append("] ");
+    buf.append(message);
+    buf.push_back('\n');
+    if (buf.size() >= kBufferSize) {
         flush(buf);
     }
 }
 
-void Logger::flush(std::ostringstream &buffer) {
-    if (!_stream) {
+void Logger::flush(std::string &buffer) {
+    if (buffer.empty()) {
         return;
     }
-    auto str = buffer.str();
     {
-        std::lock_guard<std::mutex> lock {_streamMutex};
-        _stream->write(&str[0], str.length());
+        std::lock_guard<std::mutex> lock {_writeQueueMutex};
+        _writeQueue.push(std::move(buffer));
+    }
+    _writeQueueCondVar.notify_one();
+    buffer = std::string();
+    buffer.reserve(2 * kBufferSize);
+}
+
+void Logger::write() {
+    setThreadName("log");
+    while (true) {
+        std::queue<std::string> queue;
+        bool stopped = false;
+        {
+            std::unique_lock<std::mutex> lock {_writeQueueMutex};
+            _writeQueueCondVar.wait(lock, [this]() {
+                return _writerStopped || !_writeQueue.empty();
+            });
+            std::swap(queue, _writeQueue);
+            stopped = _writerStopped;
+        }
+        while (!queue.empty()) {
+            auto &str = queue.front();
+            _stream->write(&str[0], str.length());
+            queue.pop();
+        }
+        _stream->flush();
+        if (stopped) {
+            break;
+        }
     }
-    buffer.str("");
 }
 
 } // namespace reone
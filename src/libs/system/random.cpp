@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/system/random.h"
+
+namespace reone {
+
+static inline uint32_t rotl(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+static uint64_t splitMix64(uint64_t &state) {
+    uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+void RandomGenerator::seed(uint64_t seed) {
+    uint64_t state = seed;
+    for (int i = 0; i < 4; i += 2) {
+        uint64_t value = splitMix64(state);
+        _state[i] = static_cast<uint32_t>(value);
+        _state[i + 1] = static_cast<uint32_t>(value >> 32);
+    }
+}
+
+uint32_t RandomGenerator::next() {
+    uint32_t result = rotl(_state[1] * 5, 7) * 9;
+    uint32_t t = _state[1] << 9;
+    _state[2] ^= _state[0];
+    _state[3] ^= _state[1];
+    _state[1] ^= _state[2];
+    _state[0] ^= _state[3];
+    _state[2] ^= t;
+    _state[3] = rotl(_state[3], 11);
+    return result;
+}
+
+int RandomGenerator::nextInt(int min, int max) {
+    if (max <= min) {
+        return min;
+    }
+    // Lemire's multiply-shift reduction
+    uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1;
+    uint64_t scaled = static_cast<uint64_t>(next()) * range;
+    return static_cast<int>(min + static_cast<int64_t>(scaled >> 32));
+}
+
+float RandomGenerator::nextFloat(float min, float max) {
+    // 24 random bits give every representable float in [0, 1)
+    float unit = (next() >> 8) * (1.0f / 16777216.0f);
+    return min + unit * (max - min);
+}
+
+void RandomGenerator::nextFloats(float *values, int count, float min, float max) {
+    float scale = (max - min) * (1.0f / 16777216.0f);
+    for (int i = 0; i < count; ++i) {
+        values[i] = min + (next() >> 8) * scale;
+    }
+}
+
+void Random::seed(uint32_t seed) {
+    for (size_t i = 0; i < _streams.size(); ++i) {
+        _streams[i].seed((static_cast<uint64_t>(i) << 32) | seed);
+    }
+}
+
+} // namespace reone
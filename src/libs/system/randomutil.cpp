@@ -17,18 +17,64 @@
 
 #include "reone/system/randomutil.h"
 
+#include "reone/system/random.h"
+#include "reone/system/threadutil.h"
+
 namespace reone {
 
-static std::default_random_engine g_generator(static_cast<uint32_t>(time(nullptr)));
+struct ThreadGenerator {
+    RandomGenerator generator;
+    uint32_t seedVersion {0};
+    std::optional<uint32_t> streamIndex;
+};
+
+static std::atomic<uint32_t> g_seed {static_cast<uint32_t>(time(nullptr))};
+static std::atomic<uint32_t> g_seedVersion {1};
+
+static thread_local ThreadGenerator t_generator;
+
+static uint32_t hashThreadName() {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (char ch : threadName()) {
+        hash ^= static_cast<uint8_t>(ch);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static RandomGenerator &threadGenerator() {
+    uint32_t seedVersion = g_seedVersion.load(std::memory_order_acquire);
+    if (t_generator.seedVersion != seedVersion) {
+        if (!t_generator.streamIndex) {
+            t_generator.streamIndex = hashThreadName();
+        }
+        t_generator.generator.seed((static_cast<uint64_t>(*t_generator.streamIndex) << 32) | g_seed.load());
+        t_generator.seedVersion = seedVersion;
+    }
+    return t_generator.generator;
+}
+
+void setRandomSeed(uint32_t seed) {
+    g_seed = seed;
+    g_seedVersion.fetch_add(1, std::memory_order_release);
+}
+
+void setThreadRandomStream(uint32_t index) {
+    t_generator.streamIndex = index;
+    t_generator.seedVersion = 0; // reseed on next use
+}
 
 int randomInt(int min, int max) {
-    std::uniform_int_distribution<int> dist(min, max);
-    return dist(g_generator);
+    return threadGenerator().nextInt(min, max);
 }
 
 float randomFloat(float min, float max) {
-    std::uniform_real_distribution<float> distr(min, max);
-    return distr(g_generator);
+    return threadGenerator().nextFloat(min, max);
+}
+
+void randomFloats(float *values, int count, float min, float max) {
+    threadGenerator().nextFloats(values, count, min, max);
 }
 
 } // namespace reone
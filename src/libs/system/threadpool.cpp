@@ -21,12 +21,14 @@ namespace reone {
 
 void ThreadPool::init() {
     if (_numThreads == -1) {
-        _numThreads = static_cast<int>(std::thread::hardware_concurrency());
+        // hardware_concurrency may return 0 when it cannot be determined
+        _numThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
     }
+    // Workers exit immediately unless the pool is already running
+    _running = true;
     for (auto i = 0; i < _numThreads; ++i) {
         _threads.emplace_back(std::bind(&ThreadPool::workerThreadFunc, this));
     }
-    _running = true;
 }
 
 void ThreadPool::deinit() {
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "reone/system/tracer.h"
+
+#include "reone/system/threadutil.h"
+
+namespace reone {
+
+static const std::array<const char *, static_cast<int>(TraceCounter::kCount)> kCounterNames {
+    "DrawCalls",
+    "TextureUploads",
+    "ScriptInstructions",
+    "Raycasts",
+    "UniformUpdates"};
+
+static int64_t steadyMicros() {
+    auto sinceEpoch = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::microseconds>(sinceEpoch).count();
+}
+
+static void writeJsonString(std::ostream &out, const std::string &str) {
+    out << '"';
+    for (char ch : str) {
+        if (ch == '"' || ch == '\\') {
+            out << '\\' << ch;
+        } else if (static_cast<unsigned char>(ch) < 0x20) {
+            out << ' ';
+        } else {
+            out << ch;
+        }
+    }
+    out << '"';
+}
+
+Tracer Tracer::instance;
+thread_local Tracer::ThreadBuffer *Tracer::threadBuffer {nullptr};
+
+void Tracer::start() {
+    _enabled.store(false, std::memory_order_relaxed);
+    _origin.store(steadyMicros(), std::memory_order_relaxed);
+    _epoch.fetch_add(1, std::memory_order_release);
+    for (auto &counter : _counters) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+    {
+        std::lock_guard<std::mutex> lock {_counterSamplesMutex};
+        _counterSamples.clear();
+    }
+    _enabled.store(true, std::memory_order_release);
+}
+
+void Tracer::stop() {
+    _enabled.store(false, std::memory_order_release);
+}
+
+void Tracer::markFrame() {
+    auto sample = CounterSample();
+    sample.time = now();
+    for (int i = 0; i < static_cast<int>(TraceCounter::kCount); ++i) {
+        int64_t value = _counters[i].exchange(0, std::memory_order_relaxed);
+        _lastFrameCounters[i].store(value, std::memory_order_relaxed);
+        sample.values[i] = value;
+    }
+    if (!isEnabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock {_counterSamplesMutex};
+    _counterSamples.push_back(std::move(sample));
+}
+
+void Tracer::exportChromeTrace(std::ostream &out) {
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    auto separate = [&out, &first]() {
+        if (!first) {
+            out << ",\n";
+        }
+        first = false;
+    };
+    uint32_t epoch = _epoch.load(std::memory_order_acquire);
+    {
+        std::lock_guard<std::mutex> lock {_buffersMutex};
+        for (auto &buffer : _buffers) {
+            separate();
+            out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer.id << ",\"args\":{\"name\":";
+            writeJsonString(out, buffer.name);
+            out << "}}";
+            if (buffer.epoch.load(std::memory_order_acquire) != epoch) {
+                continue;
+            }
+            uint32_t numZones = buffer.numZones.load(std::memory_order_acquire);
+            for (uint32_t i = 0; i < numZones; ++i) {
+                auto &zone = buffer.zones[i];
+                separate();
+                out << "{\"name\":";
+                writeJsonString(out, zone.name);
+                out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer.id
+                    << ",\"ts\":" << zone.start
+                    << ",\"dur\":" << (zone.end - zone.start)
+                    << ",\"args\":{\"depth\":" << zone.depth << "}}";
+            }
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock {_counterSamplesMutex};
+        for (auto &sample : _counterSamples) {
+            for (int i = 0; i < static_cast<int>(TraceCounter::kCount); ++i) {
+                separate();
+                out << "{\"name\":\"" << kCounterNames[i] << "\",\"ph\":\"C\",\"pid\":1,\"ts\":" << sample.time
+                    << ",\"args\":{\"value\":" << sample.values[i] << "}}";
+            }
+        }
+    }
+    out << "],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedZones\":" << numDroppedZones() << "}}\n";
+}
+
+std::vector<Tracer::ZoneStats> Tracer::zoneStats() {
+    auto nameToStats = std::map<std::string, ZoneStats>();
+    uint32_t epoch = _epoch.load(std::memory_order_acquire);
+    {
+        std::lock_guard<std::mutex> lock {_buffersMutex};
+        for (auto &buffer : _buffers) {
+            if (buffer.epoch.load(std::memory_order_acquire) != epoch) {
+                continue;
+            }
+            uint32_t numZones = buffer.numZones.load(std::memory_order_acquire);
+            for (uint32_t i = 0; i < numZones; ++i) {
+                auto &zone = buffer.zones[i];
+                auto &stats = nameToStats[zone.name];
+                uint64_t time = zone.end - zone.start;
+                ++stats.count;
+                stats.totalTime += time;
+                stats.maxTime = std::max(stats.maxTime, time);
+            }
+        }
+    }
+    auto allStats = std::vector<ZoneStats>();
+    allStats.reserve(nameToStats.size());
+    for (auto &[name, stats] : nameToStats) {
+        stats.name = name;
+        allStats.push_back(std::move(stats));
+    }
+    std::sort(allStats.begin(), allStats.end(), [](auto &left, auto &right) {
+        return left.totalTime > right.totalTime;
+    });
+    return allStats;
+}
+
+uint32_t Tracer::numDroppedZones() {
+    uint32_t numDropped = 0;
+    uint32_t epoch = _epoch.load(std::memory_order_acquire);
+    std::lock_guard<std::mutex> lock {_buffersMutex};
+    for (auto &buffer : _buffers) {
+        if (buffer.epoch.load(std::memory_order_acquire) != epoch) {
+            continue;
+        }
+        numDropped += buffer.numDropped.load(std::memory_order_relaxed);
+    }
+    return numDropped;
+}
+
+uint64_t Tracer::beginZone() {
+    auto &buffer = getThreadBuffer();
+    ++buffer.depth;
+    return now();
+}
+
+void Tracer::endZone(const char *name, uint64_t start) {
+    uint64_t end = now();
+    auto &buffer = getThreadBuffer();
+    if (buffer.depth > 0) {
+        --buffer.depth;
+    }
+    if (!isEnabled()) {
+        return;
+    }
+    uint32_t numZones = buffer.numZones.load(std::memory_order_relaxed);
+    if (numZones == kMaxZonesPerThread) {
+        buffer.numDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    auto &zone = buffer.zones[numZones];
+    zone.name = name;
+    zone.start = start;
+    zone.end = std::max(start, end);
+    zone.depth = buffer.depth;
+    buffer.numZones.store(numZones + 1, std::memory_order_release);
+}
+
+uint64_t Tracer::now() const {
+    int64_t micros = steadyMicros() - _origin.load(std::memory_order_relaxed);
+    return static_cast<uint64_t>(std::max<int64_t>(0, micros));
+}
+
+Tracer::ThreadBuffer &Tracer::getThreadBuffer() {
+    if (!threadBuffer) {
+        std::lock_guard<std::mutex> lock {_buffersMutex};
+        auto &buffer = _buffers.emplace_back();
+        buffer.name = threadName();
+        buffer.id = static_cast<uint32_t>(_buffers.size());
+        buffer.zones = std::make_unique<Zone[]>(kMaxZonesPerThread);
+        threadBuffer = &buffer;
+    }
+    uint32_t epoch = _epoch.load(std::memory_order_acquire);
+    if (threadBuffer->epoch.load(std::memory_order_relaxed) != epoch) {
+        // Reset counts before publishing the new epoch, so that readers never
+        // pair it with zones from the previous capture
+        threadBuffer->numZones.store(0, std::memory_order_release);
+        threadBuffer->numDropped.store(0, std::memory_order_relaxed);
+        threadBuffer->epoch.store(epoch, std::memory_order_release);
+    }
+    return *threadBuffer;
+}
+
+} // namespace reone
@@ -95,22 +95,10 @@ void ErfTool::toERF(Operation operation, const std::filesystem::path &target, co
         if (resType == ResType::Invalid)
             continue;
 
-        std::ifstream in(path, std::ios::binary);
-        in.seekg(0, std::ios::end);
-        size_t size = in.tellg();
-        ByteBuffer data(size, '\0');
-        in.seekg(0);
-        in.read(&data[0], size);
-
         std::filesystem::path resRef(path.filename());
         resRef.replace_extension("");
 
-        ErfWriter::Resource res;
-        res.resRef = resRef.string();
-        res.resType = resType;
-        res.data = std::move(data);
-
-        erf.add(std::move(res));
+        erf.add(resRef.string(), resType, ResourcePayload::fromFile(path));
     }
 
     ErfWriter::FileType type;
@@ -95,22 +95,10 @@ void RimTool::toRIM(const std::filesystem::path &target, const std::filesystem::
         if (resType == ResType::Invalid)
             continue;
 
-        std::ifstream in(path, std::ios::binary);
-        in.seekg(0, std::ios::end);
-        size_t size = in.tellg();
-        ByteBuffer data(size, '\0');
-        in.seekg(0);
-        in.read(&data[0], size);
-
         std::filesystem::path resRef(path.filename());
         resRef.replace_extension("");
 
-        RimWriter::Resource res;
-        res.resRef = resRef.string();
-        res.resType = resType;
-        res.data = std::move(data);
-
-        rim.add(std::move(res));
+        rim.add(resRef.string(), resType, ResourcePayload::fromFile(path));
     }
 
     std::filesystem::path rimPath {destPath};
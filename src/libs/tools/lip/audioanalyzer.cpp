@@ -23,82 +23,150 @@ using namespace reone::audio;
 
 namespace reone {
 
+static float frameDuration(const AudioClip::Frame &frame) {
+    return frame.samples.size() / frame.stride() / static_cast<float>(frame.sampleRate);
+}
+
+AudioEnvelope AudioAnalyzer::envelope(const AudioClip &clip, float windowDuration) {
+    AudioEnvelope envelope;
+    envelope.windowDuration = windowDuration;
+    envelope.duration = clip.duration();
+
+    int windowCount = static_cast<int>(std::ceil(clip.duration() / windowDuration));
+    if (windowCount == 0) {
+        return envelope;
+    }
+    envelope.peak.resize(windowCount, 0.0f);
+    envelope.rms.resize(windowCount, 0.0f);
+    std::vector<int> windowSampleCounts(windowCount, 0);
+
+    float windowsPerSecond = 1.0f / windowDuration;
+    float frameStart = 0.0f;
+    int lastWindow = -1;
+    float lastAmplitude = 0.0f;
+    for (int i = 0; i < clip.getFrameCount(); ++i) {
+        const auto &frame = clip.getFrame(i);
+        decodeFirstChannel(frame);
+        float windowsPerSample = windowsPerSecond / frame.sampleRate;
+        float frameStartWindow = frameStart * windowsPerSecond;
+        for (size_t j = 0; j < _samples.size(); ++j) {
+            int window = std::min(static_cast<int>(frameStartWindow + j * windowsPerSample), windowCount - 1);
+            float amplitude = std::fabs(_samples[j]);
+            for (int held = lastWindow + 1; held < window; ++held) {
+                envelope.peak[held] = lastAmplitude;
+                envelope.rms[held] = lastAmplitude * lastAmplitude;
+                windowSampleCounts[held] = 1;
+            }
+            envelope.peak[window] = std::max(envelope.peak[window], amplitude);
+            envelope.rms[window] += amplitude * amplitude;
+            ++windowSampleCounts[window];
+            lastWindow = window;
+            lastAmplitude = amplitude;
+        }
+        frameStart += frameDuration(frame);
+    }
+    for (int held = lastWindow + 1; held < windowCount; ++held) {
+        envelope.peak[held] = lastAmplitude;
+        envelope.rms[held] = lastAmplitude * lastAmplitude;
+        windowSampleCounts[held] = 1;
+    }
+    for (int i = 0; i < windowCount; ++i) {
+        if (windowSampleCounts[i] > 0) {
+            envelope.rms[i] = std::sqrt(envelope.rms[i] / windowSampleCounts[i]);
+        }
+    }
+
+    return envelope;
+}
+
 std::vector<TimeSpan> AudioAnalyzer::silentSpans(const AudioClip &clip,
                                                  float minSilenceDuration,
                                                  float maxSilenceAmplitude) {
+    return silentSpans(envelope(clip), minSilenceDuration, maxSilenceAmplitude);
+}
+
+std::vector<TimeSpan> AudioAnalyzer::silentSpans(const AudioEnvelope &envelope,
+                                                 float minSilenceDuration,
+                                                 float maxSilenceAmplitude) {
     std::vector<TimeSpan> silentSpans;
-    auto frameSpans = computeFrameSpans(clip);
     float silenceStart = 0.0f;
     bool silentSpan = false;
-    for (float t = 0.0f; t < clip.duration(); t += 0.001f) {
-        for (int i = 0; i < clip.getFrameCount(); ++i) {
-            if (!frameSpans[i].contains(t)) {
-                continue;
+    for (int i = 0; i < envelope.windowCount(); ++i) {
+        float t = i * envelope.windowDuration;
+        bool silent = envelope.peak[i] <= maxSilenceAmplitude;
+        if (silent && !silentSpan) {
+            silenceStart = t;
+            silentSpan = true;
+        } else if (!silent && silentSpan) {
+            if (t - silenceStart >= minSilenceDuration) {
+                silentSpans.push_back(TimeSpan {silenceStart, t});
             }
-            float sampleTime = t - frameSpans[i].startInclusive;
-            float sample = sampleNormalized(clip.getFrame(i), sampleTime);
-            bool silent = std::fabs(sample) <= maxSilenceAmplitude;
-            if (silent && !silentSpan) {
-                silenceStart = t;
-                silentSpan = true;
-            } else if (!silent && silentSpan) {
-                if (t - silenceStart >= minSilenceDuration) {
-                    silentSpans.push_back(TimeSpan {silenceStart, t});
-                }
-                silentSpan = false;
-            }
-            break;
+            silentSpan = false;
         }
     }
-    if (silentSpan && clip.duration() - silenceStart >= minSilenceDuration) {
-        silentSpans.push_back(TimeSpan {silenceStart, clip.duration()});
+    if (silentSpan && envelope.duration - silenceStart >= minSilenceDuration) {
+        silentSpans.push_back(TimeSpan {silenceStart, envelope.duration});
     }
     return silentSpans;
 }
 
 std::vector<float> AudioAnalyzer::waveform(const AudioClip &clip, int resolution) {
-    auto frameSpans = computeFrameSpans(clip);
     std::vector<float> waveform;
+    waveform.reserve(resolution);
+    int frameIdx = -1;
+    float frameStart = 0.0f;
+    float frameEnd = 0.0f;
     for (int x = 0; x < resolution; ++x) {
         float waveformTime = (x / static_cast<float>(resolution)) * clip.duration();
-        for (int i = 0; i < clip.getFrameCount(); ++i) {
-            if (!frameSpans[i].contains(waveformTime)) {
-                continue;
-            }
-            float sampleTime = waveformTime - frameSpans[i].startInclusive;
-            waveform.push_back(sampleNormalized(clip.getFrame(i), sampleTime));
-            break;
+        while (waveformTime >= frameEnd && frameIdx + 1 < clip.getFrameCount()) {
+            ++frameIdx;
+            frameStart = frameEnd;
+            frameEnd = frameStart + frameDuration(clip.getFrame(frameIdx));
+            _samples.clear();
         }
+        if (waveformTime < frameStart || waveformTime >= frameEnd) {
+            continue;
+        }
+        const auto &frame = clip.getFrame(frameIdx);
+        if (_samples.empty()) {
+            decodeFirstChannel(frame);
+        }
+        int sampleIdx = static_cast<int>((waveformTime - frameStart) * frame.sampleRate);
+        if (sampleIdx >= static_cast<int>(_samples.size())) {
+            sampleIdx = static_cast<int>(_samples.size()) - 1;
+        }
+        waveform.push_back(_samples[sampleIdx]);
     }
     return waveform;
 }
 
-std::vector<TimeSpan> AudioAnalyzer::computeFrameSpans(const AudioClip &clip) {
-    std::vector<TimeSpan> spans;
-    float time = 0.0f;
-    for (int i = 0; i < clip.getFrameCount(); ++i) {
-        const auto &frame = clip.getFrame(i);
-        float duration = frame.samples.size() / frame.stride() / static_cast<float>(frame.sampleRate);
-        spans.push_back(TimeSpan {time, time + duration});
-        time += duration;
-    }
-    return spans;
-}
-
-float AudioAnalyzer::sampleNormalized(const AudioClip::Frame &frame, float time) {
-    int sampleIdx = static_cast<int>(time * frame.sampleRate);
-    if (sampleIdx >= frame.samples.size() / frame.stride()) {
-        sampleIdx = frame.samples.size() / frame.stride() - 1;
+void AudioAnalyzer::decodeFirstChannel(const AudioClip::Frame &frame) {
+    size_t sampleCount = frame.samples.size() / frame.stride();
+    _samples.resize(sampleCount);
+    if (sampleCount == 0) {
+        return;
     }
+    // Plain strided loops without per-sample branching, so that the compiler can vectorize them
+    float *out = &_samples[0];
     switch (frame.format) {
     case AudioFormat::Mono8:
-        return reinterpret_cast<const uint8_t *>(&frame.samples[0])[sampleIdx] / 255.0f * 2.0f - 1.0f;
+    case AudioFormat::Stereo8: {
+        auto in = reinterpret_cast<const uint8_t *>(&frame.samples[0]);
+        size_t channels = frame.format == AudioFormat::Stereo8 ? 2 : 1;
+        for (size_t i = 0; i < sampleCount; ++i) {
+            out[i] = in[channels * i] * (2.0f / 255.0f) - 1.0f;
+        }
+        break;
+    }
     case AudioFormat::Mono16:
-        return reinterpret_cast<const int16_t *>(&frame.samples[0])[sampleIdx] / 65535.0f * 2.0f;
-    case AudioFormat::Stereo8:
-        return reinterpret_cast<const uint8_t *>(&frame.samples[0])[2 * sampleIdx] / 255.0f * 2.0f - 1.0f;
-    case AudioFormat::Stereo16:
-        return reinterpret_cast<const int16_t *>(&frame.samples[0])[2 * sampleIdx] / 65535.0f * 2.0f;
+    case AudioFormat::Stereo16: {
+        auto in = reinterpret_cast<const int16_t *>(&frame.samples[0]);
+        size_t channels = frame.format == AudioFormat::Stereo16 ? 2 : 1;
+        for (size_t i = 0; i < sampleCount; ++i) {
+            out[i] = in[channels * i] * (2.0f / 65535.0f);
+        }
+        break;
+    }
     default:
         throw std::logic_error("Unsupported audio format: " + std::to_string(static_cast<int>(frame.format)));
     }
@@ -173,6 +173,16 @@ std::unique_ptr<LipAnimation> LipComposer::compose(const std::string &name,
         std::move(frames));
 }
 
+std::unique_ptr<LipAnimation> LipComposer::compose(const std::string &name,
+                                                   const std::string &u8Text,
+                                                   const AudioEnvelope &envelope,
+                                                   float minSilenceDuration,
+                                                   float maxSilenceAmplitude) {
+    AudioAnalyzer analyzer;
+    auto silentSpans = analyzer.silentSpans(envelope, minSilenceDuration, maxSilenceAmplitude);
+    return compose(name, u8Text, envelope.duration, std::move(silentSpans));
+}
+
 std::vector<std::vector<std::string>> LipComposer::split(const std::string &u8Text) {
     std::vector<std::vector<std::string>> wordGroups;
     std::vector<std::string> words;
@@ -104,7 +104,7 @@ ExpressionTree ExpressionTree::fromProgram(const ScriptProgram &program, IRoutin
 }
 
 void ExpressionTree::decompileFunction(Function &func, std::shared_ptr<DecompilationContext> ctx) {
-    debug(str(boost::format("Decompiling function at %08x") % func.start));
+    R_LOG_DEBUG(LogChannel::Global, str(boost::format("Decompiling function at %08x") % func.start));
 
     auto mainBlock = std::make_shared<BlockExpression>();
     mainBlock->offset = func.start;
@@ -124,7 +124,7 @@ void ExpressionTree::decompileFunction(Function &func, std::shared_ptr<Decompila
         decompiledBlocks[std::make_pair(block->offset, ctx->stack.size())] = block;
 
         try {
-            debug(str(boost::format("Begin decompiling block at %08x") % block->offset));
+            R_LOG_DEBUG(LogChannel::Global, str(boost::format("Begin decompiling block at %08x") % block->offset));
 
             for (uint32_t offset = block->offset; offset < ctx->program.length();) {
                 maxOffset = std::max(maxOffset, offset);
@@ -141,7 +141,7 @@ void ExpressionTree::decompileFunction(Function &func, std::shared_ptr<Decompila
                 // }
 
                 auto &ins = ctx->program.getInstruction(offset);
-                debug(str(boost::format("Decompiling instruction at %08x of type %s") % offset % describeInstructionType(ins.type)));
+                R_LOG_DEBUG(LogChannel::Global, str(boost::format("Decompiling instruction at %08x of type %s") % offset % describeInstructionType(ins.type)));
 
                 if (ins.type == InstructionType::NOP ||
                     ins.type == InstructionType::NOP2) {
@@ -941,7 +941,7 @@ void ExpressionTree::decompileFunction(Function &func, std::shared_ptr<Decompila
                 offset = ins.nextOffset;
             }
 
-            debug(str(boost::format("End decompiling block at %08x") % block->offset));
+            R_LOG_DEBUG(LogChannel::Global, str(boost::format("End decompiling block at %08x") % block->offset));
 
         } catch (const std::logic_error &e) {
             error(str(boost::format("Error decompiling block at %08x: %s") % block->offset % std::string(e.what())));
@@ -950,7 +950,7 @@ void ExpressionTree::decompileFunction(Function &func, std::shared_ptr<Decompila
 
     func.end = maxOffset;
 
-    debug(str(boost::format("End decompiling function at %08x") % func.start));
+    R_LOG_DEBUG(LogChannel::Global, str(boost::format("End decompiling function at %08x") % func.start));
 }
 
 std::unique_ptr<ConstantExpression> ExpressionTree::constantExpression(const Instruction &ins) {
@@ -23,6 +23,7 @@
 #include "reone/system/exception/notimplemented.h"
 
 #include "reone/game/camerastyles.h"
+#include "reone/game/console.h"
 #include "reone/game/d20/classes.h"
 #include "reone/game/d20/feats.h"
 #include "reone/game/d20/skills.h"
@@ -51,6 +52,12 @@ public:
     MOCK_METHOD(std::shared_ptr<CreatureClass>, get, (ClassType key), (override));
 };
 
+class MockConsole : public IConsole, boost::noncopyable {
+public:
+    MOCK_METHOD(void, registerCommand, (std::string name, std::string description, CommandHandler handler), (override));
+    MOCK_METHOD(void, printLine, (const std::string &text), (override));
+};
+
 class MockFeats : public IFeats, boost::noncopyable {
 public:
     MOCK_METHOD(void, init, (), (override));
@@ -124,6 +124,7 @@ public:
     MOCK_METHOD(void, setWalkmesh, (const std::function<void(WalkmeshUniforms &)> &), (override));
     MOCK_METHOD(void, setText, (const std::function<void(TextUniforms &)> &), (override));
     MOCK_METHOD(void, setScreenEffect, (const std::function<void(ScreenEffectUniforms &)> &), (override));
+    MOCK_METHOD(void, setGUIQuads, (const std::function<void(GUIQuadUniforms &)> &), (override));
 };
 
 class TestGraphicsModule : boost::noncopyable {
@@ -155,6 +156,10 @@ public:
         return *_shaderRegistry;
     }
 
+    MockUniforms &uniforms() {
+        return *_uniforms;
+    }
+
     GraphicsServices &services() {
         return *_services;
     }
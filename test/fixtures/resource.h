@@ -50,6 +50,7 @@ class MockGffs : public IGffs, boost::noncopyable {
 public:
     MOCK_METHOD(void, clear, (), (override));
     MOCK_METHOD(std::shared_ptr<Gff>, get, (const std::string &resRef, ResType type), (override));
+    MOCK_METHOD(std::shared_ptr<GffView>, getView, (const std::string &resRef, ResType type), (override));
 };
 
 class MockResources : public IResources, boost::noncopyable {
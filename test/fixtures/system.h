@@ -21,6 +21,7 @@
 
 #include "reone/system/clock.h"
 #include "reone/system/di/services.h"
+#include "reone/system/random.h"
 #include "reone/system/threadpool.h"
 
 namespace reone {
@@ -51,8 +52,9 @@ public:
     void init() {
         _clock = std::make_unique<MockClock>();
         _threadPool = std::make_unique<MockThreadPool>();
+        _random = std::make_unique<Random>(0);
 
-        _services = std::make_unique<SystemServices>(*_clock, *_threadPool);
+        _services = std::make_unique<SystemServices>(*_clock, *_threadPool, *_random);
     }
 
     SystemServices &services() {
@@ -62,6 +64,7 @@ public:
 private:
     std::unique_ptr<MockClock> _clock;
     std::unique_ptr<MockThreadPool> _threadPool;
+    std::unique_ptr<Random> _random;
 
     std::unique_ptr<SystemServices> _services;
 };
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/game/game.h"
+#include "reone/graphics/glutil.h"
+
+#include "../fixtures/engine.h"
+
+using namespace reone;
+using namespace reone::game;
+using namespace reone::graphics;
+using namespace reone::resource;
+using namespace reone::scene;
+
+using testing::_;
+using testing::Return;
+using testing::ReturnRef;
+
+TEST(Game, should_load_module_and_simulate_frames_without_rendering_when_headless) {
+    // given
+    setHeadless(true);
+
+    auto engine = TestEngine();
+    engine.init();
+
+    auto sceneGraph = MockSceneGraph();
+    EXPECT_CALL(engine.sceneModule().graphs(), get(_)).WillRepeatedly(ReturnRef(sceneGraph));
+    EXPECT_CALL(engine.sceneModule().graphs(), sceneNames()).WillRepeatedly(Return(std::set<std::string> {kSceneMain}));
+    EXPECT_CALL(engine.graphicsModule().uniforms(), setGlobals(_)).Times(0);
+    EXPECT_CALL(sceneGraph, render(_)).Times(0);
+
+    auto console = MockConsole();
+    auto game = Game(GameID::KotOR, "", engine.options(), engine.services(), console);
+    game.init();
+
+    // when
+    game.loadModule("end_m01aa");
+    for (int i = 0; i < 3; ++i) {
+        game.update(1.0f / 60.0f);
+    }
+
+    // then
+    testing::Mock::VerifyAndClearExpectations(&engine.graphicsModule().uniforms());
+    testing::Mock::VerifyAndClearExpectations(&sceneGraph);
+
+    // cleanup
+    setHeadless(false);
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/game/pathservice.h"
+
+#include "../fixtures/system.h"
+
+using namespace reone;
+using namespace reone::game;
+using namespace reone::resource;
+
+/**
+ * Runs enqueued tasks only when asked to.
+ */
+class DeferredThreadPool : public IThreadPool, boost::noncopyable {
+public:
+    std::shared_ptr<Task> enqueue(TaskFunc func) override {
+        _queue.push_back(func);
+        return std::make_shared<Task>(std::move(func));
+    }
+
+    void runNext() {
+        std::atomic_bool canceled {false};
+        _queue.front()(canceled);
+        _queue.pop_front();
+    }
+
+private:
+    std::deque<TaskFunc> _queue;
+};
+
+TEST(PathService, should_share_cached_path_between_requests) {
+    // given
+    std::vector<Path::Point> points {{0.0f, 0.0f, {1}},
+                                     {1.0f, 0.0f, {0, 2}},
+                                     {2.0f, 0.0f, {1, 3}},
+                                     {3.0f, 0.0f, {2}}};
+    std::unordered_map<int, float> pointToZ;
+
+    Pathfinder pathfinder;
+    pathfinder.load(points, pointToZ);
+
+    auto threadPool = MockThreadPool();
+    auto pathService = PathService(pathfinder, threadPool);
+
+    // when
+    auto request = pathService.requestPath(glm::vec3(0.1f, 0.0f, 0.0f), glm::vec3(2.9f, 0.0f, 0.0f));
+    auto sharedRequest = pathService.requestPath(glm::vec3(-0.1f, 0.0f, 0.0f), glm::vec3(3.1f, 0.0f, 0.0f));
+    auto trivialRequest = pathService.requestPath(glm::vec3(0.1f, 0.0f, 0.0f), glm::vec3(-0.1f, 0.0f, 0.0f));
+
+    // then
+    EXPECT_TRUE(request->isDone());
+    EXPECT_EQ(4ll, request->points().size());
+    EXPECT_EQ(request, sharedRequest);
+    EXPECT_TRUE(trivialRequest->isDone());
+    EXPECT_TRUE(trivialRequest->points().empty());
+    EXPECT_EQ(1, pathService.numCachedPaths());
+}
+
+TEST(PathService, should_not_wait_for_queued_requests_on_destruction) {
+    // given
+    std::vector<Path::Point> points {{0.0f, 0.0f, {1}},
+                                     {1.0f, 0.0f, {0}}};
+    std::unordered_map<int, float> pointToZ;
+
+    Pathfinder pathfinder;
+    pathfinder.load(points, pointToZ);
+
+    // Thread pool without worker threads never runs queued tasks
+    auto threadPool = ThreadPool();
+    auto pathService = std::make_unique<PathService>(pathfinder, threadPool);
+    auto request = pathService->requestPath(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+
+    // when
+    pathService.reset();
+
+    // then
+    EXPECT_FALSE(request->isDone());
+}
+
+TEST(PathService, should_not_cache_paths_requested_before_cache_was_cleared) {
+    // given
+    std::vector<Path::Point> points {{0.0f, 0.0f, {1}},
+                                     {1.0f, 0.0f, {0}}};
+    std::unordered_map<int, float> pointToZ;
+
+    Pathfinder pathfinder;
+    pathfinder.load(points, pointToZ);
+
+    auto threadPool = DeferredThreadPool();
+    auto pathService = PathService(pathfinder, threadPool);
+    auto staleRequest = pathService.requestPath(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+
+    // when
+    pathService.clearCache();
+    auto freshRequest = pathService.requestPath(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+    threadPool.runNext();
+    int numCachedAfterStale = pathService.numCachedPaths();
+    threadPool.runNext();
+
+    // then
+    EXPECT_NE(staleRequest, freshRequest);
+    EXPECT_TRUE(staleRequest->isDone());
+    EXPECT_EQ(0, numCachedAfterStale);
+    EXPECT_TRUE(freshRequest->isDone());
+    EXPECT_EQ(1, pathService.numCachedPaths());
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/game/savedgamecache.h"
+#include "reone/system/stream/fileoutput.h"
+
+using namespace reone;
+using namespace reone::game;
+using namespace reone::graphics;
+
+TEST(SavedGameCache, should_save_and_load_saved_game_info_and_invalidate_it_when_file_changes) {
+    // given
+    auto tmpDirPath = std::filesystem::temp_directory_path();
+    tmpDirPath.append("reone_test_saved_game_cache");
+    std::filesystem::create_directory(tmpDirPath);
+
+    auto savePath = tmpDirPath;
+    savePath.append("000001.sav");
+    auto save = FileOutputStream(savePath);
+    save.write("MOD V1.0", 8);
+    save.close();
+
+    auto unusedSavePath = tmpDirPath;
+    unusedSavePath.append("000002.sav");
+    auto unusedSave = FileOutputStream(unusedSavePath);
+    unusedSave.write("MOD V1.0", 8);
+    unusedSave.close();
+
+    auto cachePath = tmpDirPath;
+    cachePath.append("savecache.bin");
+
+    auto info = SavedGameInfo();
+    info.lastModule = "end_m01aa";
+    info.screenWidth = 2;
+    info.screenHeight = 1;
+    info.screenFormat = PixelFormat::BGR8;
+    info.screenPixels = ByteBuffer {1, 2, 3, 4, 5, 6};
+
+    auto cache = SavedGameCache(cachePath);
+    cache.put(savePath, info);
+    cache.put(unusedSavePath, info);
+    cache.save();
+
+    auto reloadedCache = SavedGameCache(cachePath);
+    reloadedCache.load();
+    reloadedCache.find(savePath);
+    reloadedCache.save();
+
+    // when
+    auto loadedCache = SavedGameCache(cachePath);
+    loadedCache.load();
+    auto loadedInfo = loadedCache.find(savePath);
+    auto prunedInfo = loadedCache.find(unusedSavePath);
+
+    auto modified = FileOutputStream(savePath);
+    modified.write("MOD V1.0 modified", 17);
+    modified.close();
+    auto invalidatedInfo = loadedCache.find(savePath);
+
+    // then
+    ASSERT_TRUE(loadedInfo.has_value());
+    EXPECT_EQ(std::string("end_m01aa"), loadedInfo->lastModule);
+    EXPECT_EQ(2, loadedInfo->screenWidth);
+    EXPECT_EQ(1, loadedInfo->screenHeight);
+    EXPECT_EQ(PixelFormat::BGR8, loadedInfo->screenFormat);
+    EXPECT_EQ((ByteBuffer {1, 2, 3, 4, 5, 6}), loadedInfo->screenPixels);
+    EXPECT_FALSE(prunedInfo.has_value());
+    EXPECT_FALSE(invalidatedInfo.has_value());
+
+    // cleanup
+    std::filesystem::remove_all(tmpDirPath);
+}
+
+TEST(SavedGameCache, should_drop_entries_not_used_since_last_save) {
+    // given
+    auto tmpDirPath = std::filesystem::temp_directory_path();
+    tmpDirPath.append("reone_test_saved_game_cache_reuse");
+    std::filesystem::create_directory(tmpDirPath);
+
+    auto savePath = tmpDirPath;
+    savePath.append("000001.sav");
+    auto save = FileOutputStream(savePath);
+    save.write("MOD V1.0", 8);
+    save.close();
+
+    auto cachePath = tmpDirPath;
+    cachePath.append("savecache.bin");
+
+    auto cache = SavedGameCache(cachePath);
+    cache.put(savePath, SavedGameInfo());
+    cache.save();
+
+    // when
+    auto keptInfo = cache.find(savePath);
+    cache.save();
+    cache.save();
+    auto droppedInfo = cache.find(savePath);
+
+    auto loadedCache = SavedGameCache(cachePath);
+    loadedCache.load();
+    auto loadedInfo = loadedCache.find(savePath);
+
+    // then
+    EXPECT_TRUE(keptInfo.has_value());
+    EXPECT_FALSE(droppedInfo.has_value());
+    EXPECT_FALSE(loadedInfo.has_value());
+
+    // cleanup
+    std::filesystem::remove_all(tmpDirPath);
+}
+
+TEST(SavedGameCache, should_downscale_screenshot_using_box_filter) {
+    // given
+    auto info = SavedGameInfo();
+    info.screenWidth = 4;
+    info.screenHeight = 2;
+    info.screenFormat = PixelFormat::R8;
+    info.screenPixels = ByteBuffer {
+        10, 20, 30, 40,
+        30, 40, 50, 60};
+
+    // when
+    downscaleScreenshot(info, 2);
+
+    // then
+    EXPECT_EQ(2, info.screenWidth);
+    EXPECT_EQ(1, info.screenHeight);
+    EXPECT_EQ((ByteBuffer {25, 45}), info.screenPixels);
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/game/script/scheduler.h"
+
+using namespace reone;
+using namespace reone::game;
+
+TEST(ScriptEventScheduler, should_spread_events_across_interval_by_phase) {
+    // given
+    auto scheduler = ScriptEventScheduler(6.0f, 3, 100, 1.0f);
+    auto callerIds = std::vector<uint32_t> {1, 2, 3, 4, 5, 6};
+    auto dispatched = std::vector<uint32_t>();
+    auto tick = [&](float dt) {
+        scheduler.update(dt, [&](int phase) {
+            for (auto id : callerIds) {
+                if (scheduler.phaseOf(id) == phase) {
+                    scheduler.enqueue(id, "heartbeat");
+                }
+            }
+        });
+        scheduler.dispatch([&](const auto &event) {
+            dispatched.push_back(event.callerId);
+        });
+    };
+
+    // when
+    tick(1.0f);
+    auto afterFirstTick = dispatched;
+    tick(1.0f);
+    auto afterSecondTick = dispatched;
+    tick(4.0f);
+
+    // then
+    EXPECT_TRUE(afterFirstTick.empty());
+    EXPECT_EQ((std::vector<uint32_t> {3, 6}), afterSecondTick);
+    EXPECT_EQ((std::vector<uint32_t> {3, 6, 1, 4, 2, 5}), dispatched);
+}
+
+TEST(ScriptEventScheduler, should_carry_over_events_exceeding_frame_budget) {
+    // given
+    auto scheduler = ScriptEventScheduler(6.0f, 1, 2, 1.0f);
+    int numDispatched = 0;
+    auto run = [&numDispatched](const auto &event) {
+        ++numDispatched;
+    };
+    scheduler.enqueue(1, "heartbeat");
+    scheduler.enqueue(2, "heartbeat");
+    scheduler.enqueue(3, "heartbeat");
+
+    // when
+    bool duplicateQueued = scheduler.enqueue(3, "heartbeat");
+    scheduler.dispatch(run);
+    auto metricsAfterFirstFrame = scheduler.metrics();
+    scheduler.dispatch(run);
+
+    // then
+    EXPECT_FALSE(duplicateQueued);
+    EXPECT_EQ(2, metricsAfterFirstFrame.numDispatched);
+    EXPECT_EQ(1, metricsAfterFirstFrame.numCarriedOver);
+    EXPECT_EQ(3, metricsAfterFirstFrame.maxQueueDepth);
+    EXPECT_EQ(1, metricsAfterFirstFrame.numSkipped);
+    EXPECT_EQ(3, numDispatched);
+    EXPECT_EQ(0, scheduler.metrics().queueDepth);
+    EXPECT_EQ(0, scheduler.metrics().numSkipped);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/game/spatialgrid.h"
+
+using namespace reone;
+using namespace reone::game;
+
+TEST(SpatialGrid, should_find_nearest_items_matching_predicate) {
+    // given
+    std::vector<glm::vec3> positions {
+        glm::vec3(0.0f, 0.0f, 0.0f),
+        glm::vec3(1.0f, 0.0f, 0.0f),
+        glm::vec3(-3.0f, 2.0f, 0.0f),
+        glm::vec3(9.0f, 9.0f, 0.0f),
+        glm::vec3(-20.0f, 0.0f, 0.0f),
+        glm::vec3(30.0f, -30.0f, 0.0f)};
+    auto grid = SpatialGrid<int>(4.0f, [&positions](const int &item) { return positions[item]; });
+    for (int i = 0; i < 6; ++i) {
+        grid.add(i);
+    }
+    auto result = std::vector<std::pair<int, float>>();
+
+    // when
+    grid.findNearest(glm::vec3(0.5f, 0.0f, 0.0f), 3, [](const int &item) { return item != 1; }, result);
+
+    // then
+    EXPECT_EQ(3, result.size());
+    EXPECT_EQ(0, result[0].first);
+    EXPECT_EQ(2, result[1].first);
+    EXPECT_EQ(3, result[2].first);
+    EXPECT_FLOAT_EQ(0.25f, result[0].second);
+}
+
+TEST(SpatialGrid, should_return_all_matching_items_when_count_exceeds_them) {
+    // given
+    std::vector<glm::vec3> positions {
+        glm::vec3(100.0f, 0.0f, 0.0f),
+        glm::vec3(-100.0f, 0.0f, 0.0f)};
+    auto grid = SpatialGrid<int>(4.0f, [&positions](const int &item) { return positions[item]; });
+    grid.add(0);
+    grid.add(1);
+    auto result = std::vector<std::pair<int, float>>();
+
+    // when
+    grid.findNearest(glm::vec3(90.0f, 0.0f, 0.0f), 5, [](const int &) { return true; }, result);
+
+    // then
+    EXPECT_EQ(2, result.size());
+    EXPECT_EQ(0, result[0].first);
+    EXPECT_EQ(1, result[1].first);
+}
+
+TEST(SpatialGrid, should_find_nearest_items_by_current_position_when_moved_within_margin) {
+    // given
+    std::vector<glm::vec3> positions {
+        glm::vec3(1.0f, 0.0f, 0.0f),
+        glm::vec3(5.0f, 0.0f, 0.0f)};
+    auto grid = SpatialGrid<int>(4.0f, [&positions](const int &item) { return positions[item]; });
+    grid.add(0);
+    grid.add(1);
+    positions[0] = glm::vec3(1.5f, 0.0f, 0.0f);
+    positions[1] = glm::vec3(4.5f, 0.0f, 0.0f);
+    auto result = std::vector<std::pair<int, float>>();
+
+    // when
+    bool stale = grid.isStale(1.0f);
+    grid.findNearest(glm::vec3(3.9f, 0.0f, 0.0f), 1, [](const int &) { return true; }, result, 1.0f);
+
+    // then
+    EXPECT_FALSE(stale);
+    EXPECT_EQ(1, result.size());
+    EXPECT_EQ(1, result[0].first);
+    EXPECT_FLOAT_EQ(0.36f, result[0].second);
+}
+
+TEST(SpatialGrid, should_be_stale_when_item_moved_beyond_margin) {
+    // given
+    std::vector<glm::vec3> positions {glm::vec3(0.0f)};
+    auto grid = SpatialGrid<int>(4.0f, [&positions](const int &item) { return positions[item]; });
+    grid.add(0);
+    positions[0] = glm::vec3(2.0f, 0.0f, 0.0f);
+
+    // when
+    bool stale = grid.isStale(1.0f);
+
+    // then
+    EXPECT_TRUE(stale);
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/animation.h"
+#include "reone/graphics/model.h"
+#include "reone/graphics/modelnode.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+static std::shared_ptr<Animation> makeAnimation(const std::string &name) {
+    auto rootNode = std::make_shared<ModelNode>(0, "root_node", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), true);
+    return std::make_shared<Animation>(name, 1.0f, 0.25f, "root_node", std::move(rootNode), std::vector<Animation::Event>());
+}
+
+static std::shared_ptr<Model> makeModel(const std::string &name, std::vector<std::shared_ptr<Animation>> animations, std::shared_ptr<Model> superModel = nullptr) {
+    auto rootNode = std::make_shared<ModelNode>(0, "root_node", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), false);
+    auto model = std::make_shared<Model>(name, 0, std::move(rootNode), std::move(animations), superModel ? superModel->name() : "", 1.0f);
+    model->setSuperModel(std::move(superModel));
+    return model;
+}
+
+TEST(Model, should_resolve_animations_of_supermodel_chain) {
+    // given
+    auto grandSuperPause = makeAnimation("pause1");
+    auto grandSuperWalk = makeAnimation("walk");
+    auto superPause = makeAnimation("pause1");
+    auto superRun = makeAnimation("run");
+    auto ownRun = makeAnimation("run");
+    auto ownTalk = makeAnimation("talk");
+
+    auto grandSuperModel = makeModel("grandsuper", {grandSuperPause, grandSuperWalk});
+    grandSuperModel->init();
+    auto superModel = makeModel("super", {superPause, superRun}, grandSuperModel);
+    superModel->init();
+    auto model = makeModel("model", {ownRun, ownTalk}, superModel);
+
+    // when
+    model->init();
+
+    // then
+    EXPECT_EQ(ownTalk, model->getAnimation("talk"));
+    EXPECT_EQ(ownRun, model->getAnimation("run"));
+    EXPECT_EQ(superPause, model->getAnimation("pause1"));
+    EXPECT_EQ(grandSuperWalk, model->getAnimation("walk"));
+    EXPECT_FALSE(static_cast<bool>(model->getAnimation("dead")));
+}
+
+TEST(Model, should_walk_supermodel_chain_when_supermodel_set_after_init) {
+    // given
+    auto superPause = makeAnimation("pause1");
+    auto superRun = makeAnimation("run");
+    auto ownRun = makeAnimation("run");
+
+    auto superModel = makeModel("super", {superPause, superRun});
+    superModel->init();
+    auto model = makeModel("model", {ownRun});
+    model->init();
+
+    // when
+    model->setSuperModel(superModel);
+
+    // then
+    EXPECT_EQ(ownRun, model->getAnimation("run"));
+    EXPECT_EQ(superPause, model->getAnimation("pause1"));
+    EXPECT_FALSE(static_cast<bool>(model->getAnimation("walk")));
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/pbrcache.h"
+#include "reone/graphics/texture.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+TEST(PBRCache, should_save_and_load_cached_data) {
+    // given
+    auto tmpDirPath = std::filesystem::temp_directory_path();
+    tmpDirPath.append("reone_test_pbr_cache");
+    std::filesystem::remove_all(tmpDirPath);
+
+    auto data = std::make_shared<ByteBuffer>(ByteBuffer {1, 2, 3, 4, 5});
+
+    auto cache = PBRCache(tmpDirPath);
+    cache.init();
+    cache.save("some_envmap_0123456789abcdef", data);
+    cache.deinit();
+
+    auto reloadedCache = PBRCache(tmpDirPath);
+    reloadedCache.init();
+
+    // when
+    auto loaded = reloadedCache.load("some_envmap_0123456789abcdef").get().data;
+    auto missing = reloadedCache.load("other_envmap_0123456789abcdef").get().data;
+
+    // then
+    reloadedCache.deinit();
+    std::filesystem::remove_all(tmpDirPath);
+    EXPECT_TRUE(loaded);
+    EXPECT_EQ(*data, *loaded);
+    EXPECT_FALSE(missing);
+}
+
+TEST(PBRCache, should_ignore_truncated_and_empty_cache_files) {
+    // given
+    auto tmpDirPath = std::filesystem::temp_directory_path();
+    tmpDirPath.append("reone_test_pbr_cache_corrupted");
+    std::filesystem::remove_all(tmpDirPath);
+    std::filesystem::create_directories(tmpDirPath);
+
+    auto writeFile = [&tmpDirPath](const std::string &key, uint32_t size, const std::string &contents) {
+        auto out = std::ofstream(tmpDirPath / (key + ".bin"), std::ios::binary);
+        out.write("RPBRV1.0", 8);
+        out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+        out.write(contents.data(), contents.size());
+    };
+    writeFile("truncated", 0xffffffff, "abc");
+    writeFile("empty", 0, "");
+
+    auto cache = PBRCache(tmpDirPath);
+    cache.init();
+
+    // when
+    auto truncated = cache.load("truncated").get().data;
+    auto empty = cache.load("empty").get().data;
+
+    // then
+    cache.deinit();
+    std::filesystem::remove_all(tmpDirPath);
+    EXPECT_FALSE(truncated);
+    EXPECT_FALSE(empty);
+}
+
+TEST(PBRCache, should_key_env_map_derived_data_by_name_and_contents) {
+    // given
+    auto tmpDirPath = std::filesystem::temp_directory_path();
+    tmpDirPath.append("reone_test_pbr_cache_keys");
+    std::filesystem::remove_all(tmpDirPath);
+
+    auto makeEnvMap = [](std::string name, uint8_t pixel) {
+        auto envMap = std::make_shared<Texture>(std::move(name), TextureType::TwoDim, Texture::Properties());
+        envMap->setPixels(1, 1, PixelFormat::R8, Texture::Layer {std::make_shared<ByteBuffer>(1, pixel)});
+        return envMap;
+    };
+    auto envMap = makeEnvMap("some_envmap", 1);
+    auto sameEnvMap = makeEnvMap("some_envmap", 1);
+    auto modifiedEnvMap = makeEnvMap("some_envmap", 2);
+
+    auto cache = PBRCache(tmpDirPath);
+    cache.init();
+
+    // when
+    auto entry = cache.loadEnvMapDerived(*envMap).get();
+    auto sameEntry = cache.loadEnvMapDerived(*sameEnvMap).get();
+    auto modifiedEntry = cache.loadEnvMapDerived(*modifiedEnvMap).get();
+
+    // then
+    cache.deinit();
+    std::filesystem::remove_all(tmpDirPath);
+    EXPECT_EQ(0, entry.key.find("some_envmap_"));
+    EXPECT_EQ(entry.key, sameEntry.key);
+    EXPECT_NE(entry.key, modifiedEntry.key);
+    EXPECT_FALSE(entry.data);
+}
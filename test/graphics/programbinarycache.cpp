@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/programbinarycache.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+TEST(ProgramBinaryCache, should_compute_key_from_sources_and_driver) {
+    // given
+    auto sources = std::vector<std::string> {"#define A\n", "void main() {}\n"};
+    auto movedSources = std::vector<std::string> {"#define A\nvoid main() {}\n"};
+    auto otherSources = std::vector<std::string> {"#define B\n", "void main() {}\n"};
+
+    // when
+    auto key = ProgramBinaryCache::getKey(sources, "vendor|renderer|4.5");
+    auto sameKey = ProgramBinaryCache::getKey(sources, "vendor|renderer|4.5");
+    auto movedKey = ProgramBinaryCache::getKey(movedSources, "vendor|renderer|4.5");
+    auto otherSourcesKey = ProgramBinaryCache::getKey(otherSources, "vendor|renderer|4.5");
+    auto otherDriverKey = ProgramBinaryCache::getKey(sources, "vendor|renderer|4.6");
+
+    // then
+    EXPECT_EQ(16ll, key.size());
+    EXPECT_EQ(key, sameKey);
+    EXPECT_NE(key, movedKey);
+    EXPECT_NE(key, otherSourcesKey);
+    EXPECT_NE(key, otherDriverKey);
+}
+
+TEST(ProgramBinaryCache, should_save_and_load_binary) {
+    // given
+    auto tmpDirPath = std::filesystem::temp_directory_path();
+    tmpDirPath.append("reone_test_program_binary_cache");
+    std::filesystem::remove_all(tmpDirPath);
+    std::filesystem::create_directories(tmpDirPath);
+
+    auto binary = ProgramBinaryCache::Binary();
+    binary.format = 0x8e5f;
+    binary.data = ByteBuffer {1, 2, 3, 4, 5};
+
+    auto cache = ProgramBinaryCache(tmpDirPath);
+    cache.save("0123456789abcdef", binary);
+
+    auto corruptPath = tmpDirPath;
+    corruptPath.append("fedcba9876543210.bin");
+    auto corrupt = std::ofstream(corruptPath, std::ios::binary);
+    corrupt << "NOTABINARY";
+    corrupt.close();
+
+    // when
+    auto loaded = cache.load("0123456789abcdef");
+    auto missing = cache.load("00000000000000ff");
+    auto corrupted = cache.load("fedcba9876543210");
+
+    // then
+    std::filesystem::remove_all(tmpDirPath);
+    EXPECT_TRUE(loaded);
+    EXPECT_EQ(binary.format, loaded->format);
+    EXPECT_EQ(binary.data, loaded->data);
+    EXPECT_FALSE(missing);
+    EXPECT_FALSE(corrupted);
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/shaderprogram.h"
+
+using namespace reone;
+using namespace reone::graphics;
+
+TEST(UniformHandle, should_intern_uniform_names) {
+    // given
+    auto handle = UniformHandle("uTestUniformA");
+
+    // when
+    auto sameHandle = UniformHandle("uTestUniformA");
+    auto otherHandle = UniformHandle("uTestUniformB");
+
+    // then
+    EXPECT_EQ(handle.id(), sameHandle.id());
+    EXPECT_NE(handle.id(), otherHandle.id());
+    EXPECT_EQ("uTestUniformA", handle.name());
+    EXPECT_EQ("uTestUniformB", otherHandle.name());
+}
+
+TEST(UniformValue, should_skip_updates_with_equal_values) {
+    // given
+    auto value = UniformValue();
+
+    // when
+    auto firstUpdated = value.update(glm::vec3(1.0f, 2.0f, 3.0f));
+    auto sameUpdated = value.update(glm::vec3(1.0f, 2.0f, 3.0f));
+    auto otherUpdated = value.update(glm::vec3(1.0f, 2.0f, 4.0f));
+    value.invalidate();
+    auto invalidatedUpdated = value.update(glm::vec3(1.0f, 2.0f, 4.0f));
+
+    // then
+    EXPECT_TRUE(firstUpdated);
+    EXPECT_FALSE(sameUpdated);
+    EXPECT_TRUE(otherUpdated);
+    EXPECT_TRUE(invalidatedUpdated);
+}
+
+TEST(UniformValue, should_compare_matrices_by_all_elements) {
+    // given
+    auto value = UniformValue();
+    auto m = glm::mat4(1.0f);
+    value.update(m);
+    m[3][3] = 2.0f;
+
+    // when
+    auto updated = value.update(m);
+
+    // then
+    EXPECT_TRUE(updated);
+}
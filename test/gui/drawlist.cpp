@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/texture.h"
+#include "reone/gui/drawlist.h"
+
+using namespace reone;
+using namespace reone::graphics;
+using namespace reone::gui;
+
+static std::shared_ptr<Texture> makeTexture(std::string name) {
+    return std::make_shared<Texture>(std::move(name), TextureType::TwoDim, Texture::Properties());
+}
+
+TEST(DrawList, should_batch_quads_by_texture_when_they_do_not_overlap) {
+    // given
+    auto edge = makeTexture("edge");
+    auto fill = makeTexture("fill");
+    auto drawList = DrawList();
+
+    // when
+    drawList.addQuad(fill, {0, 0}, {100, 20});
+    drawList.addQuad(edge, {0, 0}, {4, 20});
+    drawList.addQuad(fill, {0, 30}, {100, 20});
+    drawList.addQuad(edge, {0, 30}, {4, 20});
+    drawList.addQuad(fill, {0, 60}, {100, 20}, glm::vec4(1.0f), glm::mat3x4(1.0f), BlendMode::Additive);
+
+    // then
+    auto &commands = drawList.commands();
+    EXPECT_EQ(5, drawList.numQuads());
+    ASSERT_EQ(3ll, commands.size());
+    EXPECT_EQ(fill, commands[0].texture);
+    EXPECT_EQ(2ll, commands[0].quads.size());
+    EXPECT_EQ(glm::ivec4(0, 0, 100, 50), commands[0].bounds);
+    EXPECT_EQ(edge, commands[1].texture);
+    EXPECT_EQ(2ll, commands[1].quads.size());
+    EXPECT_EQ(fill, commands[2].texture);
+    EXPECT_EQ(BlendMode::Additive, commands[2].blendMode);
+}
+
+TEST(DrawList, should_preserve_order_of_overlapping_quads_and_custom_commands) {
+    // given
+    auto panel = makeTexture("panel");
+    auto button = makeTexture("button");
+    auto drawList = DrawList();
+    int numCustomCalls = 0;
+
+    // when
+    drawList.addQuad(panel, {0, 0}, {200, 200});
+    drawList.addQuad(button, {10, 10}, {50, 20});
+    drawList.addQuad(panel, {20, 20}, {10, 10});
+    drawList.addCustom(glm::ivec4(300, 0, 400, 20), [&numCustomCalls]() { ++numCustomCalls; });
+    drawList.addQuad(button, {10, 40}, {50, 20});
+    drawList.addCustom(glm::ivec4(10, 70, 60, 90), [&numCustomCalls]() { ++numCustomCalls; });
+    drawList.addQuad(button, {10, 70}, {50, 20});
+
+    // then
+    auto &commands = drawList.commands();
+    ASSERT_EQ(6ll, commands.size());
+    EXPECT_EQ(panel, commands[0].texture);
+    EXPECT_EQ(button, commands[1].texture);
+    EXPECT_EQ(2ll, commands[1].quads.size());
+    EXPECT_EQ(glm::ivec4(10, 10, 60, 60), commands[1].bounds);
+    EXPECT_EQ(panel, commands[2].texture);
+    EXPECT_EQ(1ll, commands[2].quads.size());
+    EXPECT_TRUE(static_cast<bool>(commands[3].custom));
+    EXPECT_TRUE(static_cast<bool>(commands[4].custom));
+    EXPECT_EQ(button, commands[5].texture);
+    EXPECT_EQ(1ll, commands[5].quads.size());
+    EXPECT_EQ(0, numCustomCalls);
+}
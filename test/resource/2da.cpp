@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/resource/2da.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+TEST(TwoDA, should_get_typed_values_by_column_name_and_column_ref) {
+    // given
+    auto twoDa = TwoDA::Builder()
+                     .columns({"label", "value", "scale", "flags", "enabled"})
+                     .row({"first", "10", "0.5", "0x10", "1"})
+                     .row({"second", "****", "1.5", "ff", "0"})
+                     .row({"third", "", "****", "****", "****"})
+                     .build();
+
+    // when
+    auto valueColumn = twoDa->column("value");
+    auto scaleColumn = twoDa->column("scale");
+    auto missingColumn = twoDa->column("missing");
+
+    // then
+    EXPECT_TRUE(valueColumn.isValid());
+    EXPECT_FALSE(missingColumn.isValid());
+    EXPECT_EQ(10, twoDa->getInt(0, "value"));
+    EXPECT_EQ(10, twoDa->getInt(0, valueColumn));
+    EXPECT_EQ(-1, twoDa->getInt(1, valueColumn, -1));
+    EXPECT_EQ(-1, twoDa->getInt(2, valueColumn, -1));
+    EXPECT_EQ(-1, twoDa->getInt(0, missingColumn, -1));
+    EXPECT_FLOAT_EQ(0.5f, twoDa->getFloat(0, scaleColumn));
+    EXPECT_FLOAT_EQ(1.5f, twoDa->getFloat(1, "scale"));
+    EXPECT_FLOAT_EQ(2.0f, twoDa->getFloat(2, scaleColumn, 2.0f));
+    EXPECT_EQ(16u, twoDa->getHexInt(0, "flags"));
+    EXPECT_EQ(255u, twoDa->getHexInt(1, "flags"));
+    EXPECT_TRUE(twoDa->getBool(0, "enabled"));
+    EXPECT_FALSE(twoDa->getBool(1, "enabled", true));
+    EXPECT_TRUE(twoDa->getBool(2, "enabled", true));
+    EXPECT_EQ(std::string("second"), twoDa->getString(1, "label"));
+    EXPECT_FALSE(twoDa->getStringOpt(1, valueColumn).has_value());
+    EXPECT_FALSE(twoDa->getIntOpt(3, valueColumn).has_value());
+}
+
+TEST(TwoDA, should_find_rows_by_cell_values) {
+    // given
+    auto twoDa = TwoDA::Builder()
+                     .columns({"label", "type"})
+                     .row({"door", "1"})
+                     .row({"chest", "2"})
+                     .row({"door", "3"})
+                     .build();
+
+    // when
+    int doorIdx = twoDa->indexByCellValue("label", "door");
+    int chestIdx = twoDa->indexByCellValue(twoDa->column("label"), "chest");
+    int missingIdx = twoDa->indexByCellValue("label", "table");
+    int secondDoorIdx = twoDa->indexByCellValues({{"label", "door"}, {"type", "3"}});
+    int missingDoorIdx = twoDa->indexByCellValues({{"label", "door"}, {"type", "2"}});
+
+    // then
+    EXPECT_EQ(0, doorIdx);
+    EXPECT_EQ(1, chestIdx);
+    EXPECT_EQ(-1, missingIdx);
+    EXPECT_EQ(2, secondDoorIdx);
+    EXPECT_EQ(-1, missingDoorIdx);
+}
+
+TEST(TwoDA, should_throw_when_getting_int_from_non_numeric_cell) {
+    // given
+    auto twoDa = TwoDA::Builder()
+                     .columns({"value"})
+                     .row({"abc"})
+                     .build();
+
+    // expect
+    EXPECT_THROW(twoDa->getInt(0, "value"), std::invalid_argument);
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/resource/format/archiveoutput.h"
+#include "reone/resource/format/erfwriter.h"
+#include "reone/resource/format/rimwriter.h"
+#include "reone/system/exception/validation.h"
+#include "reone/system/stream/memoryoutput.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+static std::string readFile(const std::filesystem::path &path) {
+    auto in = std::ifstream(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+static void writeFile(const std::filesystem::path &path, const std::string &contents) {
+    auto out = std::ofstream(path, std::ios::binary);
+    out.write(contents.data(), contents.size());
+}
+
+TEST(ArchiveFileOutput, should_copy_file_contents_between_buffered_writes) {
+    // given
+    auto srcPath = std::filesystem::temp_directory_path();
+    srcPath.append("reone_test_archive_src");
+    writeFile(srcPath, "Bb");
+    auto destPath = std::filesystem::temp_directory_path();
+    destPath.append("reone_test_archive_dest");
+
+    // when
+    auto out = ArchiveFileOutput(destPath, 4);
+    out.write("Aa", 2);
+    out.copyFrom(srcPath, 2);
+    out.write("CcDdEe", 6);
+    auto position = out.position();
+    out.close();
+
+    // then
+    EXPECT_EQ(10, position);
+    EXPECT_EQ("AaBbCcDdEe", readFile(destPath));
+
+    // cleanup
+    std::filesystem::remove(srcPath);
+    std::filesystem::remove(destPath);
+}
+
+TEST(ArchiveFileOutput, should_write_erf_from_mixed_payloads_same_as_from_buffers) {
+    // given
+    auto srcPath = std::filesystem::temp_directory_path();
+    srcPath.append("reone_test_erf_payload");
+    writeFile(srcPath, "Bb");
+    auto destPath = std::filesystem::temp_directory_path();
+    destPath.append("reone_test_erf_payloads.erf");
+
+    auto expectedBytes = ByteBuffer();
+    auto expectedStream = MemoryOutputStream(expectedBytes);
+    auto expectedWriter = ErfWriter();
+    expectedWriter.add(ErfWriter::Resource {"Aa", ResType::Txi, ByteBuffer {'B', 'b'}});
+    expectedWriter.add(ErfWriter::Resource {"Cc", ResType::Txi, ByteBuffer {'D', 'd', 'd'}});
+    expectedWriter.save(ErfWriter::FileType::ERF, expectedStream);
+
+    auto writer = ErfWriter();
+    writer.add("Aa", ResType::Txi, ResourcePayload::fromFile(srcPath));
+    writer.add("Cc", ResType::Txi, ResourcePayload::fromCallback(3, [](IOutputStream &out) {
+                   out.write("Ddd", 3);
+               }));
+
+    // when
+    writer.save(ErfWriter::FileType::ERF, destPath);
+
+    // then
+    EXPECT_EQ(std::string(&expectedBytes[0], expectedBytes.size()), readFile(destPath));
+
+    // cleanup
+    std::filesystem::remove(srcPath);
+    std::filesystem::remove(destPath);
+}
+
+TEST(ArchiveFileOutput, should_throw_when_callback_writes_wrong_size) {
+    // given
+    auto bytes = ByteBuffer();
+    auto stream = MemoryOutputStream(bytes);
+    auto writer = RimWriter();
+    writer.add("Aa", ResType::Txi, ResourcePayload::fromCallback(3, [](IOutputStream &out) {
+                   out.write("D", 1);
+               }));
+
+    // when, then
+    EXPECT_THROW(writer.save(stream), std::runtime_error);
+}
+
+TEST(ResourcePayload, should_throw_when_file_does_not_fit_in_archive) {
+    // given
+    auto path = std::filesystem::temp_directory_path();
+    path.append("reone_test_payload_too_large.bin");
+    writeFile(path, "");
+    std::filesystem::resize_file(path, static_cast<uintmax_t>(std::numeric_limits<uint32_t>::max()) + 1);
+
+    // when, then
+    EXPECT_THROW(ResourcePayload::fromFile(path), ValidationException);
+
+    // cleanup
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/resource/format/gffreader.h"
+#include "reone/resource/format/gffwriter.h"
+#include "reone/resource/gff.h"
+#include "reone/system/stream/memoryinput.h"
+#include "reone/system/stream/memoryoutput.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+/**
+ * GFF parsing throughput benchmarks. Disabled by default, run with:
+ *
+ * tests --gtest_also_run_disabled_tests --gtest_filter='GffBenchmark.*'
+ */
+
+static std::shared_ptr<Gff> newObjectStruct(uint32_t type, int idx) {
+    auto tag = "object_" + std::to_string(idx);
+    auto builder = Gff::Builder().type(type);
+    builder.field(Gff::Field::newCExoString("Tag", tag));
+    builder.field(Gff::Field::newResRef("TemplateResRef", tag));
+    builder.field(Gff::Field::newCExoLocString("LocName", 1000 + idx, ""));
+    builder.field(Gff::Field::newFloat("XPosition", static_cast<float>(idx)));
+    builder.field(Gff::Field::newFloat("YPosition", static_cast<float>(2 * idx)));
+    builder.field(Gff::Field::newFloat("ZPosition", 0.0f));
+    builder.field(Gff::Field::newFloat("XOrientation", 0.0f));
+    builder.field(Gff::Field::newFloat("YOrientation", 1.0f));
+    builder.field(Gff::Field::newDword("Appearance", idx % 50));
+    builder.field(Gff::Field::newByte("Plot", 0));
+    builder.field(Gff::Field::newByte("Static", idx % 2));
+    builder.field(Gff::Field::newWord("PortraitId", idx % 100));
+    builder.field(Gff::Field::newInt("CurrentHP", 10 + idx % 20));
+    builder.field(Gff::Field::newCExoString("OnHeartbeat", "k_def_heartbeat"));
+    builder.field(Gff::Field::newCExoString("OnUserDefined", "k_def_userdef"));
+    builder.field(Gff::Field::newCExoString("OnDeath", "k_def_death"));
+    builder.field(Gff::Field::newVector("Bearing", glm::vec3(0.0f, 1.0f, 0.0f)));
+    builder.field(Gff::Field::newDword64("ObjectId", 0x7f000000ull + idx));
+    return builder.build();
+}
+
+// Roughly the size of a large area GIT: 16 lists of 256 objects, 18 fields each
+static ByteBuffer newLargeGitBytes() {
+    auto root = Gff::Builder().type(0xffffffff);
+    for (int i = 0; i < 16; ++i) {
+        auto items = std::vector<std::shared_ptr<Gff>>();
+        for (int j = 0; j < 256; ++j) {
+            items.push_back(newObjectStruct(i, 256 * i + j));
+        }
+        root.field(Gff::Field::newList("List" + std::to_string(i), std::move(items)));
+    }
+    auto gff = root.build();
+    auto bytes = ByteBuffer();
+    auto stream = MemoryOutputStream(bytes);
+    auto writer = GffWriter(ResType::Git, *gff);
+    writer.save(stream);
+    return bytes;
+}
+
+TEST(GffBenchmark, DISABLED_should_read_large_gff) {
+    // given
+    auto bytes = newLargeGitBytes();
+    int iterations = 50;
+
+    // when
+    auto start = std::chrono::steady_clock::now();
+    size_t numFields = 0;
+    for (int i = 0; i < iterations; ++i) {
+        auto stream = MemoryInputStream(bytes);
+        auto reader = GffReader(stream);
+        reader.load();
+        numFields += reader.root()->fields().size();
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // then
+    EXPECT_EQ(16ll * iterations, numFields);
+    auto megabytes = bytes.size() * iterations / (1024.0 * 1024.0);
+    std::cout << str(boost::format("GFF: %d bytes, %.3f ms per file, %.1f MiB/s") % bytes.size() % (1000.0 * elapsed / iterations) % (megabytes / elapsed)) << std::endl;
+}
@@ -229,3 +229,51 @@ TEST(GffReader, should_read_gff) {
     EXPECT_EQ(2, gff->getList("List")[0]->getUint("Struct2Word"));
     EXPECT_EQ(3, gff->getList("List")[1]->getInt("Struct3Short"));
 }
+
+TEST(GffReader, should_ignore_cexolocstring_with_multiple_substrings) {
+    // given
+
+    auto input = StringBuilder()
+                     // header
+                     .append("RES V3.2")
+                     .append("\x38\x00\x00\x00", 4) // offset to structs
+                     .append("\x01\x00\x00\x00", 4) // number of structs
+                     .append("\x44\x00\x00\x00", 4) // offset to fields
+                     .append("\x01\x00\x00\x00", 4) // number of fields
+                     .append("\x50\x00\x00\x00", 4) // offset to labels
+                     .append("\x01\x00\x00\x00", 4) // number of labels
+                     .append("\x60\x00\x00\x00", 4) // offset to field data
+                     .append("\x24\x00\x00\x00", 4) // size of field data
+                     .append("\x84\x00\x00\x00", 4) // offset to field indices
+                     .append("\x00\x00\x00\x00", 4) // size of field indices
+                     .append("\x84\x00\x00\x00", 4) // offset to list indices
+                     .append("\x00\x00\x00\x00", 4) // size of list indices
+                     // structs
+                     .append("\xff\xff\xff\xff", 4) // 0: type
+                     .append("\x00\x00\x00\x00", 4) // 0: data offset
+                     .append("\x01\x00\x00\x00", 4) // 0: field count
+                     // fields
+                     .append("\x0c\x00\x00\x00", 4) // 0: type
+                     .append("\x00\x00\x00\x00", 4) // 0: label index
+                     .append("\x00\x00\x00\x00", 4) // 0: data
+                     // labels
+                     .append("CExoLocString\x00\x00\x00", 16)
+                     // field data
+                     .append("\x20\x00\x00\x00\x2a\x00\x00\x00\x02\x00\x00\x00", 12)
+                     .append("\x00\x00\x00\x00\x04\x00\x00\x00Jill", 12)
+                     .append("\x01\x00\x00\x00\x04\x00\x00\x00Jack", 12)
+                     .string();
+
+    auto stream = MemoryInputStream(input);
+    auto reader = GffReader(stream);
+
+    // when
+
+    reader.load();
+
+    // then
+
+    auto gff = reader.root();
+    EXPECT_EQ(42, gff->getInt("CExoLocString"));
+    EXPECT_EQ(std::string(), gff->getString("CExoLocString"));
+}
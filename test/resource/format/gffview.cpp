@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/resource/format/gffview.h"
+#include "reone/resource/format/gffwriter.h"
+#include "reone/resource/gff.h"
+#include "reone/resource/parser/gff/git.h"
+#include "reone/resource/parser/gff/utw.h"
+#include "reone/system/stream/memoryoutput.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+static ByteBuffer toBytes(ResType resType, const Gff &gff) {
+    auto bytes = ByteBuffer();
+    auto stream = MemoryOutputStream(bytes);
+    auto writer = GffWriter(resType, gff);
+    writer.save(stream);
+    return bytes;
+}
+
+TEST(GffView, should_map_labels_to_slots) {
+    // given
+    auto gff = Gff::Builder()
+                   .field(Gff::Field::newInt("Zeta", 1))
+                   .field(Gff::Field::newInt("Alpha", 2))
+                   .field(Gff::Field::newInt("Unknown", 3))
+                   .build();
+    auto view = GffView(toBytes(ResType::Utw, *gff));
+    view.init();
+
+    // when
+    auto slots = view.mapLabels({"Alpha", "Beta", "Zeta"});
+
+    // then
+    ASSERT_EQ(3ll, slots.size());
+    EXPECT_EQ(2, slots[0]);
+    EXPECT_EQ(0, slots[1]);
+    EXPECT_EQ(-1, slots[2]);
+}
+
+TEST(GffView, should_decode_utw_same_as_parser) {
+    // given
+    auto gff = Gff::Builder()
+                   .field(Gff::Field::newByte("Appearance", 3))
+                   .field(Gff::Field::newCExoString("Comment", "Some comment"))
+                   .field(Gff::Field::newCExoLocString("LocalizedName", 42, "Waypoint"))
+                   .field(Gff::Field::newByte("MapNoteEnabled", 1))
+                   .field(Gff::Field::newCExoString("Tag", "wp_start"))
+                   .field(Gff::Field::newResRef("TemplateResRef", "wp_start"))
+                   .build();
+    auto view = GffView(toBytes(ResType::Utw, *gff));
+    view.init();
+
+    // when
+    auto parsed = generated::parseUTW(*gff);
+    auto decoded = generated::decodeUTW(view);
+
+    // then
+    EXPECT_EQ(parsed.Appearance, decoded.Appearance);
+    EXPECT_EQ(parsed.Comment, decoded.Comment);
+    EXPECT_EQ(parsed.LocalizedName, decoded.LocalizedName);
+    EXPECT_EQ(parsed.MapNoteEnabled, decoded.MapNoteEnabled);
+    EXPECT_EQ(parsed.Tag, decoded.Tag);
+    EXPECT_EQ(parsed.TemplateResRef, decoded.TemplateResRef);
+    EXPECT_EQ(parsed.HasMapNote, decoded.HasMapNote);
+    EXPECT_EQ(parsed.LinkedTo, decoded.LinkedTo);
+}
+
+TEST(GffView, should_decode_git_lists) {
+    // given
+    auto waypoint1 = Gff::Builder()
+                         .type(5)
+                         .field(Gff::Field::newCExoString("Tag", "wp_1"))
+                         .field(Gff::Field::newFloat("XPosition", 1.0f))
+                         .build();
+    auto waypoint2 = Gff::Builder()
+                         .type(5)
+                         .field(Gff::Field::newCExoString("Tag", "wp_2"))
+                         .field(Gff::Field::newFloat("XPosition", 2.0f))
+                         .build();
+    auto gff = Gff::Builder()
+                   .field(Gff::Field::newList("WaypointList", {waypoint1, waypoint2}))
+                   .build();
+    auto view = GffView(toBytes(ResType::Git, *gff));
+    view.init();
+
+    // when
+    auto git = generated::decodeGIT(view);
+
+    // then
+    ASSERT_EQ(2ll, git.WaypointList.size());
+    EXPECT_EQ("wp_1", git.WaypointList[0].Tag);
+    EXPECT_EQ(1.0f, git.WaypointList[0].XPosition);
+    EXPECT_EQ("wp_2", git.WaypointList[1].Tag);
+    EXPECT_EQ(2.0f, git.WaypointList[1].XPosition);
+    EXPECT_TRUE(git.Creature_List.empty());
+}
@@ -66,8 +66,8 @@ TEST(TlkReader, should_read_tlk) {
 
     auto table = reader.table();
     EXPECT_EQ(2, table->getStringCount());
-    EXPECT_EQ("John", table->getString(0).text);
-    EXPECT_EQ("", table->getString(0).soundResRef);
-    EXPECT_EQ("Jane", table->getString(1).text);
-    EXPECT_EQ("jane", table->getString(1).soundResRef);
+    EXPECT_EQ("John", table->getText(0));
+    EXPECT_EQ("", table->getSoundResRef(0));
+    EXPECT_EQ("Jane", table->getText(1));
+    EXPECT_EQ("jane", table->getSoundResRef(1));
 }
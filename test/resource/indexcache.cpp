@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/resource/indexcache.h"
+#include "reone/resource/resources.h"
+#include "reone/system/stream/fileoutput.h"
+
+using namespace reone;
+using namespace reone::resource;
+
+TEST(ResourceIndexCache, should_save_and_load_container_index_and_invalidate_it_when_file_changes) {
+    // given
+    auto tmpDirPath = std::filesystem::temp_directory_path();
+    tmpDirPath.append("reone_test_index_cache");
+    std::filesystem::create_directory(tmpDirPath);
+
+    auto containerPath = tmpDirPath;
+    containerPath.append("sample.erf");
+    auto container = FileOutputStream(containerPath);
+    container.write("ERF V1.0", 8);
+    container.close();
+
+    auto cachePath = tmpDirPath;
+    cachePath.append("resindex.bin");
+
+    auto index = ResourceIndex();
+    index.files.push_back(containerPath);
+    auto entry1 = ResourceIndex::Entry();
+    entry1.id = ResourceId("sample_16_chars_", ResType::Txt);
+    entry1.offset = 160;
+    entry1.size = 13;
+    index.entries.push_back(entry1);
+    auto entry2 = ResourceIndex::Entry();
+    entry2.id = ResourceId("other", ResType::TwoDA);
+    entry2.offset = 173;
+    entry2.size = 27;
+    entry2.name = "other.2da";
+    index.entries.push_back(entry2);
+
+    auto cache = ResourceIndexCache(cachePath);
+    cache.put(containerPath, std::move(index));
+    cache.save();
+
+    // when
+    auto loadedCache = ResourceIndexCache(cachePath);
+    loadedCache.load();
+    auto loadedIndex = loadedCache.find(containerPath);
+    auto missingIndex = loadedCache.find(tmpDirPath / "missing.erf");
+
+    auto modified = FileOutputStream(containerPath);
+    modified.write("ERF V1.0 modified", 17);
+    modified.close();
+    auto invalidatedIndex = loadedCache.find(containerPath);
+
+    // then
+    ASSERT_TRUE(loadedIndex != nullptr);
+    EXPECT_EQ(1ll, loadedIndex->files.size());
+    EXPECT_EQ(containerPath, loadedIndex->files[0]);
+    ASSERT_EQ(2ll, loadedIndex->entries.size());
+    EXPECT_EQ(ResourceId("sample_16_chars_", ResType::Txt), loadedIndex->entries[0].id);
+    EXPECT_EQ(160, loadedIndex->entries[0].offset);
+    EXPECT_EQ(13, loadedIndex->entries[0].size);
+    EXPECT_EQ(ResourceId("other", ResType::TwoDA), loadedIndex->entries[1].id);
+    EXPECT_EQ(173, loadedIndex->entries[1].offset);
+    EXPECT_EQ(27, loadedIndex->entries[1].size);
+    EXPECT_EQ(std::string("other.2da"), loadedIndex->entries[1].name);
+    EXPECT_TRUE(missingIndex == nullptr);
+    EXPECT_TRUE(invalidatedIndex == nullptr);
+
+    // cleanup
+    std::filesystem::remove_all(tmpDirPath);
+}
+
+TEST(ResourceIndexCache, should_initialize_folder_container_from_cache) {
+    // given
+    auto tmpDirPath = std::filesystem::temp_directory_path();
+    tmpDirPath.append("reone_test_index_cache_folder");
+    std::filesystem::create_directory(tmpDirPath);
+
+    auto overridePath = tmpDirPath;
+    overridePath.append("override");
+    std::filesystem::create_directory(overridePath);
+
+    auto resPath = overridePath;
+    resPath.append("Sample.TXT");
+    auto res = FileOutputStream(resPath);
+    res.write("Hello, world!", 13);
+    res.close();
+
+    auto cachePath = tmpDirPath;
+    cachePath.append("resindex.bin");
+
+    auto cache = ResourceIndexCache(cachePath);
+    auto resources = Resources();
+    resources.setIndexCache(&cache);
+    resources.addFolder(overridePath);
+    cache.save();
+
+    // when
+    auto loadedCache = ResourceIndexCache(cachePath);
+    loadedCache.load();
+    auto cachedIndex = loadedCache.find(overridePath);
+    auto cachedResources = Resources();
+    cachedResources.setIndexCache(&loadedCache);
+    cachedResources.addFolder(overridePath);
+    auto cachedRes = cachedResources.find(ResourceId("sample", ResType::Txt));
+
+    // then
+    EXPECT_TRUE(cachedIndex != nullptr);
+    ASSERT_TRUE(static_cast<bool>(cachedRes));
+    EXPECT_EQ((ByteBuffer {'H', 'e', 'l', 'l', 'o', ',', ' ', 'w', 'o', 'r', 'l', 'd', '!'}), cachedRes->data);
+
+    // cleanup
+    std::filesystem::remove_all(tmpDirPath);
+}
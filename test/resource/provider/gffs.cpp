@@ -65,3 +65,43 @@ TEST(Gffs, should_get_gff_with_caching) {
     EXPECT_TRUE(static_cast<bool>(gff2));
     EXPECT_EQ(gff1.get(), gff2.get());
 }
+
+TEST(Gffs, should_build_gff_from_cached_view) {
+    // given
+
+    auto resBytes = ByteBuffer();
+    auto res = MemoryOutputStream(resBytes);
+    res.write("GFF V3.2", 8);
+    res.write("\x00\x00\x00\x00", 4);
+    res.write("\x00\x00\x00\x00", 4);
+    res.write("\x00\x00\x00\x00", 4);
+    res.write("\x00\x00\x00\x00", 4);
+    res.write("\x00\x00\x00\x00", 4);
+    res.write("\x00\x00\x00\x00", 4);
+    res.write("\x00\x00\x00\x00", 4);
+    res.write("\x00\x00\x00\x00", 4);
+    res.write("\x00\x00\x00\x00", 4);
+    res.write("\x00\x00\x00\x00", 4);
+    res.write("\x00\x00\x00\x00", 4);
+    res.write("\x00\x00\x00\x00", 4);
+
+    auto resources = Resources();
+    auto provider = std::make_unique<MemoryResourceContainer>();
+    provider->add(ResourceId("sample", ResType::Gff), std::move(resBytes));
+    resources.add(std::move(provider));
+
+    auto gffs = Gffs(resources);
+
+    // when
+
+    auto gff = gffs.get("sample", ResType::Gff);
+
+    resources.clear();
+
+    auto view = gffs.getView("sample", ResType::Gff);
+
+    // then
+
+    EXPECT_TRUE(static_cast<bool>(gff));
+    EXPECT_TRUE(static_cast<bool>(view));
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/animation.h"
+#include "reone/graphics/options.h"
+#include "reone/graphics/types.h"
+#include "reone/scene/graphs.h"
+#include "reone/scene/node/camera.h"
+#include "reone/scene/node/light.h"
+#include "reone/scene/node/model.h"
+
+#include "../fixtures/audio.h"
+#include "../fixtures/graphics.h"
+#include "../fixtures/resource.h"
+#include "../fixtures/scene.h"
+
+using namespace reone;
+using namespace reone::audio;
+using namespace reone::graphics;
+using namespace reone::resource;
+using namespace reone::scene;
+
+struct TestLight {
+    glm::vec3 position {0.0f};
+    float radius {0.0f};
+    bool shadow {false};
+    float flareRadius {0.0f};
+};
+
+class TestSceneGraph {
+public:
+    TestSceneGraph() {
+        _graphicsModule.init();
+        _audioModule.init();
+        _resourceModule.init();
+
+        _scene = std::make_unique<SceneGraph>("test", _pipelineFactory, _graphicsOpt, _graphicsModule.services(), _audioModule.services(), _resourceModule.services());
+
+        // Camera is looking at the origin from a distance of 10 units
+        _camera = _scene->newCamera();
+        _camera->setLocalTransform(glm::translate(glm::vec3(0.0f, 0.0f, 10.0f)));
+        _camera->setPerspectiveProjection(glm::radians(90.0f), 1.0f, 0.1f, 1000.0f);
+        _scene->setActiveCamera(_camera.get());
+    }
+
+    void addLights(const std::vector<TestLight> &lights) {
+        _rootNode = std::make_shared<ModelNode>(0, "root_node", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), true, nullptr);
+        for (size_t i = 0; i < lights.size(); ++i) {
+            auto light = std::make_shared<ModelNode::Light>();
+            light->shadow = lights[i].shadow;
+            light->flareRadius = lights[i].flareRadius;
+            if (lights[i].flareRadius > 0.0f) {
+                light->flares.push_back(ModelNode::LensFlare());
+            }
+            auto lightNode = std::make_shared<ModelNode>(static_cast<uint16_t>(i + 1), lightName(i), lights[i].position, glm::quat(1.0f, 0.0f, 0.0f, 0.0f), true, _rootNode.get());
+            lightNode->setLight(light);
+            _rootNode->addChild(lightNode);
+        }
+        _model = std::make_unique<Model>("some_model", 0, _rootNode, std::vector<std::shared_ptr<Animation>>(), "", 1.0f);
+
+        auto modelSceneNode = _scene->newModel(*_model, ModelUsage::Placeable);
+        _modelSceneNode = modelSceneNode.get();
+        for (size_t i = 0; i < lights.size(); ++i) {
+            light(i).setRadius(lights[i].radius);
+        }
+        _scene->addRoot(std::move(modelSceneNode));
+    }
+
+    LightSceneNode &light(size_t index) {
+        return static_cast<LightSceneNode &>(*_modelSceneNode->getNodeByName(lightName(index)));
+    }
+
+    SceneGraph &scene() { return *_scene; }
+
+private:
+    GraphicsOptions _graphicsOpt;
+    MockRenderPipelineFactory _pipelineFactory;
+
+    TestGraphicsModule _graphicsModule;
+    TestAudioModule _audioModule;
+    TestResourceModule _resourceModule;
+
+    std::unique_ptr<SceneGraph> _scene;
+    std::shared_ptr<CameraSceneNode> _camera;
+
+    std::shared_ptr<ModelNode> _rootNode;
+    std::unique_ptr<Model> _model;
+    ModelSceneNode *_modelSceneNode {nullptr};
+
+    std::string lightName(size_t index) const {
+        return "light_" + std::to_string(index);
+    }
+};
+
+TEST(SceneGraph, should_keep_directional_lights_ahead_of_closer_point_lights) {
+    // given
+    auto testScene = TestSceneGraph();
+    std::vector<TestLight> lights;
+    for (int i = 0; i < kMaxLights; ++i) {
+        lights.push_back(TestLight {glm::vec3(static_cast<float>(i + 1), 0.0f, 0.0f), 10.0f});
+    }
+    lights.push_back(TestLight {glm::vec3(60.0f, 0.0f, 0.0f), 100.0f});
+    testScene.addLights(lights);
+
+    // when
+    testScene.scene().update(0.0f);
+
+    // then
+    auto &activeLights = testScene.scene().activeLights();
+    EXPECT_EQ(static_cast<size_t>(kMaxLights), activeLights.size());
+    EXPECT_EQ(&testScene.light(kMaxLights), activeLights.front());
+    EXPECT_TRUE(activeLights.front()->isDirectional());
+    EXPECT_EQ(&testScene.light(0), activeLights[1]);
+    EXPECT_TRUE(testScene.light(kMaxLights - 2).isActive());
+    EXPECT_FALSE(testScene.light(kMaxLights - 1).isActive());
+}
+
+TEST(SceneGraph, should_select_closest_shadow_light_within_its_radius) {
+    // given
+    auto testScene = TestSceneGraph();
+    testScene.addLights({
+        TestLight {glm::vec3(0.0f, 0.0f, 0.0f), 5.0f, true},   // closest, but camera is outside of its radius
+        TestLight {glm::vec3(5.0f, 0.0f, 0.0f), 50.0f, false}, // does not cast shadows
+        TestLight {glm::vec3(20.0f, 0.0f, 0.0f), 30.0f, true},
+        TestLight {glm::vec3(10.0f, 0.0f, 0.0f), 20.0f, true},
+    });
+
+    // when
+    testScene.scene().update(0.0f);
+
+    // then
+    EXPECT_TRUE(testScene.scene().hasShadowLight());
+    EXPECT_EQ(glm::vec3(10.0f, 0.0f, 0.0f), testScene.scene().shadowLightPosition());
+    EXPECT_EQ(20.0f, testScene.scene().shadowRadius());
+    EXPECT_EQ(4ll, testScene.scene().activeLights().size());
+}
+
+TEST(SceneGraph, should_keep_closest_flare_lights_within_flare_radius) {
+    // given
+    auto testScene = TestSceneGraph();
+    testScene.addLights({
+        TestLight {glm::vec3(0.0f, 0.0f, 0.0f), 10.0f, false, 5.0f}, // closest, but camera is outside of its flare radius
+        TestLight {glm::vec3(5.0f, 0.0f, 0.0f), 10.0f, false, 50.0f},
+        TestLight {glm::vec3(1.0f, 0.0f, 0.0f), 10.0f, false, 50.0f},
+        TestLight {glm::vec3(4.0f, 0.0f, 0.0f), 10.0f, false, 50.0f},
+        TestLight {glm::vec3(2.0f, 0.0f, 0.0f), 10.0f, false, 50.0f},
+        TestLight {glm::vec3(3.0f, 0.0f, 0.0f), 10.0f, false, 50.0f},
+        TestLight {glm::vec3(0.5f, 0.0f, 0.0f), 10.0f},              // has no flares
+    });
+
+    // when
+    testScene.scene().update(0.0f);
+
+    // then
+    auto &flareLights = testScene.scene().flareLights();
+    EXPECT_EQ(4ll, flareLights.size());
+    EXPECT_EQ(&testScene.light(2), flareLights[0]);
+    EXPECT_EQ(&testScene.light(4), flareLights[1]);
+    EXPECT_EQ(&testScene.light(5), flareLights[2]);
+    EXPECT_EQ(&testScene.light(3), flareLights[3]);
+}
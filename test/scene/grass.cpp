@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/graphics/mesh.h"
+#include "reone/graphics/modelnode.h"
+#include "reone/scene/node/grass.h"
+
+#include "../fixtures/audio.h"
+#include "../fixtures/graphics.h"
+#include "../fixtures/resource.h"
+#include "../fixtures/scene.h"
+
+using namespace reone;
+using namespace reone::audio;
+using namespace reone::graphics;
+using namespace reone::resource;
+using namespace reone::scene;
+
+TEST(GrassSceneNode, should_place_clusters_in_face_deterministically) {
+    // given
+    auto graphicsModule = TestGraphicsModule();
+    graphicsModule.init();
+
+    auto audioModule = TestAudioModule();
+    audioModule.init();
+
+    auto resourceModule = TestResourceModule();
+    resourceModule.init();
+
+    auto sceneGraph = MockSceneGraph();
+
+    auto vertices = std::vector<Mesh::Vertex> {
+        Mesh::VertexBuilder().position({0.0f, 0.0f, 0.0f}).uv2({0.0f, 0.0f}).build(),
+        Mesh::VertexBuilder().position({8.0f, 0.0f, 0.0f}).uv2({1.0f, 0.0f}).build(),
+        Mesh::VertexBuilder().position({8.0f, 8.0f, 0.0f}).uv2({1.0f, 1.0f}).build(),
+        Mesh::VertexBuilder().position({0.0f, 8.0f, 0.0f}).uv2({0.0f, 1.0f}).build()};
+    auto vertexLayout = Mesh::VertexLayoutBuilder()
+                            .stride(5 * sizeof(float))
+                            .offPosition(0)
+                            .offUV2(3 * sizeof(float))
+                            .build();
+    auto faces = std::vector<Mesh::Face> {
+        Mesh::Face {{0, 1, 2}},
+        Mesh::Face {{2, 3, 0}}};
+    auto mesh = Mesh(std::move(vertices), std::move(vertexLayout), std::move(faces));
+
+    auto aabbNode = ModelNode(0, "aabb_node", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), false);
+
+    auto properties = GrassProperties();
+    properties.density = 1.0f;
+    properties.quadSize = 1.0f;
+    properties.probabilities = glm::vec4(0.25f);
+    properties.materials.insert(0);
+
+    auto grass = GrassSceneNode(
+        std::move(properties),
+        aabbNode,
+        sceneGraph,
+        graphicsModule.services(),
+        audioModule.services(),
+        resourceModule.services());
+
+    // when
+    auto placements1 = std::vector<GrassSceneNode::ClusterPlacement>();
+    grass.placeClustersInFace(mesh, 1, placements1);
+    grass.placeClustersInFace(mesh, 0, placements1);
+    auto placements2 = std::vector<GrassSceneNode::ClusterPlacement>();
+    grass.placeClustersInFace(mesh, 0, placements2);
+
+    // then
+    auto numClustersInFace0 = static_cast<size_t>(grass.getNumClustersInFace(mesh.faces()[0].area));
+    auto numClustersInFace1 = static_cast<size_t>(grass.getNumClustersInFace(mesh.faces()[1].area));
+    EXPECT_LT(0ull, numClustersInFace0);
+    EXPECT_EQ(numClustersInFace0 + numClustersInFace1, placements1.size());
+    EXPECT_EQ(numClustersInFace0, placements2.size());
+    auto offset = numClustersInFace1;
+    for (size_t i = 0; i < placements2.size(); ++i) {
+        EXPECT_EQ(placements2[i].position, placements1[offset + i].position);
+        EXPECT_EQ(placements2[i].lightmapUV, placements1[offset + i].lightmapUV);
+        EXPECT_EQ(placements2[i].variant, placements1[offset + i].variant);
+    }
+}
@@ -340,3 +340,54 @@ TEST(ModelSceneNode, hould_transition_between_two_animations) {
     EXPECT_NEAR(3.75f, rootPosition.y, 1e-5);
     EXPECT_NEAR(4.5f, rootPosition.z, 1e-5);
 }
+
+TEST(ModelSceneNode, should_propagate_animated_transforms_to_descendants) {
+    // given
+    auto graphicsOpt = GraphicsOptions();
+    auto pipelineFactory = MockRenderPipelineFactory();
+
+    auto graphicsModule = TestGraphicsModule();
+    graphicsModule.init();
+
+    auto audioModule = TestAudioModule();
+    audioModule.init();
+
+    auto resourceModule = TestResourceModule();
+    resourceModule.init();
+
+    auto scene = std::make_unique<SceneGraph>("test", pipelineFactory, graphicsOpt, graphicsModule.services(), audioModule.services(), resourceModule.services());
+
+    auto rootNode = std::make_shared<ModelNode>(0, "root_node", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), true, nullptr);
+    auto childNode = std::make_shared<ModelNode>(1, "child_node", glm::vec3(0.0f, 0.0f, 1.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), true, rootNode.get());
+    rootNode->addChild(childNode);
+
+    auto animRootNode = std::make_shared<ModelNode>(0, "root_node", glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), false, nullptr);
+    animRootNode->vectorTracks()[ControllerTypes::position].add(0.0f, glm::vec3(0.0f));
+    animRootNode->vectorTracks()[ControllerTypes::position].add(1.0f, glm::vec3(1.0f, 2.0f, 3.0f));
+
+    auto animations = std::vector<std::shared_ptr<Animation>> {
+        std::make_shared<Animation>("some_animation", 1.0f, 0.5f, "root_node", animRootNode, std::vector<Animation::Event>())};
+
+    auto model = Model("some_model", 0, rootNode, animations, "", 1.0f);
+    auto modelSceneNode = std::make_shared<ModelSceneNode>(
+        model,
+        ModelUsage::Creature,
+        *scene,
+        graphicsModule.services(),
+        audioModule.services(),
+        resourceModule.services());
+
+    // when
+    modelSceneNode->init();
+    modelSceneNode->playAnimation("some_animation", nullptr, AnimationProperties::fromFlags(AnimationFlags::fireForget));
+    modelSceneNode->update(1.0f);
+    modelSceneNode->setLocalTransform(glm::translate(glm::vec3(10.0f, 0.0f, 0.0f)));
+
+    // then
+    auto childSceneNode = modelSceneNode->getNodeByName("child_node");
+    EXPECT_TRUE(static_cast<bool>(childSceneNode));
+    auto &childPosition = childSceneNode->absoluteTransform()[3];
+    EXPECT_NEAR(11.0f, childPosition.x, 1e-5);
+    EXPECT_NEAR(2.0f, childPosition.y, 1e-5);
+    EXPECT_NEAR(4.0f, childPosition.z, 1e-5);
+}
@@ -21,6 +21,7 @@
 #include "reone/script/executionstate.h"
 #include "reone/script/program.h"
 #include "reone/script/virtualmachine.h"
+#include "reone/script/virtualmachinepool.h"
 
 #include "../fixtures/script.h"
 
@@ -460,3 +461,37 @@ TEST(VirtualMachine, should_run_script_program__structs) {
     // then
     EXPECT_EQ(1, result);
 }
+
+TEST(VirtualMachine, should_run_another_program_after_reset) {
+    // given
+    auto program1 = std::make_shared<ScriptProgram>("program1");
+    program1->add(Instruction::newCONSTI(1));
+    auto program2 = std::make_shared<ScriptProgram>("program2");
+    program2->add(Instruction::newCONSTI(2));
+    program2->add(Instruction::newCONSTI(3));
+    auto machine = VirtualMachine(program1, std::make_unique<ExecutionContext>());
+    machine.run();
+
+    // when
+    machine.reset(program2, std::make_unique<ExecutionContext>());
+    auto result = machine.run();
+
+    // then
+    EXPECT_EQ(3, result);
+    EXPECT_EQ(2, machine.getStackSize());
+}
+
+TEST(VirtualMachinePool, should_run_programs_with_pooled_machines) {
+    // given
+    auto program = std::make_shared<ScriptProgram>("some_program");
+    program->add(Instruction::newCONSTI(5));
+    auto pool = VirtualMachinePool();
+
+    // when
+    auto result1 = pool.run(program, std::make_unique<ExecutionContext>());
+    auto result2 = pool.run(program, std::make_unique<ExecutionContext>());
+
+    // then
+    EXPECT_EQ(5, result1);
+    EXPECT_EQ(5, result2);
+}
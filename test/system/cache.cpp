@@ -87,3 +87,37 @@ TEST(Cache, should_clear_cached_items) {
     // then
     EXPECT_TRUE(value && (*value) == 2);
 }
+
+TEST(LRUCache, should_evict_least_recently_used_value_when_full) {
+    // given
+    LRUCache<int, int> cache(2);
+    int counter = 0;
+    auto valueFactory = [&counter]() { return std::make_shared<int>(counter++); };
+
+    // when
+    cache.getOrAdd(0, valueFactory);
+    cache.getOrAdd(1, valueFactory);
+    cache.getOrAdd(0, valueFactory);
+    cache.getOrAdd(2, valueFactory);
+    auto value0 = cache.getOrAdd(0, valueFactory);
+    auto value1 = cache.getOrAdd(1, valueFactory);
+
+    // then
+    EXPECT_EQ(2, cache.size());
+    EXPECT_TRUE(value0 && ((*value0) == 0));
+    EXPECT_TRUE(value1 && ((*value1) == 3));
+}
+
+TEST(LRUCache, should_clear_cached_items) {
+    // given
+    LRUCache<int, int> cache(4);
+
+    // when
+    cache.getOrAdd(0, []() { return std::make_shared<int>(0); });
+    cache.clear();
+    auto value = cache.getOrAdd(0, []() { return std::make_shared<int>(1); });
+
+    // then
+    EXPECT_EQ(1, cache.size());
+    EXPECT_TRUE(value && (*value) == 1);
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/system/logutil.h"
+
+using namespace reone;
+
+TEST(LogUtil, should_not_evaluate_message_when_logging_is_disabled) {
+    // given
+    bool evaluated = false;
+    auto message = [&evaluated]() {
+        evaluated = true;
+        return std::string("message");
+    };
+
+    // when
+    R_LOG_DEBUG(LogChannel::Perception, message());
+
+    // then
+    EXPECT_FALSE(Logger::instance.isEnabled(LogSeverity::Debug, LogChannel::Perception));
+    EXPECT_FALSE(evaluated);
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/system/random.h"
+
+using namespace reone;
+
+TEST(RandomGenerator, should_generate_same_sequence_for_same_seed) {
+    // given
+    RandomGenerator first(42);
+    RandomGenerator second(42);
+
+    // when
+    auto firstValues = std::vector<uint32_t>();
+    auto secondValues = std::vector<uint32_t>();
+    for (int i = 0; i < 16; ++i) {
+        firstValues.push_back(first.next());
+        secondValues.push_back(second.next());
+    }
+
+    // then
+    EXPECT_EQ(firstValues, secondValues);
+}
+
+TEST(RandomGenerator, should_generate_values_within_bounds) {
+    // given
+    RandomGenerator generator(1);
+    float values[256];
+
+    // when
+    generator.nextFloats(values, 256, -2.0f, 3.0f);
+    bool intsInBounds = true;
+    bool minGenerated = false;
+    bool maxGenerated = false;
+    for (int i = 0; i < 1000; ++i) {
+        int value = generator.nextInt(1, 6);
+        intsInBounds &= value >= 1 && value <= 6;
+        minGenerated |= value == 1;
+        maxGenerated |= value == 6;
+    }
+
+    // then
+    EXPECT_TRUE(std::all_of(values, values + 256, [](float value) { return value >= -2.0f && value < 3.0f; }));
+    EXPECT_TRUE(intsInBounds);
+    EXPECT_TRUE(minGenerated);
+    EXPECT_TRUE(maxGenerated);
+}
+
+TEST(Random, should_generate_independent_reproducible_streams) {
+    // given
+    Random random(7);
+
+    // when
+    uint32_t combat1 = random.stream(RandomStream::Combat).next();
+    uint32_t scripts1 = random.stream(RandomStream::Scripts).next();
+    random.seed(7);
+    random.stream(RandomStream::Scripts).next();
+    uint32_t combat2 = random.stream(RandomStream::Combat).next();
+
+    // then
+    EXPECT_NE(combat1, scripts1);
+    EXPECT_EQ(combat1, combat2);
+}
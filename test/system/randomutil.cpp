@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/system/randomutil.h"
+
+using namespace reone;
+
+TEST(RandomUtil, should_generate_same_sequence_after_reseeding) {
+    // given
+    setRandomSeed(1234);
+    auto first = std::vector<int>();
+    for (int i = 0; i < 8; ++i) {
+        first.push_back(randomInt(0, 1000));
+    }
+    float firstFloat = randomFloat(0.0f, 1.0f);
+
+    // when
+    setRandomSeed(1234);
+    auto second = std::vector<int>();
+    for (int i = 0; i < 8; ++i) {
+        second.push_back(randomInt(0, 1000));
+    }
+    float secondFloat = randomFloat(0.0f, 1.0f);
+
+    // then
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(firstFloat, secondFloat);
+}
+
+TEST(RandomUtil, should_generate_same_sequence_for_same_thread_stream) {
+    // given
+    setRandomSeed(1234);
+    auto drawFromStream = [](uint32_t index) {
+        auto values = std::vector<int>();
+        std::thread([&values, index]() {
+            setThreadRandomStream(index);
+            for (int i = 0; i < 8; ++i) {
+                values.push_back(randomInt(0, 1000));
+            }
+        }).join();
+        return values;
+    };
+
+    // when
+    auto first = drawFromStream(5);
+    auto second = drawFromStream(5);
+    auto other = drawFromStream(6);
+
+    // then
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+}
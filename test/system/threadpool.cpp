@@ -51,6 +51,29 @@ TEST(ThreadPool, should_execute_enqueued_tasks_in_parallel) {
     EXPECT_EQ(2, shared);
 }
 
+TEST(ThreadPool, should_keep_worker_threads_running_after_init) {
+    for (int attempt = 0; attempt < 20; ++attempt) {
+        // given
+        ThreadPool pool(1);
+        pool.init();
+
+        // when
+        std::atomic_bool executed {false};
+        pool.enqueue([&executed](auto &_) {
+            executed = true;
+        });
+        for (int i = 0; i < 10; ++i) {
+            if (executed) {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2 << i));
+        }
+
+        // then
+        ASSERT_TRUE(executed);
+    }
+}
+
 TEST(ThreadPool, should_cancel_enqueued_task) {
     // given
     ThreadPool pool;
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020-2023 The reone project contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reone/system/tracer.h"
+
+using namespace reone;
+
+TEST(Tracer, should_export_nested_zones_and_counters_as_chrome_trace) {
+    // given
+    Tracer::instance.start();
+    {
+        R_TRACE_ZONE("outer");
+        {
+            R_TRACE_ZONE("inner");
+            R_TRACE_COUNT(DrawCalls, 3);
+        }
+    }
+    Tracer::instance.markFrame();
+    Tracer::instance.stop();
+    {
+        R_TRACE_ZONE("ignored");
+    }
+
+    // when
+    auto trace = std::ostringstream();
+    Tracer::instance.exportChromeTrace(trace);
+
+    // then
+    auto json = trace.str();
+    EXPECT_EQ(3, Tracer::instance.lastFrameValue(TraceCounter::DrawCalls));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"outer\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"inner\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, json.find("\"args\":{\"depth\":1}"));
+    EXPECT_NE(std::string::npos, json.find("\"name\":\"DrawCalls\",\"ph\":\"C\""));
+    EXPECT_NE(std::string::npos, json.find("\"args\":{\"value\":3}"));
+    EXPECT_EQ(std::string::npos, json.find("ignored"));
+}
+
+TEST(Tracer, should_aggregate_zones_by_name) {
+    // given
+    Tracer::instance.start();
+    for (int i = 0; i < 3; ++i) {
+        R_TRACE_ZONE("update");
+        {
+            R_TRACE_ZONE("render");
+        }
+    }
+    Tracer::instance.stop();
+
+    // when
+    auto stats = Tracer::instance.zoneStats();
+
+    // then
+    EXPECT_EQ(2, static_cast<int>(stats.size()));
+    auto update = std::find_if(stats.begin(), stats.end(), [](auto &s) { return s.name == "update"; });
+    auto render = std::find_if(stats.begin(), stats.end(), [](auto &s) { return s.name == "render"; });
+    ASSERT_NE(stats.end(), update);
+    ASSERT_NE(stats.end(), render);
+    EXPECT_EQ(3, update->count);
+    EXPECT_EQ(3, render->count);
+    EXPECT_GE(update->totalTime, render->totalTime);
+    EXPECT_GE(update->totalTime, update->maxTime);
+}
+
+TEST(Tracer, should_count_and_export_zones_dropped_over_capacity) {
+    // given
+    Tracer::instance.start();
+    for (int i = 0; i < Tracer::kMaxZonesPerThread + 2; ++i) {
+        R_TRACE_ZONE("zone");
+    }
+    Tracer::instance.stop();
+
+    // when
+    auto trace = std::ostringstream();
+    Tracer::instance.exportChromeTrace(trace);
+    auto stats = Tracer::instance.zoneStats();
+
+    // then
+    EXPECT_EQ(2u, Tracer::instance.numDroppedZones());
+    EXPECT_NE(std::string::npos, trace.str().find("\"otherData\":{\"droppedZones\":2}"));
+    ASSERT_EQ(1, static_cast<int>(stats.size()));
+    EXPECT_EQ(Tracer::kMaxZonesPerThread, stats.front().count);
+}
@@ -76,3 +76,54 @@ TEST(AudioAnalyzer, should_return_waveform_given_mono8_audio_with_sound_and_sile
     EXPECT_NEAR(waveform[10], 0.0f, 0.01f);
     EXPECT_NEAR(waveform[11], 0.0f, 0.01f);
 }
+
+TEST(AudioAnalyzer, should_compute_envelope_given_mono16_audio_split_across_frames) {
+    // given
+    int16_t firstSamples[] = {0, 16384, -32767, 16384};
+    int16_t secondSamples[] = {0, 0, 0, 0};
+    ByteBuffer firstBuffer(sizeof(firstSamples));
+    std::memcpy(&firstBuffer[0], firstSamples, sizeof(firstSamples));
+    ByteBuffer secondBuffer(sizeof(secondSamples));
+    std::memcpy(&secondBuffer[0], secondSamples, sizeof(secondSamples));
+    AudioClip clip;
+    clip.add(AudioClip::Frame {AudioFormat::Mono16, 8, firstBuffer});
+    clip.add(AudioClip::Frame {AudioFormat::Mono16, 8, secondBuffer});
+    AudioAnalyzer analyzer;
+
+    // when
+    auto envelope = analyzer.envelope(clip, 0.25f);
+
+    // then
+    EXPECT_NEAR(envelope.duration, 1.0f, 0.0001f);
+    EXPECT_EQ(envelope.windowCount(), 4);
+    EXPECT_NEAR(envelope.peak[0], 0.5f, 0.01f);
+    EXPECT_NEAR(envelope.peak[1], 1.0f, 0.01f);
+    EXPECT_NEAR(envelope.peak[2], 0.0f, 0.01f);
+    EXPECT_NEAR(envelope.peak[3], 0.0f, 0.01f);
+    EXPECT_NEAR(envelope.rms[0], 0.3535f, 0.01f);
+    EXPECT_NEAR(envelope.rms[1], 0.7906f, 0.01f);
+    EXPECT_NEAR(envelope.rms[2], 0.0f, 0.01f);
+}
+
+TEST(AudioAnalyzer, should_return_silent_spans_given_stereo16_audio_envelope_with_silence_at_start) {
+    // given
+    int16_t samples[] = {
+        0, 32767, 0, 32767, 0, 32767, 0, 32767,   //
+        16384, 0, 16384, 0, -16384, 0, -16384, 0, //
+        32767, 0, -32767, 0, 32767, 0, -32767, 0  //
+    };
+    ByteBuffer samplesBuffer(sizeof(samples));
+    std::memcpy(&samplesBuffer[0], samples, sizeof(samples));
+    AudioClip clip;
+    clip.add(AudioClip::Frame {AudioFormat::Stereo16, 12, samplesBuffer});
+    AudioAnalyzer analyzer;
+    auto envelope = analyzer.envelope(clip);
+
+    // when
+    auto spans = analyzer.silentSpans(envelope, 0.05f);
+
+    // then
+    EXPECT_EQ(spans.size(), 1ll);
+    EXPECT_NEAR(spans[0].startInclusive, 0.0f, 0.01f);
+    EXPECT_NEAR(spans[0].endExclusive, 0.33f, 0.01f);
+}